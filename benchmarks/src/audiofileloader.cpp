@@ -0,0 +1,118 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "benchmark.h"
+
+// External Includes
+#include <audio/utility/audiofileloader.h>
+#include <audio/utility/audiofileutils.h>
+#include <utility/fileutils.h>
+#include <random>
+#include <cstdio>
+
+// Fills a buffer with white noise
+static void fillNoise(nap::audio::MultiSampleBuffer& buffer)
+{
+	std::mt19937 generator(45);
+	std::uniform_real_distribution<float> noise(-0.5f, 0.5f);
+	for (auto& channel : buffer.channels)
+		for (auto& sample : channel)
+			sample = noise(generator);
+}
+
+
+// Converts 10 seconds of audio from 44.1kHz to 48kHz, linear interpolation against the windowed sinc resampler
+NAP_BENCHMARK(audioResample)
+{
+	constexpr float inputRate = 44100.0f;
+	constexpr float outputRate = 48000.0f;
+	nap::audio::MultiSampleBuffer input(1, static_cast<size_t>(inputRate) * 10);
+	fillNoise(input);
+	const auto& source = input.channels[0];
+
+	nap::audio::SampleBuffer output;
+	double linear = nap::benchmark::measure(10, [&]()
+	{
+		size_t size = static_cast<size_t>(source.size() * outputRate / inputRate);
+		output.resize(size);
+		double step = inputRate / outputRate;
+		for (size_t i = 0; i < size; i++)
+		{
+			double position = i * step;
+			size_t index = static_cast<size_t>(position);
+			float fraction = static_cast<float>(position - index);
+			float next = index + 1 < source.size() ? source[index + 1] : 0.0f;
+			output[i] = source[index] + (next - source[index]) * fraction;
+		}
+		nap::benchmark::consume(output.data());
+	});
+
+	nap::audio::Resampler resampler;
+	double sinc = nap::benchmark::measure(10, [&]()
+	{
+		resampler.process(source, inputRate, outputRate, output);
+		nap::benchmark::consume(output.data());
+	});
+
+	nap::benchmark::report("10s, linear interpolation", linear);
+	nap::benchmark::report("10s, windowed sinc resampler", sinc);
+}
+
+
+// Loads 16 stereo 44.1kHz files at 48kHz, on one thread, on all threads and from the cache
+NAP_BENCHMARK(audioFileLoad)
+{
+	constexpr int fileCount = 16;
+	constexpr float fileRate = 44100.0f;
+	constexpr float sampleRate = 48000.0f;
+	const std::string cacheDirectory = "benchmark_audio_cache";
+
+	nap::utility::ErrorState error;
+	nap::audio::MultiSampleBuffer content(2, static_cast<size_t>(fileRate) * 5);
+	fillNoise(content);
+	std::vector<std::string> files;
+	for (int i = 0; i < fileCount; i++)
+	{
+		files.emplace_back("benchmark_audio_" + std::to_string(i) + ".wav");
+		if (!nap::audio::writeAudioFile(files.back(), content, fileRate, error))
+		{
+			printf("    %s\n", error.toString().c_str());
+			return;
+		}
+	}
+
+	std::vector<nap::audio::MultiSampleBuffer> outputs;
+	std::vector<float> rates;
+	auto load = [&](nap::audio::AudioFileLoader& loader)
+	{
+		outputs.assign(fileCount, nap::audio::MultiSampleBuffer());
+		if (!loader.load(files, sampleRate, outputs, rates, error))
+			printf("    %s\n", error.toString().c_str());
+		nap::benchmark::consume(outputs.data());
+	};
+
+	nap::audio::AudioFileLoader serial_loader("", 1);
+	double serial = nap::benchmark::measure(3, [&]() { load(serial_loader); });
+
+	nap::audio::AudioFileLoader parallel_loader("", 0);
+	double parallel = nap::benchmark::measure(3, [&]() { load(parallel_loader); });
+
+	// The warm-up call of measure fills the cache, the measured calls read from it
+	nap::audio::AudioFileLoader cached_loader(cacheDirectory, 0);
+	double cached = nap::benchmark::measure(3, [&]() { load(cached_loader); });
+	auto statistics = cached_loader.getStatistics();
+
+	nap::benchmark::report("16 files, 1 thread", serial);
+	nap::benchmark::compare("16 files, all threads", serial, parallel);
+	nap::benchmark::compare("16 files, all threads, cached", serial, cached);
+	printf("    cache hits: %d of %d loads\n", statistics.mCacheHitCount, statistics.mFileCount);
+
+	for (const auto& file : files)
+		nap::utility::deleteFile(file);
+	std::vector<std::string> cached_files;
+	nap::utility::listDir(cacheDirectory.c_str(), cached_files);
+	for (const auto& file : cached_files)
+		nap::utility::deleteFile(file);
+}
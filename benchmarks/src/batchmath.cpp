@@ -0,0 +1,90 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "benchmark.h"
+
+// External Includes
+#include <batchmath.h>
+#include <mathutils.h>
+#include <randomgenerator.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <functional>
+#include <vector>
+#include <cstdio>
+
+// Runs every batch function against a loop over its scalar version on 100k values
+NAP_BENCHMARK(batchMath)
+{
+	constexpr int count = 100000;
+	constexpr int iterations = 100;
+	const char* instruction_sets[] = { "none", "SSE2", "AVX", "NEON" };
+	printf("    instruction set: %s\n", instruction_sets[static_cast<int>(nap::math::getSIMDInstructionSet())]);
+
+	nap::math::RandomGenerator generator(48);
+	std::vector<glm::vec3> points(count);
+	std::vector<glm::vec3> out_points(count);
+	generator.fill(points.data(), count, glm::vec3(-1.0f), glm::vec3(1.0f));
+	std::vector<float> start(count), end(count), values(count);
+	generator.fill(start.data(), count);
+	generator.fill(end.data(), count);
+
+	// Measures the scalar loop and batch call of a function and prints both
+	auto run = [&](const char* name, const std::function<void()>& scalar, const std::function<void()>& batch)
+	{
+		double scalar_time = nap::benchmark::measure(iterations, scalar);
+		double batch_time = nap::benchmark::measure(iterations, batch);
+		nap::benchmark::report(std::string(name) + ", scalar", scalar_time);
+		nap::benchmark::compare(std::string(name) + ", batch", scalar_time, batch_time);
+	};
+
+	glm::mat4 transform = glm::rotate(glm::translate(glm::mat4(1.0f), glm::vec3(1.0f, 2.0f, 3.0f)), 0.5f, glm::vec3(0.0f, 1.0f, 0.0f));
+	run("transform points", [&]()
+	{
+		for (int i = 0; i < count; i++)
+			out_points[i] = nap::math::objectToWorld(points[i], transform);
+		nap::benchmark::consume(out_points.data());
+	}, [&]()
+	{
+		nap::math::batch::transformPoints(transform, points.data(), out_points.data(), count);
+		nap::benchmark::consume(out_points.data());
+	});
+
+	run("lerp", [&]()
+	{
+		for (int i = 0; i < count; i++)
+			values[i] = nap::math::lerp<float>(start[i], end[i], 0.25f);
+		nap::benchmark::consume(values.data());
+	}, [&]()
+	{
+		nap::math::batch::lerp(start.data(), end.data(), 0.25f, values.data(), count);
+		nap::benchmark::consume(values.data());
+	});
+
+	std::vector<float> velocities(count, 0.0f);
+	run("smooth damp", [&]()
+	{
+		for (int i = 0; i < count; i++)
+			values[i] = nap::math::smoothDamp(values[i], end[i], velocities[i], 0.016f, 0.5f);
+		nap::benchmark::consume(values.data());
+	}, [&]()
+	{
+		nap::math::batch::smoothDamp(values.data(), end.data(), velocities.data(), count, 0.016f, 0.5f);
+		nap::benchmark::consume(values.data());
+	});
+
+	for (auto type : { nap::math::EWaveform::SINE, nap::math::EWaveform::TRIANGLE })
+	{
+		run(type == nap::math::EWaveform::SINE ? "sine waveform" : "triangle waveform", [&]()
+		{
+			for (int i = 0; i < count; i++)
+				values[i] = nap::math::waveform(type, start[i], 2.0f);
+			nap::benchmark::consume(values.data());
+		}, [&]()
+		{
+			nap::math::batch::waveform(type, start.data(), 2.0f, values.data(), count);
+			nap::benchmark::consume(values.data());
+		});
+	}
+}
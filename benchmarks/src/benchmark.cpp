@@ -0,0 +1,67 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "benchmark.h"
+
+// External Includes
+#include <cstdio>
+#include <utility>
+#include <vector>
+
+namespace nap
+{
+	namespace benchmark
+	{
+		// All registered benchmarks, in order of registration
+		static std::vector<std::pair<std::string, BenchmarkFunction>>& getBenchmarks()
+		{
+			static std::vector<std::pair<std::string, BenchmarkFunction>> benchmarks;
+			return benchmarks;
+		}
+
+
+		Registration::Registration(const char* name, BenchmarkFunction function)
+		{
+			getBenchmarks().emplace_back(name, function);
+		}
+
+
+		int run(const std::string& filter)
+		{
+			int count = 0;
+			for (const auto& benchmark : getBenchmarks())
+			{
+				if (!filter.empty() && benchmark.first.find(filter) == std::string::npos)
+					continue;
+
+				printf("%s\n", benchmark.first.c_str());
+				benchmark.second();
+				count++;
+			}
+			return count;
+		}
+
+
+		// Written by consume, volatile so that the store can't be optimized away
+		static const void* volatile sSink = nullptr;
+
+		void consume(const void* value)
+		{
+			sSink = value;
+		}
+
+
+		void report(const std::string& label, double microseconds)
+		{
+			printf("    %-56s %12.3f us\n", label.c_str(), microseconds);
+		}
+
+
+		void compare(const std::string& label, double baseline, double microseconds)
+		{
+			printf("    %-56s %12.3f us  %6.2fx\n", label.c_str(), microseconds, baseline / microseconds);
+		}
+	}
+}
@@ -0,0 +1,78 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// External Includes
+#include <chrono>
+#include <string>
+
+namespace nap
+{
+	namespace benchmark
+	{
+		using BenchmarkFunction = void(*)();
+
+		/**
+		 * Registers a benchmark on construction, use NAP_BENCHMARK to define a benchmark.
+		 */
+		struct Registration
+		{
+			Registration(const char* name, BenchmarkFunction function);
+		};
+
+		/**
+		 * Runs all registered benchmarks whose name contains the filter, all benchmarks when the filter is empty.
+		 * @param filter part of the name of the benchmarks to run
+		 * @return number of benchmarks that ran
+		 */
+		int run(const std::string& filter);
+
+		/**
+		 * Prevents the optimizer from removing the computation of a value, the pointer is passed to another translation unit.
+		 * @param value the value to keep
+		 */
+		void consume(const void* value);
+
+		/**
+		 * Prints a single measurement.
+		 * @param label what was measured
+		 * @param microseconds average time of a single iteration in microseconds
+		 */
+		void report(const std::string& label, double microseconds);
+
+		/**
+		 * Prints a measurement and how much faster it is than the baseline.
+		 * @param label what was measured
+		 * @param baseline average time of a single iteration of the baseline in microseconds
+		 * @param microseconds average time of a single iteration in microseconds
+		 */
+		void compare(const std::string& label, double baseline, double microseconds);
+
+		/**
+		 * Calls the function once to warm up, then the given number of times.
+		 * @param iterations number of measured calls
+		 * @param function the function to measure
+		 * @return average time of a single call in microseconds
+		 */
+		template<typename F>
+		double measure(int iterations, F&& function)
+		{
+			function();
+			auto start = std::chrono::high_resolution_clock::now();
+			for (int i = 0; i < iterations; i++)
+				function();
+			auto elapsed = std::chrono::high_resolution_clock::now() - start;
+			return std::chrono::duration<double, std::micro>(elapsed).count() / iterations;
+		}
+	}
+}
+
+/**
+ * Defines and registers a benchmark function
+ */
+#define NAP_BENCHMARK(NAME)																				\
+	static void NAME();																					\
+	static nap::benchmark::Registration NAME##Registration(#NAME, &NAME);								\
+	static void NAME()
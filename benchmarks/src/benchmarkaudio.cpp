@@ -0,0 +1,46 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "benchmarkaudio.h"
+
+// External Includes
+#include <cstdio>
+#include <random>
+
+namespace nap
+{
+	namespace benchmark
+	{
+		audio::SafeOwner<audio::MultiSampleBuffer> createNoise(audio::NodeManager& nodeManager, int channelCount, int sampleCount)
+		{
+			std::mt19937 generator(41);
+			std::uniform_real_distribution<float> noise(-0.5f, 0.5f);
+			auto buffer = nodeManager.makeSafe<audio::MultiSampleBuffer>(channelCount, sampleCount);
+			for (auto& channel : buffer->channels)
+				for (auto& sample : channel)
+					sample = noise(generator);
+			return buffer;
+		}
+
+
+		audio::OfflineRenderStatistics render(audio::AudioService& service, const std::string& label, double duration, bool profiling)
+		{
+			audio::OfflineRenderer renderer(service, 2, audioSampleRate, audioBufferSize);
+			renderer.setProfilingEnabled(profiling);
+
+			audio::MultiSampleBuffer output;
+			utility::ErrorState error;
+			if (!renderer.render(duration, output, error))
+			{
+				printf("    %s\n", error.toString().c_str());
+				return {};
+			}
+
+			const auto& statistics = renderer.getStatistics();
+			printf("    %-56s %12.1fx real-time\n", label.c_str(), statistics.mRealTimeFactor);
+			return statistics;
+		}
+	}
+}
@@ -0,0 +1,39 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// External Includes
+#include <audio/service/audioservice.h>
+#include <audio/service/offlinerenderer.h>
+#include <audio/utility/safeptr.h>
+
+namespace nap
+{
+	namespace benchmark
+	{
+		// Sample rate and callback size of all audio benchmarks
+		constexpr float audioSampleRate = 48000.0f;
+		constexpr int audioBufferSize = 256;
+
+		/**
+		 * Creates a buffer of white noise.
+		 * @param nodeManager the node manager that disposes the buffer
+		 * @param channelCount number of channels
+		 * @param sampleCount number of samples per channel
+		 * @return the buffer
+		 */
+		audio::SafeOwner<audio::MultiSampleBuffer> createNoise(audio::NodeManager& nodeManager, int channelCount, int sampleCount);
+
+		/**
+		 * Renders the node system of the service offline and prints the real-time factor.
+		 * @param service the audio service, not initialized
+		 * @param label what is rendered
+		 * @param duration seconds of audio to render
+		 * @param profiling if the CPU time of every node is measured
+		 * @return statistics of the render
+		 */
+		audio::OfflineRenderStatistics render(audio::AudioService& service, const std::string& label, double duration, bool profiling);
+	}
+}
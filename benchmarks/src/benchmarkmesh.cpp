@@ -0,0 +1,47 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "benchmarkmesh.h"
+
+// External Includes
+#include <renderglobals.h>
+#include <cmath>
+
+namespace nap
+{
+	namespace benchmark
+	{
+		void createGrid(MeshInstance& mesh, int gridSize)
+		{
+			mesh.setNumVertices(gridSize * gridSize);
+			mesh.setDrawMode(EDrawMode::Triangles);
+
+			std::vector<glm::vec3> positions;
+			positions.reserve(gridSize * gridSize);
+			for (int y = 0; y < gridSize; y++)
+			{
+				for (int x = 0; x < gridSize; x++)
+				{
+					float height = 0.1f * std::sin(static_cast<float>(x) * 0.2f) * std::cos(static_cast<float>(y) * 0.2f);
+					positions.emplace_back(static_cast<float>(x) / gridSize, static_cast<float>(y) / gridSize, height);
+				}
+			}
+			mesh.getOrCreateAttribute<glm::vec3>(vertexid::normal).setData(std::vector<glm::vec3>(positions.size()));
+			mesh.getOrCreateAttribute<glm::vec3>(vertexid::position).setData(positions);
+
+			std::vector<uint32>& indices = mesh.createShape().getIndices();
+			indices.reserve((gridSize - 1) * (gridSize - 1) * 6);
+			for (int y = 0; y < gridSize - 1; y++)
+			{
+				for (int x = 0; x < gridSize - 1; x++)
+				{
+					uint32 v = static_cast<uint32>(y * gridSize + x);
+					uint32 size = static_cast<uint32>(gridSize);
+					indices.insert(indices.end(), { v, v + 1, v + size, v + 1, v + size + 1, v + size });
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,23 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// External Includes
+#include <mesh.h>
+
+namespace nap
+{
+	namespace benchmark
+	{
+		/**
+		 * Fills a mesh with a triangulated grid of gridSize x gridSize vertices in the 0-1 range,
+		 * displaced along z by a wave. Creates the position and normal attributes.
+		 * Only CPU data is written, the mesh is not initialized on the GPU.
+		 * @param mesh the mesh to fill, without attributes and shapes
+		 * @param gridSize number of vertices along each side
+		 */
+		void createGrid(MeshInstance& mesh, int gridSize);
+	}
+}
@@ -0,0 +1,73 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "benchmark.h"
+#include "benchmarkaudio.h"
+
+// External Includes
+#include <audio/node/convolutionnode.h>
+#include <audio/node/bufferplayernode.h>
+#include <audio/node/outputnode.h>
+#include <audio/utility/convolutionkernel.h>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+
+// Convolves noise with impulse responses of 0.1, 0.5 and 1 second, a direct form FIR filter against the partitioned convolution node.
+// Both are reported as the CPU time per channel, as a percentage of real-time.
+NAP_BENCHMARK(audioConvolution)
+{
+	constexpr double duration = 5.0;
+	const int blockSize = nap::benchmark::audioBufferSize;
+
+	nap::audio::AudioService service(nullptr);
+	auto& node_manager = service.getNodeManager();
+	auto noise = nap::benchmark::createNoise(node_manager, 1, static_cast<int>(nap::benchmark::audioSampleRate * (duration + 1.0)));
+
+	for (double length : { 0.1, 0.5, 1.0 })
+	{
+		// Exponentially decaying noise
+		const int tap_count = static_cast<int>(nap::benchmark::audioSampleRate * length);
+		auto impulse_response = nap::benchmark::createNoise(node_manager, 1, tap_count);
+		for (int i = 0; i < tap_count; i++)
+			(*impulse_response)[0][i] *= std::exp(-6.0f * static_cast<float>(i) / tap_count);
+
+		// Direct form, every output sample is the dot product of the impulse response and the input history
+		const nap::audio::SampleBuffer& input = (*noise)[0];
+		const nap::audio::SampleBuffer& taps = (*impulse_response)[0];
+		std::vector<float> output(blockSize);
+		int offset = tap_count;
+		double direct = nap::benchmark::measure(20, [&]()
+		{
+			for (int i = 0; i < blockSize; i++, offset++)
+			{
+				float sum = 0.0f;
+				for (int t = 0; t < tap_count; t++)
+					sum += taps[t] * input[offset - t];
+				output[i] = sum;
+			}
+			nap::benchmark::consume(output.data());
+		});
+		double block_duration = blockSize / nap::benchmark::audioSampleRate * 1000000.0;
+		std::string label = std::to_string(tap_count) + " taps";
+		printf("    %-56s %12.3f %% of real-time\n", (label + ", direct").c_str(), 100.0 * direct / block_duration);
+
+		// Partitioned
+		auto player = std::make_unique<nap::audio::BufferPlayerNode>(node_manager);
+		auto convolution = std::make_unique<nap::audio::ConvolutionNode>(node_manager, 512, tap_count);
+		auto kernel = node_manager.makeSafe<nap::audio::ConvolutionKernel>(*impulse_response, 512);
+		convolution->setKernel(kernel.get());
+		convolution->audioInput.connect(player->audioOutput);
+		player->setBuffer(noise.get());
+		player->play();
+		nap::audio::OutputNode output_node(node_manager);
+		output_node.audioInput.connect(convolution->getOutput(0));
+
+		auto statistics = nap::benchmark::render(service, label + ", partitioned", duration, true);
+		for (const auto& node_time : statistics.mNodeTimes)
+			if (node_time.mNode == convolution.get())
+				printf("    %-56s %12.3f %% of real-time\n", (label + ", partitioned").c_str(), 100.0 * node_time.mCPUTime / duration);
+	}
+}
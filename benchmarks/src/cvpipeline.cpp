@@ -0,0 +1,68 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "benchmark.h"
+
+// External Includes
+#include <cvpipeline.h>
+#include <opencv2/imgproc.hpp>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+// Pushes synthetic 640x480 frames through a convert, blur, threshold and contour pipeline.
+// Compares running all stages on a single pipeline thread against one thread per stage.
+NAP_BENCHMARK(cvPipeline)
+{
+	constexpr int frameCount = 200;
+
+	// Frame with a few bright blobs on a dark background
+	cv::Mat source(480, 640, CV_8UC3, cv::Scalar::all(16));
+	for (int i = 0; i < 8; i++)
+		cv::circle(source, cv::Point(40 + i * 75, 120 + (i % 3) * 120), 30, cv::Scalar::all(240), cv::FILLED);
+	cv::UMat frame;
+	source.copyTo(frame);
+
+	auto run = [&](int threadCount)
+	{
+		nap::CVConvertStage convert;
+		nap::CVBlurStage blur;
+		nap::CVThresholdStage threshold;
+		nap::CVContourStage contour;
+
+		nap::CVPipeline pipeline;
+		pipeline.mID = "pipeline";
+		pipeline.mStages = { &convert, &blur, &threshold, &contour };
+		pipeline.mQueueSize = frameCount;
+		pipeline.mThreadCount = threadCount;
+
+		nap::utility::ErrorState error;
+		if (!blur.init(error) || !pipeline.init(error) || !pipeline.start(error))
+		{
+			printf("    %s\n", error.toString().c_str());
+			return 0.0;
+		}
+
+		nap::uint64 expected = 0;
+		double time = nap::benchmark::measure(5, [&]()
+		{
+			for (int i = 0; i < frameCount; i++)
+				pipeline.push(frame);
+			expected += frameCount;
+			while (pipeline.getProcessedCount() + pipeline.getDroppedCount() < expected)
+				std::this_thread::sleep_for(std::chrono::microseconds(100));
+		}) / frameCount;
+
+		if (pipeline.getDroppedCount() != 0)
+			printf("    dropped frames: %llu\n", static_cast<unsigned long long>(pipeline.getDroppedCount()));
+		pipeline.stop();
+		return time;
+	};
+
+	double single_thread = run(1);
+	double thread_per_stage = run(0);
+	nap::benchmark::report("frame, single pipeline thread", single_thread);
+	nap::benchmark::compare("frame, thread per stage", single_thread, thread_per_stage);
+}
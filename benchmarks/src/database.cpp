@@ -0,0 +1,118 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "benchmark.h"
+
+// External Includes
+#include <database.h>
+#include <databasetable.h>
+#include <rtti/factory.h>
+#include <rtti/object.h>
+#include <chrono>
+#include <cstdio>
+
+/**
+ * Sensor sample, stored as a row in the benchmark table
+ */
+class DatabaseSample : public nap::rtti::Object
+{
+	RTTI_ENABLE(nap::rtti::Object)
+public:
+	double	mTime = 0.0;
+	int		mChannel = 0;
+	float	mValue = 0.0f;
+};
+
+RTTI_BEGIN_CLASS(DatabaseSample)
+	RTTI_PROPERTY("Time",		&DatabaseSample::mTime,		nap::rtti::EPropertyMetaData::Default)
+	RTTI_PROPERTY("Channel",	&DatabaseSample::mChannel,	nap::rtti::EPropertyMetaData::Default)
+	RTTI_PROPERTY("Value",		&DatabaseSample::mValue,	nap::rtti::EPropertyMetaData::Default)
+RTTI_END_CLASS
+
+
+// Writes and reads back 10000 rows. Compares a write per row against the batched writer,
+// and materializing all objects with query() against stepping through them with a cursor.
+NAP_BENCHMARK(databaseRows)
+{
+	constexpr int rowCount = 10000;
+	const std::string path = "benchmark.db";
+	std::remove(path.c_str());
+
+	nap::rtti::Factory factory;
+	nap::utility::ErrorState error;
+	std::unique_ptr<nap::Database> database = std::make_unique<nap::Database>(factory);
+	nap::DatabaseTable* table = nullptr;
+	if (database->init(path, error))
+		table = database->getOrCreateTable("samples", RTTI_OF(DatabaseSample), {}, error);
+	if (table == nullptr)
+	{
+		printf("    %s\n", error.toString().c_str());
+		return;
+	}
+
+	DatabaseSample sample;
+	auto next_sample = [&sample](int row)
+	{
+		sample.mTime = row * 0.01;
+		sample.mChannel = row % 8;
+		sample.mValue = static_cast<float>(row) * 0.5f;
+	};
+
+	// Every row is written in its own transaction
+	double single = nap::benchmark::measure(1, [&]()
+	{
+		table->clear(error);
+		for (int i = 0; i < rowCount; i++)
+		{
+			next_sample(i);
+			table->add(sample, error);
+		}
+	}) / rowCount;
+
+	// Rows are copied on the calling thread and written in a single transaction on flush
+	std::chrono::duration<double, std::micro> calling_thread(0.0);
+	double batched = nap::benchmark::measure(1, [&]()
+	{
+		table->clear(error);
+		auto start = std::chrono::high_resolution_clock::now();
+		for (int i = 0; i < rowCount; i++)
+		{
+			next_sample(i);
+			table->addAsync(sample);
+		}
+		calling_thread += std::chrono::high_resolution_clock::now() - start;
+		database->flush(error);
+	}) / rowCount;
+
+	// Read back
+	double query = nap::benchmark::measure(5, [&]()
+	{
+		std::vector<std::unique_ptr<nap::rtti::Object>> objects;
+		table->query("", objects, error);
+		nap::benchmark::consume(objects.data());
+	}) / rowCount;
+
+	double cursor = nap::benchmark::measure(5, [&]()
+	{
+		std::unique_ptr<nap::DatabaseCursor> rows = table->createCursor("", error);
+		if (rows == nullptr)
+			return;
+		DatabaseSample result;
+		while (rows->next())
+		{
+			rows->read(result);
+			nap::benchmark::consume(&result);
+		}
+	}) / rowCount;
+
+	nap::benchmark::report("write row, add", single);
+	nap::benchmark::compare("write row, addAsync and flush", single, batched);
+	nap::benchmark::compare("write row, addAsync, calling thread only", single, calling_thread.count() / (2 * rowCount));
+	nap::benchmark::report("read row, query", query);
+	nap::benchmark::compare("read row, cursor", query, cursor);
+
+	database.reset();
+	std::remove(path.c_str());
+}
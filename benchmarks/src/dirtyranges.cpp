@@ -0,0 +1,67 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "benchmark.h"
+
+// External Includes
+#include <dirtyranges.h>
+#include <glm/glm.hpp>
+#include <random>
+#include <cstring>
+#include <cstdio>
+
+// Writes 1% of a 100k vertex position buffer per frame, full copy against a copy of only the tracked ranges.
+// The copy is the same memcpy into mapped memory the GPU buffer performs, host memory stands in for the mapped buffer.
+NAP_BENCHMARK(dirtyRangeUpload)
+{
+	constexpr size_t vertexCount = 100000;
+	constexpr size_t changedCount = vertexCount / 100;
+	constexpr size_t elementSize = sizeof(glm::vec3);
+
+	std::vector<glm::vec3> positions(vertexCount, glm::vec3(0.0f));
+	std::vector<glm::vec3> mapped(vertexCount);
+
+	// Changes are clustered, as when a few objects in a batched mesh move
+	std::mt19937 generator(33);
+	std::uniform_int_distribution<size_t> cluster(0, vertexCount - 100);
+	std::vector<size_t> changed;
+	while (changed.size() < changedCount)
+	{
+		size_t first = cluster(generator);
+		for (size_t i = 0; i < 100; i++)
+			changed.emplace_back(first + i);
+	}
+
+	double full = nap::benchmark::measure(1000, [&]()
+	{
+		for (size_t index : changed)
+			positions[index].z += 0.01f;
+		std::memcpy(mapped.data(), positions.data(), vertexCount * elementSize);
+		nap::benchmark::consume(mapped.data());
+	});
+
+	nap::DirtyRanges ranges;
+	size_t uploaded = 0;
+	double partial = nap::benchmark::measure(1000, [&]()
+	{
+		for (size_t index : changed)
+		{
+			positions[index].z += 0.01f;
+			ranges.add(index, 1);
+		}
+		uploaded = 0;
+		for (const nap::BufferRange& range : ranges.getRanges())
+		{
+			std::memcpy(mapped.data() + range.mOffset, positions.data() + range.mOffset, range.mCount * elementSize);
+			uploaded += range.mCount * elementSize;
+		}
+		ranges.clear();
+		nap::benchmark::consume(mapped.data());
+	});
+
+	nap::benchmark::report("update, full upload", full);
+	nap::benchmark::compare("update, dirty ranges", full, partial);
+	printf("    bytes per frame: %zu full, %zu dirty ranges\n", vertexCount * elementSize, uploaded);
+}
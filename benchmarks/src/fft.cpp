@@ -0,0 +1,106 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "benchmark.h"
+#include "benchmarkaudio.h"
+
+// External Includes
+#include <audio/utility/fft.h>
+#include <audio/node/fftnode.h>
+#include <audio/node/bufferplayernode.h>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+
+// Reference: complex radix-2 transform of the full size signal, twiddles computed on every call
+static void referenceFFT(const float* input, std::vector<std::complex<float>>& work)
+{
+	const float pi = 3.14159265358979323846f;
+	const int size = static_cast<int>(work.size());
+	for (int i = 0, j = 0; i < size; i++)
+	{
+		work[j] = input[i];
+		int bit = size >> 1;
+		for (; j & bit; bit >>= 1)
+			j ^= bit;
+		j ^= bit;
+	}
+
+	for (int length = 2; length <= size; length <<= 1)
+	{
+		const float angle = -2.0f * pi / length;
+		for (int start = 0; start < size; start += length)
+		{
+			for (int k = 0; k < length / 2; k++)
+			{
+				std::complex<float> twiddle = std::polar(1.0f, angle * k);
+				std::complex<float> even = work[start + k];
+				std::complex<float> odd = work[start + k + length / 2] * twiddle;
+				work[start + k] = even + odd;
+				work[start + k + length / 2] = even - odd;
+			}
+		}
+	}
+}
+
+
+// Transforms a block of samples with the reference transform and with RealFFT
+NAP_BENCHMARK(fftTransform)
+{
+	std::vector<float> input(4096);
+	for (size_t i = 0; i < input.size(); i++)
+		input[i] = std::sin(static_cast<float>(i) * 0.1f) + 0.25f * std::sin(static_cast<float>(i) * 0.37f);
+
+	for (int size : { 1024, 4096 })
+	{
+		std::vector<std::complex<float>> work(size);
+		double reference = nap::benchmark::measure(1000, [&]()
+		{
+			referenceFFT(input.data(), work);
+			nap::benchmark::consume(work.data());
+		});
+
+		nap::audio::RealFFT fft(size);
+		std::vector<std::complex<float>> bins(fft.getBinCount());
+		double real = nap::benchmark::measure(1000, [&]()
+		{
+			fft.transform(input.data(), bins.data());
+			nap::benchmark::consume(bins.data());
+		});
+
+		nap::benchmark::report(std::to_string(size) + " samples, complex transform", reference);
+		nap::benchmark::compare(std::to_string(size) + " samples, RealFFT", reference, real);
+	}
+}
+
+
+// Analyzes 8 channels of noise with FFT nodes of 1024 samples and a hop of 256, reports the CPU time per channel
+NAP_BENCHMARK(fftNode)
+{
+	constexpr int channelCount = 8;
+	constexpr double duration = 10.0;
+
+	nap::audio::AudioService service(nullptr);
+	auto& node_manager = service.getNodeManager();
+	auto noise = nap::benchmark::createNoise(node_manager, 1, static_cast<int>(nap::benchmark::audioSampleRate * (duration + 1.0)));
+
+	std::vector<std::unique_ptr<nap::audio::BufferPlayerNode>> players;
+	std::vector<std::unique_ptr<nap::audio::FFTNode>> analyzers;
+	for (int i = 0; i < channelCount; i++)
+	{
+		players.emplace_back(std::make_unique<nap::audio::BufferPlayerNode>(node_manager));
+		players.back()->setBuffer(noise.get());
+		players.back()->play(0, i * 1000);
+		analyzers.emplace_back(std::make_unique<nap::audio::FFTNode>(node_manager, 1024, 256));
+		analyzers.back()->input.connect(players.back()->audioOutput);
+	}
+
+	auto statistics = nap::benchmark::render(service, "8 channels", duration, true);
+	double fft_time = 0.0;
+	for (const auto& node_time : statistics.mNodeTimes)
+		if (node_time.mType.find("FFTNode") != std::string::npos)
+			fft_time += node_time.mCPUTime;
+	printf("    %-56s %12.3f %% of real-time\n", "FFTNode, per channel", 100.0 * fft_time / (channelCount * duration));
+}
@@ -0,0 +1,52 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "benchmark.h"
+
+// External Includes
+#include <laserpath.h>
+#include <random>
+#include <cstdio>
+
+// Builds a frame of 200 short paths scattered over the output, with and without travel optimization
+NAP_BENCHMARK(laserPathBuild)
+{
+	constexpr int pathCount = 200;
+	constexpr int vertexCount = 8;
+	std::mt19937 generator(29);
+	std::uniform_real_distribution<float> position(-0.9f, 0.9f);
+	std::uniform_real_distribution<float> offset(-0.05f, 0.05f);
+
+	std::vector<std::vector<glm::vec3>> paths(pathCount);
+	for (auto& path : paths)
+	{
+		glm::vec3 start(position(generator), position(generator), 0.0f);
+		for (int i = 0; i < vertexCount; i++)
+			path.emplace_back(start + glm::vec3(offset(generator), offset(generator), 0.0f));
+	}
+	std::vector<glm::vec4> colors(vertexCount, glm::vec4(1.0f));
+
+	nap::LaserPathBuilder builder;
+	std::vector<nap::EtherDreamPoint> points;
+	auto build = [&](bool optimize)
+	{
+		nap::LaserPathSettings settings;
+		settings.mOptimizeOrder = optimize;
+		builder.clear();
+		for (const auto& path : paths)
+			builder.addPath(path.data(), colors.data(), vertexCount, false, glm::mat4(1.0f));
+		builder.build(settings, 0, false, false, points);
+		nap::benchmark::consume(points.data());
+	};
+
+	double input_order = nap::benchmark::measure(100, [&]() { build(false); });
+	size_t input_points = points.size();
+	double optimized = nap::benchmark::measure(100, [&]() { build(true); });
+	size_t optimized_points = points.size();
+
+	nap::benchmark::report("build, input order", input_order);
+	nap::benchmark::report("build, optimized order", optimized);
+	printf("    points per frame: %zu in input order, %zu optimized\n", input_points, optimized_points);
+}
@@ -0,0 +1,73 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "benchmark.h"
+
+// External Includes
+#include <lineutils.h>
+#include <cmath>
+
+// Samples 1000 positions and normals along a closed line of 2000 vertices, map based lookup against the flat distance table
+NAP_BENCHMARK(lineSampling)
+{
+	constexpr int vertexCount = 2000;
+	constexpr int sampleCount = 1000;
+
+	std::vector<glm::vec3> positions(vertexCount);
+	std::vector<glm::vec3> normals(vertexCount);
+	for (int i = 0; i < vertexCount; i++)
+	{
+		float angle = static_cast<float>(i) / static_cast<float>(vertexCount) * 2.0f * static_cast<float>(nap::math::pi());
+		float radius = 1.0f + 0.25f * std::sin(angle * 7.0f);
+		positions[i] = glm::vec3(std::cos(angle) * radius, std::sin(angle) * radius, 0.0f);
+		normals[i] = glm::normalize(positions[i]);
+	}
+
+	std::vector<float> locations(sampleCount);
+	for (int i = 0; i < sampleCount; i++)
+		locations[i] = static_cast<float>(i) / static_cast<float>(sampleCount - 1);
+
+	std::vector<glm::vec3> out_positions(sampleCount);
+	std::vector<glm::vec3> out_normals(sampleCount);
+
+	// Distance table construction
+	std::map<float, int> distance_map;
+	std::vector<float> distance_table;
+	double build_map = nap::benchmark::measure(200, [&]()
+	{
+		distance_map.clear();
+		nap::math::getDistancesAlongLine(positions, distance_map, true);
+		nap::benchmark::consume(&distance_map);
+	});
+	double build_table = nap::benchmark::measure(200, [&]()
+	{
+		nap::math::getDistancesAlongLine(positions, distance_table, true);
+		nap::benchmark::consume(distance_table.data());
+	});
+	nap::benchmark::report("distances, map", build_map);
+	nap::benchmark::compare("distances, flat table", build_map, build_table);
+
+	// Sampling
+	double sample_map = nap::benchmark::measure(200, [&]()
+	{
+		for (int i = 0; i < sampleCount; i++)
+		{
+			nap::math::getValueAlongLine(distance_map, positions, locations[i], out_positions[i]);
+			nap::math::getNormalAlongLine(distance_map, normals, locations[i], out_normals[i]);
+		}
+		nap::benchmark::consume(out_normals.data());
+	});
+
+	std::vector<nap::math::LineSample> samples(sampleCount);
+	double sample_table = nap::benchmark::measure(200, [&]()
+	{
+		nap::math::getVertexLerpValues(distance_table, vertexCount, locations.data(), sampleCount, samples.data());
+		nap::math::getValuesAlongLine(samples.data(), sampleCount, positions, out_positions.data());
+		nap::math::getNormalsAlongLine(samples.data(), sampleCount, normals, out_normals.data());
+		nap::benchmark::consume(out_normals.data());
+	});
+	nap::benchmark::report("sample positions and normals, map", sample_map);
+	nap::benchmark::compare("sample positions and normals, batched", sample_map, sample_table);
+}
@@ -0,0 +1,87 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "benchmark.h"
+
+// External Includes
+#include <nap/logger.h>
+#include <memory>
+#include <cstdio>
+
+namespace
+{
+	/**
+	 * Writes messages to a file, stops writing when closed because the logger keeps its handlers
+	 */
+	class BenchmarkLogHandler : public nap::LogHandler
+	{
+	public:
+		BenchmarkLogHandler(const std::string& fileName) : mFile(fopen(fileName.c_str(), "w"))	{ }
+		~BenchmarkLogHandler() override																{ close(); }
+
+		void commit(nap::LogMessage message) override
+		{
+			if (mFile != nullptr)
+				fprintf(mFile, "%s\n", formatMessage(message).c_str());
+		}
+
+		void flush() override
+		{
+			if (mFile != nullptr)
+				fflush(mFile);
+		}
+
+		void close()
+		{
+			if (mFile != nullptr)
+				fclose(mFile);
+			mFile = nullptr;
+		}
+
+	private:
+		FILE* mFile = nullptr;
+	};
+}
+
+
+// Logs 10000 formatted messages to a file, the cost on the calling thread of synchronous against asynchronous logging
+NAP_BENCHMARK(logging)
+{
+	constexpr int messageCount = 10000;
+	const std::string fileName = "benchmark.log";
+
+	// Keep the console quiet, the file handler is added afterwards and receives every level
+	nap::Logger::setLevel(nap::Logger::fatalLevel());
+	auto handler = std::make_unique<BenchmarkLogHandler>(fileName);
+	handler->setLogLevel(nap::Logger::fineLevel());
+	BenchmarkLogHandler& file_handler = *handler;
+	nap::Logger::instance().addHandler(std::move(handler));
+
+	int frame = 0;
+	auto log = [&]()
+	{
+		frame++;
+		nap::Logger::info("frame %d, position %.3f, %.3f", frame, frame * 0.5f, frame * 0.25f);
+	};
+	double sync = nap::benchmark::measure(messageCount, log);
+
+	// Large enough to hold every message, the background thread writes them while the caller logs
+	nap::uint64 dropped = nap::Logger::getDroppedMessageCount();
+	nap::Logger::startAsyncLogging(4 * messageCount);
+	double async = nap::benchmark::measure(messageCount, log);
+	auto start = std::chrono::high_resolution_clock::now();
+	nap::Logger::stopAsyncLogging();
+	double drain = std::chrono::duration<double, std::micro>(std::chrono::high_resolution_clock::now() - start).count();
+	dropped = nap::Logger::getDroppedMessageCount() - dropped;
+
+	file_handler.close();
+	nap::Logger::setLevel(nap::Logger::fineLevel());
+	std::remove(fileName.c_str());
+
+	nap::benchmark::report("message, synchronous", sync);
+	nap::benchmark::compare("message, asynchronous", sync, async);
+	nap::benchmark::report("stop asynchronous logging, remaining messages", drain);
+	printf("    dropped messages: %llu\n", static_cast<unsigned long long>(dropped));
+}
@@ -0,0 +1,24 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "benchmark.h"
+
+// External Includes
+#include <cstdio>
+
+/**
+ * Runs all benchmarks, or only the benchmarks whose name contains the first argument.
+ * Build in release mode, timings of a debug build are meaningless.
+ */
+int main(int argc, char* argv[])
+{
+	std::string filter = argc > 1 ? argv[1] : "";
+	if (nap::benchmark::run(filter) == 0)
+	{
+		printf("No benchmark matches: %s\n", filter.c_str());
+		return 1;
+	}
+	return 0;
+}
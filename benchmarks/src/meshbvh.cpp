@@ -0,0 +1,102 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "benchmark.h"
+#include "benchmarkmesh.h"
+
+// External Includes
+#include <meshbvh.h>
+#include <meshutils.h>
+#include <meshconnectivity.h>
+#include <triangleiterator.h>
+#include <renderservice.h>
+#include <renderglobals.h>
+#include <utility/threading.h>
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <limits>
+
+// Casts rays onto a 256x256 grid, brute force against the bounding volume hierarchy, and times the hierarchy build and refit
+NAP_BENCHMARK(meshBVH)
+{
+	constexpr int gridSize = 256;
+	constexpr int bruteForceRayCount = 16;
+	constexpr int rayCount = 4096;
+
+	nap::RenderServiceConfiguration config;
+	nap::RenderService render_service(&config);
+	nap::MeshInstance mesh(render_service);
+	nap::benchmark::createGrid(mesh, gridSize);
+	const auto& positions = mesh.getAttribute<glm::vec3>(nap::vertexid::position);
+
+	// Rays pointing down onto the grid, from random locations above it
+	std::mt19937 generator(32);
+	std::uniform_real_distribution<float> location(0.0f, 1.0f);
+	std::vector<glm::vec3> origins(rayCount);
+	for (auto& origin : origins)
+		origin = glm::vec3(location(generator), location(generator), 1.0f);
+	const glm::vec3 direction(0.0f, 0.0f, -1.0f);
+
+	// Brute force, test every triangle
+	nap::MeshConnectivity connectivity;
+	connectivity.build(mesh);
+	const std::vector<glm::vec3>& vertices = positions.getData();
+	const std::vector<nap::uint32>& indices = connectivity.getIndices();
+	double brute_force = nap::benchmark::measure(2, [&]()
+	{
+		for (int r = 0; r < bruteForceRayCount; r++)
+		{
+			nap::MeshHit closest;
+			closest.mCoordinates.z = std::numeric_limits<float>::max();
+			for (size_t i = 0; i < indices.size(); i += 3)
+			{
+				glm::vec3 coordinates;
+				nap::TriangleData<glm::vec3> triangle(vertices[indices[i]], vertices[indices[i + 1]], vertices[indices[i + 2]]);
+				if (nap::utility::intersect(origins[r], direction, triangle, coordinates) && coordinates.z < closest.mCoordinates.z)
+				{
+					closest.mTriangle = static_cast<int>(i / 3);
+					closest.mCoordinates = coordinates;
+				}
+			}
+			nap::benchmark::consume(&closest);
+		}
+	}) / bruteForceRayCount;
+
+	// Hierarchy
+	nap::MeshBVH bvh;
+	double build = nap::benchmark::measure(5, [&]()
+	{
+		bvh.build(mesh, positions);
+	});
+
+	std::uint32_t thread_count = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+	nap::ThreadPool thread_pool(thread_count);
+	double parallel_build = nap::benchmark::measure(5, [&]()
+	{
+		bvh.build(mesh, positions, &thread_pool);
+	});
+
+	double refit = nap::benchmark::measure(5, [&]()
+	{
+		bvh.refit(positions);
+	});
+
+	double traversal = nap::benchmark::measure(10, [&]()
+	{
+		for (const auto& origin : origins)
+		{
+			nap::MeshHit hit;
+			bvh.intersect(origin, direction, hit);
+			nap::benchmark::consume(&hit);
+		}
+	}) / rayCount;
+
+	nap::benchmark::report("ray, brute force", brute_force);
+	nap::benchmark::compare("ray, bvh", brute_force, traversal);
+	nap::benchmark::report("bvh build", build);
+	nap::benchmark::compare("bvh build, parallel", build, parallel_build);
+	nap::benchmark::compare("bvh refit", build, refit);
+}
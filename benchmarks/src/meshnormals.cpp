@@ -0,0 +1,62 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "benchmark.h"
+#include "benchmarkmesh.h"
+
+// External Includes
+#include <meshutils.h>
+#include <meshconnectivity.h>
+#include <renderservice.h>
+#include <renderglobals.h>
+#include <utility/threading.h>
+#include <thread>
+#include <algorithm>
+
+// Recomputes the normals of a 256x256 wave grid, per call connectivity map against the cached connectivity, serial and parallel
+NAP_BENCHMARK(meshNormals)
+{
+	constexpr int gridSize = 256;
+
+	// The mesh only holds CPU data, it is never initialized on the GPU
+	nap::RenderServiceConfiguration config;
+	nap::RenderService render_service(&config);
+	nap::MeshInstance mesh(render_service);
+	nap::benchmark::createGrid(mesh, gridSize);
+	auto& positions = mesh.getAttribute<glm::vec3>(nap::vertexid::position);
+	auto& normals = mesh.getAttribute<glm::vec3>(nap::vertexid::normal);
+
+	double connectivity_map = nap::benchmark::measure(10, [&]()
+	{
+		nap::utility::computeNormals(mesh, positions, normals);
+		nap::benchmark::consume(normals.getRawData());
+	});
+
+	nap::MeshConnectivity connectivity;
+	double connectivity_build = nap::benchmark::measure(10, [&]()
+	{
+		connectivity.build(mesh);
+		nap::benchmark::consume(connectivity.getTriangles().data());
+	});
+
+	double serial = nap::benchmark::measure(10, [&]()
+	{
+		nap::utility::computeNormals(connectivity, positions, normals);
+		nap::benchmark::consume(normals.getRawData());
+	});
+
+	std::uint32_t thread_count = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+	nap::ThreadPool thread_pool(thread_count);
+	double parallel = nap::benchmark::measure(10, [&]()
+	{
+		nap::utility::computeNormals(connectivity, positions, normals, &thread_pool);
+		nap::benchmark::consume(normals.getRawData());
+	});
+
+	nap::benchmark::report("normals, connectivity map", connectivity_map);
+	nap::benchmark::report("build cached connectivity", connectivity_build);
+	nap::benchmark::compare("normals, cached connectivity", connectivity_map, serial);
+	nap::benchmark::compare("normals, cached connectivity, parallel", connectivity_map, parallel);
+}
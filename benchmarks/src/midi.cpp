@@ -0,0 +1,126 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "benchmark.h"
+
+// External Includes
+#include <midifilterindex.h>
+#include <midiinputcomponent.h>
+#include <entity.h>
+#include <nap/core.h>
+#include <concurrentqueue.h>
+#include <algorithm>
+#include <memory>
+#include <random>
+
+// Shared event set: control changes on random channels and numbers
+static std::vector<nap::MidiEvent> createEvents(int count)
+{
+	std::mt19937 generator(35);
+	std::uniform_int_distribution<int> channel(0, 15);
+	std::uniform_int_distribution<int> value(0, nap::MidiEvent::MIDI_MAX_VALUE);
+	std::vector<nap::MidiEvent> events;
+	events.reserve(count);
+	for (int i = 0; i < count; i++)
+		events.emplace_back(nap::MidiEvent::Type::controlChange, value(generator), value(generator), channel(generator));
+	return events;
+}
+
+
+// Moves 1000 events through the input queue, heap allocated events against events queued by value in a preallocated queue
+NAP_BENCHMARK(midiEventQueue)
+{
+	constexpr int eventCount = 1000;
+	std::vector<nap::MidiEvent> events = createEvents(eventCount);
+
+	moodycamel::ConcurrentQueue<std::unique_ptr<nap::MidiEvent>> pointer_queue;
+	double pointers = nap::benchmark::measure(1000, [&]()
+	{
+		for (const auto& event : events)
+			pointer_queue.enqueue(std::make_unique<nap::MidiEvent>(event));
+		std::unique_ptr<nap::MidiEvent> event;
+		while (pointer_queue.try_dequeue(event))
+			nap::benchmark::consume(event.get());
+	});
+
+	moodycamel::ConcurrentQueue<nap::MidiEvent> value_queue(eventCount);
+	std::vector<nap::MidiEvent> drained(eventCount);
+	double values = nap::benchmark::measure(1000, [&]()
+	{
+		for (const auto& event : events)
+			value_queue.enqueue(nap::MidiEvent(event));
+		size_t count = 0;
+		while ((count = value_queue.try_dequeue_bulk(drained.begin(), drained.size())) > 0)
+			nap::benchmark::consume(drained.data());
+	});
+
+	nap::benchmark::report("1000 events, heap allocated", pointers);
+	nap::benchmark::compare("1000 events, by value, bulk dequeue", pointers, values);
+}
+
+
+// Dispatches 1000 events to 512 components that each listen to a single channel and number,
+// testing the filters of every component against finding the components in the filter index
+NAP_BENCHMARK(midiDispatch)
+{
+	constexpr int componentCount = 512;
+	std::vector<nap::MidiEvent> events = createEvents(1000);
+
+	// Components are never initialized, the filters are set directly
+	nap::Core core;
+	nap::EntityInstance entity(core, nullptr);
+	nap::MidiInputComponent resource;
+	std::vector<std::unique_ptr<nap::MidiInputComponentInstance>> components;
+	nap::MidiFilterIndex index;
+	std::mt19937 generator(35);
+	std::uniform_int_distribution<int> channel(0, 15);
+	std::uniform_int_distribution<int> number(0, nap::MidiEvent::MIDI_MAX_VALUE);
+	for (int i = 0; i < componentCount; i++)
+	{
+		components.emplace_back(std::make_unique<nap::MidiInputComponentInstance>(entity, resource));
+		components.back()->mChannels = { static_cast<nap::MidiValue>(channel(generator)) };
+		components.back()->mNumbers = { static_cast<nap::MidiValue>(number(generator)) };
+		index.add(*components.back());
+	}
+
+	// The filter test the service performed for every component
+	std::vector<nap::MidiInputComponentInstance*> matches;
+	double linear = nap::benchmark::measure(100, [&]()
+	{
+		for (const auto& event : events)
+		{
+			matches.clear();
+			for (const auto& component : components)
+			{
+				if (!component->mPorts.empty())
+					if (std::find(component->mPorts.begin(), component->mPorts.end(), event.getPort()) == component->mPorts.end())
+						continue;
+				if (!component->mTypes.empty())
+					if (std::find(component->mTypes.begin(), component->mTypes.end(), event.getType()) == component->mTypes.end())
+						continue;
+				if (!component->mChannels.empty())
+					if (std::find(component->mChannels.begin(), component->mChannels.end(), event.getChannel()) == component->mChannels.end())
+						continue;
+				if (!component->mNumbers.empty())
+					if (std::find(component->mNumbers.begin(), component->mNumbers.end(), event.getNumber()) == component->mNumbers.end())
+						continue;
+				matches.emplace_back(component.get());
+			}
+			nap::benchmark::consume(matches.data());
+		}
+	});
+
+	double indexed = nap::benchmark::measure(100, [&]()
+	{
+		for (const auto& event : events)
+		{
+			index.find(event, matches);
+			nap::benchmark::consume(matches.data());
+		}
+	});
+
+	nap::benchmark::report("1000 events, filter every component", linear);
+	nap::benchmark::compare("1000 events, filter index", linear, indexed);
+}
@@ -0,0 +1,70 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "benchmark.h"
+
+// External Includes
+#include <document.h>
+#include <rtti/rttiutilities.h>
+#include <nap/core.h>
+
+// Looks up 100 entities of a chain of nested entities by name and finds the pointers to them.
+// Compares scanning all objects, as the document did before, against the name and reference index.
+NAP_BENCHMARK(napkinDocument)
+{
+	constexpr int queryCount = 100;
+	nap::Core core;
+	for (int count : { 500, 2000, 8000 })
+	{
+		// Every entity is a child of the previous entity
+		napkin::Document document(core);
+		std::vector<nap::Entity*> entities;
+		for (int i = 0; i < count; i++)
+			entities.emplace_back(document.addObject<nap::Entity>(entities.empty() ? nullptr : entities.back(), std::string(), false));
+		std::vector<nap::Entity*> queries;
+		for (int i = 0; i < queryCount; i++)
+			queries.emplace_back(entities[i * count / queryCount]);
+
+		// Scan all objects for the name and all links for the pointer
+		double scan = nap::benchmark::measure(1, [&]()
+		{
+			std::vector<nap::rtti::ObjectLink> links;
+			for (const auto* entity : queries)
+			{
+				const nap::rtti::Object* found = nullptr;
+				for (const auto& object : document.getObjects())
+				{
+					if (object->mID == entity->mID)
+					{
+						found = object.get();
+						break;
+					}
+				}
+
+				int pointers = 0;
+				for (const auto& object : document.getObjects())
+				{
+					nap::rtti::findObjectLinks(*object, links);
+					for (const auto& link : links)
+						pointers += link.mTarget == found ? 1 : 0;
+				}
+				nap::benchmark::consume(&pointers);
+			}
+		}) / queryCount;
+
+		double indexed = nap::benchmark::measure(1, [&]()
+		{
+			for (const auto* entity : queries)
+			{
+				nap::rtti::Object* found = document.getObject(entity->mID);
+				auto pointers = document.getPointersTo(*found, false, false);
+				nap::benchmark::consume(&pointers);
+			}
+		}) / queryCount;
+
+		nap::benchmark::report(std::to_string(count) + " entities, scan", scan);
+		nap::benchmark::compare(std::to_string(count) + " entities, index", scan, indexed);
+	}
+}
@@ -0,0 +1,66 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "benchmark.h"
+#include "benchmarkaudio.h"
+
+// External Includes
+#include <audio/node/bufferplayernode.h>
+#include <audio/node/filternode.h>
+#include <audio/node/gainnode.h>
+#include <audio/node/mixnode.h>
+#include <audio/node/outputnode.h>
+#include <cstdio>
+#include <memory>
+
+// Renders 10 seconds of 32 filtered noise players mixed to stereo, without and with per node profiling
+NAP_BENCHMARK(audioOfflineRender)
+{
+	constexpr int voiceCount = 32;
+	constexpr double duration = 10.0;
+
+	nap::audio::AudioService service(nullptr);
+	auto& node_manager = service.getNodeManager();
+	auto noise = nap::benchmark::createNoise(node_manager, 1, static_cast<int>(nap::benchmark::audioSampleRate * (duration + 1.0)));
+
+	nap::audio::MixNode mix_left(node_manager);
+	nap::audio::MixNode mix_right(node_manager);
+	nap::audio::OutputNode output_left(node_manager);
+	nap::audio::OutputNode output_right(node_manager);
+	output_left.setOutputChannel(0);
+	output_right.setOutputChannel(1);
+	output_left.audioInput.connect(mix_left.audioOutput);
+	output_right.audioInput.connect(mix_right.audioOutput);
+
+	std::vector<std::unique_ptr<nap::audio::BufferPlayerNode>> players;
+	std::vector<std::unique_ptr<nap::audio::FilterNode>> filters;
+	std::vector<std::unique_ptr<nap::audio::GainNode>> gains;
+	for (int i = 0; i < voiceCount; i++)
+	{
+		players.emplace_back(std::make_unique<nap::audio::BufferPlayerNode>(node_manager));
+		filters.emplace_back(std::make_unique<nap::audio::FilterNode>(node_manager));
+		gains.emplace_back(std::make_unique<nap::audio::GainNode>(node_manager, 1.0f / voiceCount));
+		players.back()->setBuffer(noise.get());
+		filters.back()->setMode(nap::audio::FilterNode::EMode::BandPass);
+		filters.back()->setFrequency(200.0f * (i + 1));
+		filters.back()->audioInput.connect(players.back()->audioOutput);
+		gains.back()->audioInput.connect(filters.back()->audioOutput);
+		(i % 2 == 0 ? mix_left : mix_right).inputs.connect(gains.back()->audioOutput);
+	}
+
+	// Every render starts playback from the start of the noise
+	auto play = [&]()
+	{
+		for (int i = 0; i < voiceCount; i++)
+			players[i]->play(0, i * 1000);
+	};
+
+	play();
+	nap::benchmark::render(service, "32 voices", duration, false);
+	play();
+	auto statistics = nap::benchmark::render(service, "32 voices, profiling", duration, true);
+	for (size_t i = 0; i < statistics.mNodeTimes.size() && i < 3; i++)
+		printf("    %-56s %12.3f ms\n", statistics.mNodeTimes[i].mType.c_str(), statistics.mNodeTimes[i].mCPUTime * 1000.0);
+}
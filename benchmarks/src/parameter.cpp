@@ -0,0 +1,103 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "benchmark.h"
+
+// External Includes
+#include <parameternumeric.h>
+#include <atomic>
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// A player thread updates 256 float parameters as fast as it can while the main thread applies them once per frame.
+// Compares a mutex guarded value per parameter, as the sequencer curve adapter used before, against staged values.
+// Parameters are committed directly, the parameter service requires loaded resources.
+NAP_BENCHMARK(parameterStaging)
+{
+	constexpr int parameterCount = 256;
+	constexpr int frameCount = 1000;
+
+	std::vector<nap::ParameterFloat> parameters(parameterCount);
+	int changes = 0;
+	std::vector<std::unique_ptr<nap::Slot<float>>> slots;
+	for (auto& parameter : parameters)
+	{
+		parameter.setRange(0.0f, 1.0f);
+		slots.emplace_back(std::make_unique<nap::Slot<float>>([&changes](float) { changes++; }));
+		parameter.valueChanged.connect(*slots.back());
+	}
+
+	// Runs the player thread while the main thread applies the values, returns the main thread time per frame
+	auto run = [&](const std::function<void(int, float)>& tick, const std::function<void()>& frame, nap::uint64& outTicks)
+	{
+		std::atomic<bool> running = { true };
+		std::atomic<nap::uint64> ticks = { 0 };
+		std::thread player([&]()
+		{
+			float value = 0.0f;
+			while (running.load())
+			{
+				value = value > 1.0f ? 0.0f : value + 0.001f;
+				for (int i = 0; i < parameterCount; i++)
+					tick(i, value);
+				ticks++;
+			}
+		});
+
+		double time = nap::benchmark::measure(frameCount, [&]()
+		{
+			frame();
+			std::this_thread::yield();
+		});
+		running = false;
+		player.join();
+		outTicks = ticks.load() / (frameCount + 1);
+		return time;
+	};
+
+	// Previous hand-off, a lock per parameter on every tick and on every frame
+	struct LockedValue
+	{
+		std::mutex	mMutex;
+		float		mValue = 0.0f;
+		bool		mChanged = false;
+	};
+	std::vector<LockedValue> locked_values(parameterCount);
+	nap::uint64 locked_ticks = 0;
+	double locked = run([&](int index, float value)
+	{
+		std::lock_guard<std::mutex> lock(locked_values[index].mMutex);
+		locked_values[index].mValue = value;
+		locked_values[index].mChanged = true;
+	},
+	[&]()
+	{
+		for (int i = 0; i < parameterCount; i++)
+		{
+			std::lock_guard<std::mutex> lock(locked_values[i].mMutex);
+			if (locked_values[i].mChanged)
+				parameters[i].setValue(locked_values[i].mValue);
+			locked_values[i].mChanged = false;
+		}
+	}, locked_ticks);
+
+	nap::uint64 staged_ticks = 0;
+	double staged = run([&](int index, float value)
+	{
+		parameters[index].stageValue(value);
+	},
+	[&]()
+	{
+		for (auto& parameter : parameters)
+			parameter.commitStagedValue();
+	}, staged_ticks);
+
+	nap::benchmark::report("main thread frame, mutex per parameter", locked);
+	nap::benchmark::compare("main thread frame, staged values", locked, staged);
+	printf("    player ticks per frame: %llu mutex, %llu staged\n", static_cast<unsigned long long>(locked_ticks), static_cast<unsigned long long>(staged_ticks));
+	nap::benchmark::consume(&changes);
+}
@@ -0,0 +1,120 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "benchmark.h"
+
+// External Includes
+#include <mathutils.h>
+#include <randomgenerator.h>
+#include <random>
+#include <mutex>
+#include <thread>
+#include <algorithm>
+#include <functional>
+
+// Generates a million floats, a shared mt19937 with a distribution per call against the thread generator, per call and in bulk
+NAP_BENCHMARK(randomFloats)
+{
+	constexpr int count = 1000000;
+	std::vector<float> output(count);
+
+	std::mt19937 mersenne(47);
+	double distribution = nap::benchmark::measure(5, [&]()
+	{
+		for (auto& value : output)
+		{
+			std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+			value = dist(mersenne);
+		}
+		nap::benchmark::consume(output.data());
+	});
+
+	double random = nap::benchmark::measure(5, [&]()
+	{
+		for (auto& value : output)
+			value = nap::math::random<float>(0.0f, 1.0f);
+		nap::benchmark::consume(output.data());
+	});
+
+	nap::math::RandomGenerator& generator = nap::math::getRandomGenerator();
+	double uniform = nap::benchmark::measure(5, [&]()
+	{
+		for (auto& value : output)
+			value = generator.uniform(0.0f, 1.0f);
+		nap::benchmark::consume(output.data());
+	});
+
+	double fill = nap::benchmark::measure(5, [&]()
+	{
+		generator.fill(output.data(), count);
+		nap::benchmark::consume(output.data());
+	});
+
+	std::vector<glm::vec3> points(count);
+	double points_uniform = nap::benchmark::measure(5, [&]()
+	{
+		for (auto& point : points)
+			point = generator.uniform(glm::vec3(-1.0f), glm::vec3(1.0f));
+		nap::benchmark::consume(points.data());
+	});
+
+	double points_fill = nap::benchmark::measure(5, [&]()
+	{
+		generator.fill(points.data(), count, glm::vec3(-1.0f), glm::vec3(1.0f));
+		nap::benchmark::consume(points.data());
+	});
+
+	nap::benchmark::report("1M floats, mt19937, distribution per call", distribution);
+	nap::benchmark::compare("1M floats, math::random", distribution, random);
+	nap::benchmark::compare("1M floats, generator uniform", distribution, uniform);
+	nap::benchmark::compare("1M floats, generator fill", distribution, fill);
+	nap::benchmark::report("1M vec3, generator uniform", points_uniform);
+	nap::benchmark::compare("1M vec3, generator fill", points_uniform, points_fill);
+}
+
+
+// Generates floats on all threads at once, a shared mt19937 behind a mutex against math::random on the thread generators
+NAP_BENCHMARK(randomThreads)
+{
+	constexpr int count = 100000;
+	int thread_count = std::max<int>(std::thread::hardware_concurrency(), 2);
+
+	auto run = [&](const std::function<float()>& next)
+	{
+		std::vector<std::thread> threads;
+		std::vector<float> sums(thread_count, 0.0f);
+		for (int t = 0; t < thread_count; t++)
+		{
+			threads.emplace_back([&, t]()
+			{
+				for (int i = 0; i < count; i++)
+					sums[t] += next();
+			});
+		}
+		for (auto& thread : threads)
+			thread.join();
+		nap::benchmark::consume(sums.data());
+	};
+
+	std::mt19937 mersenne(47);
+	std::mutex mutex;
+	double locked = nap::benchmark::measure(3, [&]()
+	{
+		run([&]()
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+			return dist(mersenne);
+		});
+	});
+
+	double thread_local_generator = nap::benchmark::measure(3, [&]()
+	{
+		run([]() { return nap::math::random<float>(0.0f, 1.0f); });
+	});
+
+	nap::benchmark::report("100k floats per thread, mt19937 behind mutex", locked);
+	nap::benchmark::compare("100k floats per thread, math::random", locked, thread_local_generator);
+}
@@ -0,0 +1,168 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "benchmark.h"
+
+// External Includes
+#include <nap/signalslot.h>
+#include <nap/queuedsignal.h>
+#include <functional>
+#include <algorithm>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+#include <cstdio>
+
+namespace
+{
+	// Receives the signals, counts the calls so that they can't be optimized away
+	struct Receiver
+	{
+		void onValue(int value)		{ mSum += value; }
+		int mSum = 0;
+	};
+}
+
+
+// Triggers a signal with 8 member function connections, std::bind in std::function against the inline signal
+NAP_BENCHMARK(signalTrigger)
+{
+	constexpr int connectionCount = 8;
+	constexpr int triggerCount = 100000;
+	std::vector<Receiver> receivers(connectionCount);
+
+	std::vector<std::function<void(int)>> functions;
+	for (auto& receiver : receivers)
+		functions.emplace_back(std::bind(&Receiver::onValue, &receiver, std::placeholders::_1));
+	double bound = nap::benchmark::measure(10, [&]()
+	{
+		for (int i = 0; i < triggerCount; i++)
+			for (auto& function : functions)
+				function(i);
+		nap::benchmark::consume(receivers.data());
+	});
+
+	nap::Signal<int> signal;
+	for (auto& receiver : receivers)
+		signal.connect(&receiver, &Receiver::onValue);
+	double inline_signal = nap::benchmark::measure(10, [&]()
+	{
+		for (int i = 0; i < triggerCount; i++)
+			signal.trigger(i);
+		nap::benchmark::consume(receivers.data());
+	});
+
+	nap::benchmark::report("100k triggers, 8 bound std::functions", bound);
+	nap::benchmark::compare("100k triggers, 8 signal connections", bound, inline_signal);
+}
+
+
+// Connects 2000 functions, then disconnects them in random order: list search against connection handles
+NAP_BENCHMARK(signalDisconnect)
+{
+	constexpr int connectionCount = 2000;
+	Receiver receiver;
+	std::vector<int> order(connectionCount);
+	for (int i = 0; i < connectionCount; i++)
+		order[i] = (i * 7919) % connectionCount;
+
+	double search = nap::benchmark::measure(10, [&]()
+	{
+		std::vector<std::pair<int, std::function<void(int)>>> functions;
+		for (int i = 0; i < connectionCount; i++)
+			functions.emplace_back(i, [&receiver](int value) { receiver.onValue(value); });
+		for (int id : order)
+			functions.erase(std::find_if(functions.begin(), functions.end(), [id](const auto& entry) { return entry.first == id; }));
+		nap::benchmark::consume(functions.data());
+	});
+
+	double handles = nap::benchmark::measure(10, [&]()
+	{
+		nap::Signal<int> signal;
+		std::vector<nap::SignalConnection> connections;
+		for (int i = 0; i < connectionCount; i++)
+			connections.emplace_back(signal.connect([&receiver](int value) { receiver.onValue(value); }));
+		for (int id : order)
+			signal.disconnect(connections[id]);
+		nap::benchmark::consume(connections.data());
+	});
+
+	nap::benchmark::report("2000 connects and disconnects, search", search);
+	nap::benchmark::compare("2000 connects and disconnects, handles", search, handles);
+}
+
+
+// Triggers from 4 threads and dispatches on the main thread, a locked std::queue against the queued signal
+NAP_BENCHMARK(signalQueued)
+{
+	constexpr int threadCount = 4;
+	constexpr int triggerCount = 10000;
+	Receiver receiver;
+
+	// Triggers from all threads while the main thread keeps dispatching until every trigger is handled
+	auto run = [&](const std::function<void(int)>& trigger, const std::function<int()>& dispatch)
+	{
+		std::vector<std::thread> threads;
+		for (int t = 0; t < threadCount; t++)
+		{
+			threads.emplace_back([&]()
+			{
+				for (int i = 0; i < triggerCount; i++)
+					trigger(i);
+			});
+		}
+
+		int handled = 0;
+		while (handled < threadCount * triggerCount)
+			handled += dispatch();
+		for (auto& thread : threads)
+			thread.join();
+		nap::benchmark::consume(&receiver);
+	};
+
+	std::mutex mutex;
+	std::queue<int> queue;
+	double locked = nap::benchmark::measure(10, [&]()
+	{
+		run([&](int value)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			queue.push(value);
+		}, [&]()
+		{
+			std::queue<int> pending;
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				std::swap(pending, queue);
+			}
+			int count = static_cast<int>(pending.size());
+			for (; !pending.empty(); pending.pop())
+				receiver.onValue(pending.front());
+			return count;
+		});
+	});
+
+	// Dropped triggers count as handled, the queue is large enough to rarely drop any
+	nap::QueuedSignal<int> queued_signal(2 * threadCount * triggerCount);
+	int dispatched = 0;
+	std::uint64_t dropped = 0;
+	queued_signal.connect([&](int value) { receiver.onValue(value); dispatched++; });
+	double queued = nap::benchmark::measure(10, [&]()
+	{
+		run([&](int value) { queued_signal.trigger(value); }, [&]()
+		{
+			dispatched = 0;
+			queued_signal.dispatch();
+			std::uint64_t new_dropped = queued_signal.getDroppedCount() - dropped;
+			dropped += new_dropped;
+			return dispatched + static_cast<int>(new_dropped);
+		});
+	});
+
+	nap::benchmark::report("4 threads x 10k triggers, locked queue", locked);
+	nap::benchmark::compare("4 threads x 10k triggers, queued signal", locked, queued);
+	printf("    dropped triggers: %llu\n", static_cast<unsigned long long>(dropped));
+}
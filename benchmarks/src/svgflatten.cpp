@@ -0,0 +1,67 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "benchmark.h"
+
+// External Includes
+#include <linefromfile.h>
+#include <utility/fileutils.h>
+#include <fstream>
+#include <random>
+#include <cstdio>
+
+// Writes an svg file of closed paths, every path consists of 8 random cubic curves
+static void writeSVG(const std::string& file, int pathCount)
+{
+	std::mt19937 generator(46);
+	std::uniform_real_distribution<float> position(0.0f, 1000.0f);
+	std::uniform_real_distribution<float> offset(-40.0f, 40.0f);
+
+	std::ofstream stream(file);
+	stream << "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"1000\" height=\"1000\">\n";
+	for (int i = 0; i < pathCount; i++)
+	{
+		float x = position(generator);
+		float y = position(generator);
+		stream << "<path fill=\"none\" stroke=\"#000\" d=\"M" << x << "," << y;
+		for (int c = 0; c < 8; c++)
+		{
+			stream << " C" << x + offset(generator) << "," << y + offset(generator) << " "
+				<< x + offset(generator) << "," << y + offset(generator) << " "
+				<< x + offset(generator) << "," << y + offset(generator);
+		}
+		stream << " Z\"/>\n";
+	}
+	stream << "</svg>\n";
+}
+
+
+// Parses and flattens a small and a large file at decreasing tolerances, the large file is flattened in parallel
+NAP_BENCHMARK(svgFlatten)
+{
+	const std::vector<std::pair<std::string, int>> files = { { "benchmark_small.svg", 32 }, { "benchmark_large.svg", 4096 } };
+	for (const auto& file : files)
+	{
+		writeSVG(file.first, file.second);
+		for (float tolerance : { 1.0f, 0.25f, 0.05f })
+		{
+			nap::utility::ErrorState error;
+			nap::LineFromFile::SVGPaths paths;
+			double load = nap::benchmark::measure(5, [&]()
+			{
+				paths = nap::LineFromFile::SVGPaths();
+				if (!nap::LineFromFile::loadPaths(file.first, nap::ESVGUnits::PX, 96.0f, tolerance, 0.0f, paths, error))
+					printf("    %s\n", error.toString().c_str());
+				nap::benchmark::consume(paths.mVertices.data());
+			});
+
+			char label[64];
+			snprintf(label, sizeof(label), "%d paths, tolerance %.2f", file.second, tolerance);
+			nap::benchmark::report(label, load);
+			printf("    vertices: %zu, per path: %.3f us\n", paths.mVertices.size(), load / file.second);
+		}
+		nap::utility::deleteFile(file.first);
+	}
+}
@@ -0,0 +1,88 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "benchmark.h"
+#include "benchmarkaudio.h"
+
+// External Includes
+#include <audio/node/voicepoolnode.h>
+#include <audio/node/bufferplayernode.h>
+#include <audio/node/gainnode.h>
+#include <audio/node/stereopannernode.h>
+#include <audio/node/mixnode.h>
+#include <audio/node/outputnode.h>
+#include <cstdio>
+
+// Plays 64 voices of noise, a chain of player, gain and panner nodes per voice against the voice pool node.
+// Reports the cost of starting a voice on the calling thread and the real-time factor of rendering all voices.
+NAP_BENCHMARK(audioVoicePool)
+{
+	constexpr int voiceCount = 64;
+	constexpr double duration = 5.0;
+
+	nap::audio::AudioService service(nullptr);
+	auto& node_manager = service.getNodeManager();
+	auto noise = nap::benchmark::createNoise(node_manager, 1, static_cast<int>(nap::benchmark::audioSampleRate * (duration + 1.0)));
+
+	nap::audio::MixNode mix_left(node_manager);
+	nap::audio::MixNode mix_right(node_manager);
+	nap::audio::OutputNode output_left(node_manager);
+	nap::audio::OutputNode output_right(node_manager);
+	output_left.setOutputChannel(0);
+	output_right.setOutputChannel(1);
+	output_left.audioInput.connect(mix_left.audioOutput);
+	output_right.audioInput.connect(mix_right.audioOutput);
+
+	// A chain of nodes for every voice
+	struct VoiceChain
+	{
+		nap::audio::SafeOwner<nap::audio::BufferPlayerNode> mPlayer;
+		nap::audio::SafeOwner<nap::audio::GainNode> mGain;
+		nap::audio::SafeOwner<nap::audio::StereoPannerNode> mPanner;
+	};
+	std::vector<VoiceChain> chains;
+	double chain_start = nap::benchmark::measure(voiceCount - 1, [&]()
+	{
+		VoiceChain chain;
+		chain.mPlayer = node_manager.makeSafe<nap::audio::BufferPlayerNode>(node_manager);
+		chain.mGain = node_manager.makeSafe<nap::audio::GainNode>(node_manager, 1.0f / voiceCount);
+		chain.mPanner = node_manager.makeSafe<nap::audio::StereoPannerNode>(node_manager);
+		chain.mPlayer->setBuffer(noise.get());
+		chain.mGain->audioInput.connect(chain.mPlayer->audioOutput);
+		chain.mPanner->leftInput.connect(chain.mGain->audioOutput);
+		chain.mPanner->rightInput.connect(chain.mGain->audioOutput);
+		chain.mPanner->setPanning(static_cast<float>(chains.size()) / voiceCount);
+		mix_left.inputs.connect(chain.mPanner->leftOutput);
+		mix_right.inputs.connect(chain.mPanner->rightOutput);
+		chain.mPlayer->play(0, chains.size() * 1000);
+		chains.emplace_back(std::move(chain));
+	});
+	nap::benchmark::render(service, "64 voices, node chain per voice", duration, false);
+
+	// Remove the chains from the mix
+	mix_left.inputs.disconnectAll();
+	mix_right.inputs.disconnectAll();
+	chains.clear();
+
+	// Voice pool
+	nap::audio::VoicePoolNode pool(node_manager, voiceCount);
+	mix_left.inputs.connect(pool.leftOutput);
+	mix_right.inputs.connect(pool.rightOutput);
+	int started = 0;
+	double pool_start = nap::benchmark::measure(voiceCount - 1, [&]()
+	{
+		nap::audio::VoiceSettings settings;
+		settings.mGain = 1.0f / voiceCount;
+		settings.mPanning = static_cast<float>(started) / voiceCount;
+		settings.mStartPosition = started * 1000.0f / nap::benchmark::audioSampleRate * 1000.0f;
+		pool.play(noise.get(), nap::benchmark::audioSampleRate, settings);
+		started++;
+	});
+	nap::benchmark::render(service, "64 voices, voice pool", duration, false);
+
+	nap::benchmark::report("start voice, node chain", chain_start);
+	nap::benchmark::compare("start voice, voice pool", chain_start, pool_start);
+	printf("    voice pool stolen: %llu, dropped: %llu\n", static_cast<unsigned long long>(pool.getStolenVoiceCount()), static_cast<unsigned long long>(pool.getDroppedVoiceCount()));
+}
@@ -0,0 +1,188 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "benchmark.h"
+
+// External Includes
+#include <websocketserver.h>
+#include <websocketserverendpoint.h>
+#include <websocketclient.h>
+#include <websocketclientendpoint.h>
+#include <websocketservice.h>
+#include <atomic>
+#include <functional>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+	/**
+	 * Server that only remembers the open client connections
+	 */
+	class ConnectionServer : public nap::IWebSocketServer
+	{
+	public:
+		ConnectionServer(nap::WebSocketService& service) : nap::IWebSocketServer(service) { }
+
+		virtual bool init(nap::utility::ErrorState& errorState) override
+		{
+			if (!nap::IWebSocketServer::init(errorState))
+				return false;
+			mEndPoint->registerListener(*this);
+			return true;
+		}
+
+		virtual void onDestroy() override { mEndPoint->unregisterListener(*this); }
+
+		virtual void onMessageReceived(const nap::WebSocketConnection& connection, const nap::WebSocketMessage& message) override { }
+		virtual void onConnectionClosed(const nap::WebSocketConnection& connection, int code, const std::string& reason) override { }
+		virtual void onConnectionFailed(const nap::WebSocketConnection& connection, int code, const std::string& reason) override { }
+		virtual void onConnectionOpened(const nap::WebSocketConnection& connection) override
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mConnections.emplace_back(connection);
+		}
+
+		std::mutex mMutex;
+		std::vector<nap::WebSocketConnection> mConnections;
+	};
+
+
+	/**
+	 * Client that counts the messages it receives, shared by all clients
+	 */
+	class CountingClient : public nap::IWebSocketClient
+	{
+	public:
+		CountingClient(nap::WebSocketService& service, std::atomic<int>& counter) : nap::IWebSocketClient(service), mCounter(counter) { }
+
+		virtual void onConnectionOpened() override { }
+		virtual void onConnectionClosed(int code, const std::string& reason) override { }
+		virtual void onConnectionFailed(int code, const std::string& reason) override { }
+		virtual void onMessageReceived(const nap::WebSocketMessage& msg) override { mCounter++; }
+
+		std::atomic<int>& mCounter;
+	};
+
+
+	// Waits until the counter reaches the given value, returns false on time-out
+	bool waitFor(const std::atomic<int>& counter, int value)
+	{
+		auto start = std::chrono::steady_clock::now();
+		while (counter.load() < value)
+		{
+			if (std::chrono::steady_clock::now() - start > std::chrono::seconds(10))
+				return false;
+			std::this_thread::yield();
+		}
+		return true;
+	}
+}
+
+
+// Sends 4KB messages to 32 clients on the local host, one send per client against a single broadcast.
+// Reports the time spent on the calling thread and the time until every client received the message.
+NAP_BENCHMARK(webSocketBroadcast)
+{
+	constexpr int clientCount = 32;
+	constexpr int messageCount = 100;
+
+	// The service is never initialized, it only collects the interfaces
+	nap::WebSocketService service(nullptr);
+
+	nap::WebSocketServerEndPoint server_end_point;
+	server_end_point.mID = "ServerEndPoint";
+	server_end_point.mPort = 9036;
+	server_end_point.mIPAddress = "127.0.0.1";
+	server_end_point.mLogConnectionUpdates = false;
+
+	ConnectionServer server(service);
+	server.mID = "Server";
+	server.mEndPoint = &server_end_point;
+
+	nap::WebSocketClientEndPoint client_end_point;
+	client_end_point.mID = "ClientEndPoint";
+	client_end_point.mLogConnectionUpdates = false;
+
+	std::atomic<int> received = { 0 };
+	std::vector<std::unique_ptr<CountingClient>> clients;
+	for (int i = 0; i < clientCount; i++)
+	{
+		clients.emplace_back(std::make_unique<CountingClient>(service, received));
+		clients.back()->mID = "Client" + std::to_string(i);
+		clients.back()->mEndPoint = &client_end_point;
+		clients.back()->mURI = "ws://127.0.0.1:9036";
+	}
+
+	nap::utility::ErrorState error;
+	bool started = server_end_point.init(error) && server.init(error) && server_end_point.start(error) && client_end_point.init(error);
+	for (auto& client : clients)
+		started = started && client->init(error);
+	started = started && client_end_point.start(error);
+	if (!started)
+	{
+		printf("    %s\n", error.toString().c_str());
+		return;
+	}
+
+	// Wait for all clients to connect
+	auto connect_start = std::chrono::steady_clock::now();
+	while (server_end_point.getConnectionCount() < clientCount && std::chrono::steady_clock::now() - connect_start < std::chrono::seconds(10))
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+	std::vector<nap::WebSocketConnection> connections;
+	{
+		std::lock_guard<std::mutex> lock(server.mMutex);
+		connections = server.mConnections;
+	}
+
+	const std::string message(4096, 'x');
+	auto run = [&](const std::function<void()>& send, double& outCaller)
+	{
+		std::chrono::duration<double, std::micro> caller(0.0);
+		int expected = received.load();
+		double delivery = nap::benchmark::measure(5, [&]()
+		{
+			expected += messageCount * static_cast<int>(connections.size());
+			auto start = std::chrono::high_resolution_clock::now();
+			for (int i = 0; i < messageCount; i++)
+				send();
+			caller += std::chrono::high_resolution_clock::now() - start;
+			if (!waitFor(received, expected))
+				printf("    time-out, not all messages arrived\n");
+		}) / messageCount;
+
+		// The warm-up iteration is included in the caller time
+		outCaller = caller.count() / (6 * messageCount);
+		return delivery;
+	};
+
+	double per_client_caller = 0.0;
+	double per_client = run([&]()
+	{
+		for (const auto& connection : connections)
+			server_end_point.send(connection, message, nap::EWebSocketOPCode::Text, error);
+	}, per_client_caller);
+
+	double broadcast_caller = 0.0;
+	double broadcast = run([&]()
+	{
+		server_end_point.broadcast(message, nap::EWebSocketOPCode::Text, error);
+	}, broadcast_caller);
+
+	nap::benchmark::report("calling thread, send per client", per_client_caller);
+	nap::benchmark::compare("calling thread, broadcast", per_client_caller, broadcast_caller);
+	nap::benchmark::report("delivered to all clients, send per client", per_client);
+	nap::benchmark::compare("delivered to all clients, broadcast", per_client, broadcast);
+	printf("    clients: %zu, dropped: %llu\n", connections.size(), static_cast<unsigned long long>(server_end_point.getDroppedMessageCount()));
+
+	for (auto& client : clients)
+		client->onDestroy();
+	server.onDestroy();
+	client_end_point.stop();
+	server_end_point.stop();
+}
@@ -0,0 +1,97 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "benchmark.h"
+
+// External Includes
+#include <websocketinterface.h>
+#include <websocketservice.h>
+#include <websocketevent.h>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+namespace
+{
+	/**
+	 * Interface that receives messages from the benchmark threads instead of an endpoint
+	 */
+	class MessageInterface : public nap::WebSocketInterface
+	{
+	public:
+		MessageInterface(nap::WebSocketService& service) : nap::WebSocketInterface(service) { }
+
+		void receive(const nap::WebSocketConnection& connection, const nap::WebSocketMessage& message)	{ addMessageEvent(connection, message); }
+	};
+}
+
+
+// Four endpoint threads each deliver 10000 messages of 256 bytes that are consumed on the calling thread.
+// Compares a mutex guarded queue of newly allocated events against the lock free queue of pooled events.
+NAP_BENCHMARK(webSocketEvents)
+{
+	constexpr int threadCount = 4;
+	constexpr int messageCount = 10000;
+
+	const nap::WebSocketConnection connection;
+	const nap::WebSocketMessage message(std::string(256, 'x'), nap::EWebSocketOPCode::Text);
+
+	auto run = [&](const std::function<void()>& produce, const std::function<void()>& consume)
+	{
+		std::atomic<int> running = { threadCount };
+		std::vector<std::thread> threads;
+		for (int i = 0; i < threadCount; i++)
+		{
+			threads.emplace_back([&]()
+			{
+				for (int m = 0; m < messageCount; m++)
+					produce();
+				running--;
+			});
+		}
+		while (running.load() > 0)
+			consume();
+		for (auto& thread : threads)
+			thread.join();
+		consume();
+	};
+
+	// Previous delivery: every message allocates a new event, the queue is guarded by a mutex
+	std::mutex mutex;
+	std::queue<nap::WebSocketEventPtr> queue;
+	double locked = nap::benchmark::measure(5, [&]()
+	{
+		run([&]()
+		{
+			auto event = std::make_unique<nap::WebSocketMessageReceivedEvent>(connection, message);
+			std::lock_guard<std::mutex> lock(mutex);
+			queue.emplace(std::move(event));
+		},
+		[&]()
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			while (!queue.empty())
+			{
+				nap::benchmark::consume(queue.front().get());
+				queue.pop();
+			}
+		});
+	}) / (threadCount * messageCount);
+
+	// Pooled events, drained in batches by the service
+	nap::WebSocketService service(nullptr);
+	MessageInterface ws_interface(service);
+	nap::utility::ErrorState error;
+	ws_interface.init(error);
+	double pooled = nap::benchmark::measure(5, [&]()
+	{
+		run([&]() { ws_interface.receive(connection, message); }, [&]() { service.update(0.0); });
+	}) / (threadCount * messageCount);
+
+	nap::benchmark::report("message event, mutex and allocation", locked);
+	nap::benchmark::compare("message event, lock free and pooled", locked, pooled);
+}
@@ -56,4 +56,10 @@ namespace nap
 
 		mOutStreamMutex.unlock();
 	}
+
+
+	void ConsoleLogHandler::flush()
+	{
+		// Messages are passed to the Android log immediately
+	}
 }
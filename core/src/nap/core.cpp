@@ -10,6 +10,7 @@
 #include "objectgraph.h"
 #include "packaginginfo.h"
 #include "python.h"
+#include "profiler.h"
 
 // External Includes
 #include <iostream>
@@ -57,6 +58,12 @@ namespace nap
 		// Because entities and components are managed and owned by the resource manager we explicitly delete this first.
 		mResourceManager.reset(nullptr);
 
+		// Stop updating services on worker threads
+		mServiceThreadPool.reset(nullptr);
+
+		// Recorded zones reference service names owned by core
+		Profiler::instance().clear();
+
 		// After that remove all services
 		mServices.clear();
 
@@ -169,6 +176,10 @@ namespace nap
 		mResourceManager->mPreResourcesLoadedSignal.connect(mPreResourcesLoadedSlot);
 		mResourceManager->mPostResourcesLoadedSignal.connect(mPostResourcesLoadedSlot);
 
+		// Update thread-safe services in parallel when the project asks for it
+		if (mProjectInfo != nullptr && mProjectInfo->mParallelServiceUpdate)
+			enableParallelServiceUpdate(true, mProjectInfo->mServiceUpdateThreads);
+
 		return true;
 	}
 
@@ -215,33 +226,128 @@ namespace nap
 		// Store time stamp
 		mLastTimeStamp = new_elapsed_time;
 
+		// Update all services using measured delta time
+		return update(updateFunction, delta_time);
+	}
+
+
+	double Core::update(std::function<void(double)>& updateFunction, double deltaTime)
+	{
 		// Update framerate
-		calculateFramerate(delta_time);
+		calculateFramerate(deltaTime);
+
+		// Time entire frame
+		NAP_PROFILE_SCOPE(Profiler::frameZone)
 
 		// Perform update call before we check for file changes
-		for (auto& service : mServices)
-			service->preUpdate(delta_time);
+		for (int i = 0; i < mServices.size(); i++)
+		{
+			ProfileScope scope(mServiceNames[i].c_str(), "preUpdate");
+			mServices[i]->preUpdate(deltaTime);
+		}
 
 		// Check for file changes
-		mResourceManager->checkForFileChanges();
+		{
+			NAP_PROFILE_SCOPE("ResourceManager::checkForFileChanges")
+			mResourceManager->checkForFileChanges();
+		}
 
 		// Update rest of the services
-		for (auto& service : mServices)
-			service->update(delta_time);
+		updateServices(deltaTime);
 
 		// Call update function
-		updateFunction(delta_time);
+		{
+			NAP_PROFILE_SCOPE("App::update")
+			updateFunction(deltaTime);
+		}
 
 		// Update rest of the services
-		for (auto& service : mServices)
-			service->postUpdate(delta_time);
+		for (int i = 0; i < mServices.size(); i++)
+		{
+			ProfileScope scope(mServiceNames[i].c_str(), "postUpdate");
+			mServices[i]->postUpdate(deltaTime);
+		}
+
+		return deltaTime;
+	}
 
-		return delta_time;
+
+	void Core::enableParallelServiceUpdate(bool enable, uint32 threadCount)
+	{
+		mServiceThreadPool.reset();
+		if (!enable)
+			return;
+
+		uint32 thread_count = threadCount > 0 ? threadCount :
+			std::max<uint32>(std::thread::hardware_concurrency(), 1);
+		mServiceThreadPool = std::make_unique<ThreadPool>(thread_count, static_cast<uint32>(mServices.size()) + 1);
+		nap::Logger::info("Parallel service update enabled, using %d threads", thread_count);
+	}
+
+
+	void Core::updateServices(double deltaTime)
+	{
+		// Update services in sequence
+		if (mServiceThreadPool == nullptr)
+		{
+			for (int i = 0; i < mServices.size(); i++)
+			{
+				ProfileScope scope(mServiceNames[i].c_str(), "update");
+				mServices[i]->update(deltaTime);
+			}
+			return;
+		}
+
+		// Update services level by level, services within a level don't depend on each other.
+		// Thread-safe services are handed to the pool, others are updated on this thread in the meantime.
+		for (const auto& level : mServiceLevels)
+		{
+			if (level.size() > 1)
+			{
+				for (int index : level)
+				{
+					if (!mServices[index]->isUpdateThreadSafe())
+						continue;
+
+					{
+						std::lock_guard<std::mutex> lock(mServiceUpdateMutex);
+						mPendingServiceUpdates++;
+					}
+
+					mServiceThreadPool->execute([this, index, deltaTime]()
+					{
+						{
+							ProfileScope scope(mServiceNames[index].c_str(), "update");
+							mServices[index]->update(deltaTime);
+						}
+						std::lock_guard<std::mutex> lock(mServiceUpdateMutex);
+						if (--mPendingServiceUpdates == 0)
+							mServiceUpdateCondition.notify_one();
+					});
+				}
+			}
+
+			for (int index : level)
+			{
+				if (level.size() > 1 && mServices[index]->isUpdateThreadSafe())
+					continue;
+
+				ProfileScope scope(mServiceNames[index].c_str(), "update");
+				mServices[index]->update(deltaTime);
+			}
+
+			// Wait for the worker threads to finish this level
+			std::unique_lock<std::mutex> lock(mServiceUpdateMutex);
+			mServiceUpdateCondition.wait(lock, [this]() { return mPendingServiceUpdates == 0; });
+		}
 	}
 
 
 	void Core::shutdownServices()
 	{
+		// Stop updating services on worker threads
+		mServiceThreadPool.reset();
+
 		// Call pre-shutdown on services to give them a chance to reset any state they need
 		// before resources are destroyed.
 		for (auto it = mServices.rbegin(); it != mServices.rend(); it++)
@@ -321,11 +427,21 @@ namespace nap
 			return false;
 
 		// Add services in right order
+		int level_depth = -1;
 		for (auto& node : graph.getSortedNodes())
 		{
 			// Add the service to core
 			nap::Service* service = node->mItem.mObject;
 			mServices.emplace_back(std::unique_ptr<nap::Service>(service));
+			mServiceNames.emplace_back(service->getTypeName());
+
+			// Group services by depth, services at the same depth don't depend on each other
+			if (mServiceLevels.empty() || node->mDepth != level_depth)
+			{
+				mServiceLevels.emplace_back();
+				level_depth = node->mDepth;
+			}
+			mServiceLevels.back().emplace_back(static_cast<int>(mServices.size()) - 1);
 
 			// This happens within this loop so services are able to query their dependencies while registering object creators
 			service->registerObjectCreators(mResourceManager->getFactory());
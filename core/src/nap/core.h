@@ -20,6 +20,9 @@
 #include <utility/dllexport.h>
 #include <unordered_map>
 #include <vector>
+#include <utility/threading.h>
+#include <condition_variable>
+#include <mutex>
 
 // Default name to use when writing the file that contains all the settings for the NAP services.
 constexpr char DEFAULT_SERVICE_CONFIG_FILENAME[] = "config.json";
@@ -180,6 +183,34 @@ namespace nap
 		 */
 		double update(std::function<void(double)>& updateFunction);
 
+		/**
+		 * Updates all services using the given delta time instead of the time measured in between calls.
+		 * Use this to step core deterministically at a fixed rate, for example when rendering offline.
+		 * @param updateFunction application callback that is invoked after updating all the services but before render.
+		 * @param deltaTime the time in seconds to advance
+		 * @return deltaTime
+		 */
+		double update(std::function<void(double)>& updateFunction, double deltaTime);
+
+		/**
+		 * Enables or disables parallel service updates.
+		 * When enabled, services that declare their update() call thread-safe, see Service::isUpdateThreadSafe(),
+		 * are updated on worker threads. Services are scheduled level by level using the service dependency graph:
+		 * all services at the same level are independent and updated concurrently, a service is never updated
+		 * before the services it depends on. Services that are not thread-safe are updated on the calling thread.
+		 * preUpdate() and postUpdate() are always invoked on the calling thread.
+		 * Parallel service updates are disabled by default. Enable them using the 'ParallelServiceUpdate' property
+		 * of the project file, which is applied by initializeServices(), or call this after initializeEngine().
+		 * @param enable if thread-safe services are updated on worker threads
+		 * @param threadCount number of worker threads, 0 uses the number of hardware threads
+		 */
+		void enableParallelServiceUpdate(bool enable, uint32 threadCount = 0);
+
+		/**
+		 * @return if thread-safe services are updated on worker threads
+		 */
+		bool parallelServiceUpdateEnabled() const						{ return mServiceThreadPool != nullptr; }
+
 		/**
 		* The resource manager holds all the entities and components currently loaded by Core.
 		* @return the resource manager.
@@ -207,6 +238,8 @@ namespace nap
 		HighResTimeStamp getStartTime() const;
 
 		/**
+		 * The number of frames per second, averaged over the last 20 frames.
+		 * Use the nap::Profiler for a detailed breakdown of the time spent in every service.
 		 * @return number of frames per second
 		 */
 		float getFramerate() const										{ return mFramerate; }
@@ -344,6 +377,13 @@ namespace nap
 		 */
 		void postResourcesLoaded();
 
+		/**
+		 * Calls update() on all services, either in sequence or level by level
+		 * on worker threads when parallel service updates are enabled.
+		 * @param deltaTime time in seconds since last update
+		 */
+		void updateServices(double deltaTime);
+
 		/**
 		 *	Calculates the framerate over time
 		 */
@@ -391,6 +431,20 @@ namespace nap
 		// Sorted service nodes, set after init
 		std::vector<std::unique_ptr<Service>> mServices;
 
+		// Type name of every service, in update order, used as profile zone name
+		std::vector<std::string> mServiceNames;
+
+		// Service indices grouped by level in the dependency graph, in update order
+		std::vector<std::vector<int>> mServiceLevels;
+
+		// Worker threads that update thread-safe services, nullptr when disabled
+		std::unique_ptr<ThreadPool> mServiceThreadPool = nullptr;
+
+		// Number of services that are being updated by worker threads
+		int mPendingServiceUpdates = 0;
+		std::mutex mServiceUpdateMutex;
+		std::condition_variable mServiceUpdateCondition;
+
 		// All service configurations
 		std::unordered_map<rtti::TypeInfo, std::unique_ptr<ServiceConfiguration>> mServiceConfigs;
 
@@ -0,0 +1,255 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// External Includes
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace nap
+{
+	// Forward declarations
+	template<typename Signature, std::size_t Capacity = 4 * sizeof(void*)> class InlineFunction;
+
+	/**
+	 * Type erased function object, similar to std::function.
+	 * Callables that fit in Capacity bytes are stored inside the object, larger callables are allocated on the heap.
+	 * A lambda that captures 'this' and a couple of pointers, or an object together with a member function pointer,
+	 * fits without allocation. The callable must be copy constructible.
+	 */
+	template<typename R, typename... Args, std::size_t Capacity>
+	class InlineFunction<R(Args...), Capacity> final
+	{
+		// Result of calling F with the function arguments, fails substitution when F can't be called with them
+		template<typename F>
+		using CallResult = decltype(std::declval<typename std::decay<F>::type&>()(std::declval<Args>()...));
+
+		// Enabled when F can be called with the function arguments and is not an InlineFunction itself
+		template<typename F>
+		using EnableIfCallable = typename std::enable_if<
+			!std::is_same<typename std::decay<F>::type, InlineFunction>::value &&
+			(std::is_void<R>::value || std::is_convertible<CallResult<F>, R>::value)>::type;
+
+	public:
+		InlineFunction() = default;
+
+		/**
+		 * Creates an empty function
+		 */
+		InlineFunction(std::nullptr_t)														{ }
+
+		/**
+		 * Stores a copy of the callable, empty std::function objects and null function pointers result in an empty function.
+		 * @param function the callable to store
+		 */
+		template<typename F, typename = EnableIfCallable<F>>
+		InlineFunction(F&& function)														{ assign(std::forward<F>(function)); }
+
+		InlineFunction(const InlineFunction& other);
+		InlineFunction(InlineFunction&& other) noexcept;
+		~InlineFunction()																	{ reset(); }
+
+		InlineFunction& operator=(const InlineFunction& other);
+		InlineFunction& operator=(InlineFunction&& other) noexcept;
+		InlineFunction& operator=(std::nullptr_t)											{ reset(); return *this; }
+
+		/**
+		 * Replaces the stored callable.
+		 * @param function the callable to store
+		 */
+		template<typename F, typename = EnableIfCallable<F>>
+		InlineFunction& operator=(F&& function)												{ reset(); assign(std::forward<F>(function)); return *this; }
+
+		/**
+		 * Calls the stored callable, the function must not be empty.
+		 */
+		R operator()(Args... args) const
+		{
+			assert(mInvoke != nullptr);
+			return mInvoke(const_cast<void*>(static_cast<const void*>(mStorage)), std::forward<Args>(args)...);
+		}
+
+		/**
+		 * @return if a callable is stored
+		 */
+		explicit operator bool() const														{ return mOperations != nullptr; }
+
+		/**
+		 * Destroys the stored callable.
+		 */
+		void reset();
+
+		/**
+		 * @return if a callable of type F is stored without allocating memory
+		 */
+		template<typename F>
+		static constexpr bool isStoredInline()
+		{
+			return sizeof(F) <= Capacity && alignof(F) <= alignof(void*) && std::is_nothrow_move_constructible<F>::value;
+		}
+
+	private:
+		using Invoke = R (*)(void* storage, Args&&... args);
+
+		/**
+		 * Functions that operate on a specific type of stored callable
+		 */
+		struct Operations
+		{
+			Invoke mInvoke;
+			void (*mCopy)(const void* source, void* target);
+			void (*mMove)(void* source, void* target);
+			void (*mDestroy)(void* storage);
+		};
+
+		/**
+		 * Callable stored in the buffer
+		 */
+		template<typename F>
+		struct InlineOperations
+		{
+			static R invoke(void* storage, Args&&... args)									{ return (*static_cast<F*>(storage))(std::forward<Args>(args)...); }
+			static void copy(const void* source, void* target)								{ new (target) F(*static_cast<const F*>(source)); }
+			static void move(void* source, void* target)									{ new (target) F(std::move(*static_cast<F*>(source))); static_cast<F*>(source)->~F(); }
+			static void destroy(void* storage)												{ static_cast<F*>(storage)->~F(); }
+			static const Operations& get()													{ static const Operations operations = { &invoke, &copy, &move, &destroy }; return operations; }
+		};
+
+		/**
+		 * Callable allocated on the heap, the buffer holds the pointer
+		 */
+		template<typename F>
+		struct HeapOperations
+		{
+			static F*& pointer(void* storage)												{ return *static_cast<F**>(storage); }
+			static R invoke(void* storage, Args&&... args)									{ return (*pointer(storage))(std::forward<Args>(args)...); }
+			static void copy(const void* source, void* target)								{ new (target) F*(new F(**static_cast<F* const*>(source))); }
+			static void move(void* source, void* target)									{ new (target) F*(pointer(source)); }
+			static void destroy(void* storage)												{ delete pointer(storage); }
+			static const Operations& get()													{ static const Operations operations = { &invoke, &copy, &move, &destroy }; return operations; }
+		};
+
+		template<typename F>
+		static bool isNull(const F&)														{ return false; }
+
+		template<typename Signature>
+		static bool isNull(const std::function<Signature>& function)						{ return !function; }
+
+		template<typename T>
+		static bool isNull(T* function)														{ return function == nullptr; }
+
+		template<typename F>
+		void assign(F&& function);
+
+		alignas(void*) unsigned char mStorage[Capacity];			///< Callable or pointer to the heap allocated callable
+		Invoke mInvoke = nullptr;									///< Invoke operation, copied from the operations to save an indirection when called
+		const Operations* mOperations = nullptr;					///< Operations of the stored callable, null when empty
+	};
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Template Definitions
+	//////////////////////////////////////////////////////////////////////////
+
+	template<typename R, typename... Args, std::size_t Capacity>
+	InlineFunction<R(Args...), Capacity>::InlineFunction(const InlineFunction& other)
+	{
+		if (other.mOperations != nullptr)
+		{
+			other.mOperations->mCopy(other.mStorage, mStorage);
+			mOperations = other.mOperations;
+			mInvoke = other.mInvoke;
+		}
+	}
+
+
+	template<typename R, typename... Args, std::size_t Capacity>
+	InlineFunction<R(Args...), Capacity>::InlineFunction(InlineFunction&& other) noexcept
+	{
+		if (other.mOperations != nullptr)
+		{
+			other.mOperations->mMove(other.mStorage, mStorage);
+			mOperations = other.mOperations;
+			mInvoke = other.mInvoke;
+			other.mOperations = nullptr;
+			other.mInvoke = nullptr;
+		}
+	}
+
+
+	template<typename R, typename... Args, std::size_t Capacity>
+	InlineFunction<R(Args...), Capacity>& InlineFunction<R(Args...), Capacity>::operator=(const InlineFunction& other)
+	{
+		if (this != &other)
+		{
+			reset();
+			if (other.mOperations != nullptr)
+			{
+				other.mOperations->mCopy(other.mStorage, mStorage);
+				mOperations = other.mOperations;
+				mInvoke = other.mInvoke;
+			}
+		}
+		return *this;
+	}
+
+
+	template<typename R, typename... Args, std::size_t Capacity>
+	InlineFunction<R(Args...), Capacity>& InlineFunction<R(Args...), Capacity>::operator=(InlineFunction&& other) noexcept
+	{
+		if (this != &other)
+		{
+			reset();
+			if (other.mOperations != nullptr)
+			{
+				other.mOperations->mMove(other.mStorage, mStorage);
+				mOperations = other.mOperations;
+				mInvoke = other.mInvoke;
+				other.mOperations = nullptr;
+				other.mInvoke = nullptr;
+			}
+		}
+		return *this;
+	}
+
+
+	template<typename R, typename... Args, std::size_t Capacity>
+	void InlineFunction<R(Args...), Capacity>::reset()
+	{
+		if (mOperations != nullptr)
+		{
+			mOperations->mDestroy(mStorage);
+			mOperations = nullptr;
+			mInvoke = nullptr;
+		}
+	}
+
+
+	template<typename R, typename... Args, std::size_t Capacity>
+	template<typename F>
+	void InlineFunction<R(Args...), Capacity>::assign(F&& function)
+	{
+		using Callable = typename std::decay<F>::type;
+		if (isNull(function))
+			return;
+
+		if (isStoredInline<Callable>())
+		{
+			new (mStorage) Callable(std::forward<F>(function));
+			mOperations = &InlineOperations<Callable>::get();
+			mInvoke = mOperations->mInvoke;
+		}
+		else
+		{
+			new (mStorage) Callable*(new Callable(std::forward<F>(function)));
+			mOperations = &HeapOperations<Callable>::get();
+			mInvoke = mOperations->mInvoke;
+		}
+	}
+}
@@ -8,12 +8,32 @@
 
 namespace nap
 {
+	// Number of characters reserved for the text of every queued message
+	static constexpr int asyncTextCapacity = 256;
+
+	// Maximum number of queued messages handled before the handlers are flushed
+	static constexpr int asyncBatchSize = 256;
+
+	// Time the background thread sleeps when the queue is empty
+	static constexpr Milliseconds asyncIdleTime(5);
+
+	// A message that repeats within this time is only handled once
+	static constexpr Seconds repeatInterval(1);
+
+	// If the calling thread handles the queued messages, handlers are flushed per batch instead of per message
+	static thread_local bool isAsyncThread = false;
+
 
 	LogMessage::LogMessage(const LogLevel& lvl, const std::string& msg)
 		: mLevel(&lvl), mMessage(msg), mTimeStamp(getCurrentTime())
 	{}
 
 
+	LogMessage::LogMessage(const LogLevel& lvl, const std::string& msg, const SystemTimeStamp& timeStamp)
+		: mLevel(&lvl), mMessage(msg), mTimeStamp(timeStamp)
+	{}
+
+
 	std::string timestampLogMessageFormatter(const LogMessage& msg)
 	{
 		return timeFormat(msg.getTimestamp()) + " " + basicLogMessageFormatter(msg);
@@ -51,6 +71,12 @@ namespace nap
 	}
 
 
+	Logger::~Logger()
+	{
+		stopAsync();
+	}
+
+
 	void Logger::initialize()
 	{
 		log.connect(onLogSlot);
@@ -60,16 +86,43 @@ namespace nap
 
 	void Logger::onLog(const LogMessage& message)
 	{
+		std::lock_guard<std::recursive_mutex> lock(mHandlerMutex);
 		for (auto& handler : mHandlers)
 		{
 			if (message.level() >= handler->getLogLevel())
+			{
 				handler->commit(message);
+				if (!isAsyncThread)
+					handler->flush();
+			}
 		}
 	}
 
 
+	void Logger::write(const LogLevel& level, const rtti::Object* object, const std::string& message)
+	{
+		if (!mAsync.load(std::memory_order_acquire))
+		{
+			log(LogMessage(level, object != nullptr ? object->mID + ": " + message : message));
+			return;
+		}
+
+		bool queued = mQueue->push(level, [&](std::string& text)
+		{
+			text.clear();
+			if (object != nullptr)
+				text.append(object->mID).append(": ");
+			text.append(message);
+		});
+
+		if (!queued)
+			mDroppedCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+
 	void Logger::setCurrentLevel(const LogLevel& level)
 	{
+		std::lock_guard<std::recursive_mutex> lock(mHandlerMutex);
 		for (auto& handler : mHandlers)
 			handler->setLogLevel(level);
 		mLevel = &level;
@@ -85,10 +138,133 @@ namespace nap
 
 	void Logger::addHandler(std::unique_ptr<LogHandler> handler)
 	{
+		std::lock_guard<std::recursive_mutex> lock(mHandlerMutex);
 		mHandlers.emplace_back(std::move(handler));
 	}
 
 
+	void Logger::startAsyncLogging(int capacity)
+	{
+		Logger& logger = instance();
+		std::lock_guard<std::mutex> lock(logger.mAsyncMutex);
+		if (logger.mAsyncThread != nullptr)
+			return;
+
+		// The queue is kept when logging stops, a thread that is still writing to it must not fail.
+		// Messages it queued after the last drain are handled first.
+		if (logger.mQueue == nullptr)
+			logger.mQueue = std::make_unique<LogQueue>(capacity, asyncTextCapacity);
+		else
+			while (logger.handleRecords());
+
+		logger.mAsyncRunning = true;
+		logger.mAsyncThread = std::make_unique<std::thread>(std::bind(&Logger::asyncLoop, &logger));
+		logger.mAsync.store(true, std::memory_order_release);
+	}
+
+
+	void Logger::stopAsyncLogging()
+	{
+		instance().stopAsync();
+	}
+
+
+	void Logger::stopAsync()
+	{
+		std::lock_guard<std::mutex> lock(mAsyncMutex);
+		if (mAsyncThread == nullptr)
+			return;
+
+		mAsync.store(false, std::memory_order_release);
+		mAsyncRunning = false;
+		mAsyncThread->join();
+		mAsyncThread.reset();
+
+		// Handle messages that were pushed while the background thread stopped
+		while (handleRecords());
+		reportRepeats();
+		reportDropped();
+	}
+
+
+	void Logger::asyncLoop()
+	{
+		isAsyncThread = true;
+		while (mAsyncRunning)
+		{
+			if (!handleRecords())
+				std::this_thread::sleep_for(asyncIdleTime);
+		}
+
+		// Handle the remaining messages
+		while (handleRecords());
+		flushHandlers();
+	}
+
+
+	bool Logger::handleRecords()
+	{
+		int count = 0;
+		while (count < asyncBatchSize && mQueue->pop([this](const LogRecord& record) { handleRecord(record); }))
+			count++;
+
+		// Report a message that stopped repeating
+		if (mRepeatCount > 0 && getCurrentTime() - mRepeatTime >= repeatInterval)
+			reportRepeats();
+
+		reportDropped();
+		if (isAsyncThread)
+			flushHandlers();
+		return count > 0;
+	}
+
+
+	void Logger::handleRecord(const LogRecord& record)
+	{
+		// Suppress a message that repeats within the interval, the repetitions are reported afterwards
+		if (record.mLevel == mRepeatLevel && record.mTimeStamp - mRepeatTime < repeatInterval && record.mText == mRepeatText)
+		{
+			mRepeatCount++;
+			return;
+		}
+
+		reportRepeats();
+		mRepeatLevel = record.mLevel;
+		mRepeatText = record.mText;
+		mRepeatTime = record.mTimeStamp;
+		log(LogMessage(*record.mLevel, record.mText, record.mTimeStamp));
+	}
+
+
+	void Logger::reportRepeats()
+	{
+		if (mRepeatCount == 0)
+			return;
+
+		log(LogMessage(*mRepeatLevel, utility::stringFormat("Last message repeated %d times", mRepeatCount)));
+		mRepeatCount = 0;
+	}
+
+
+	void Logger::reportDropped()
+	{
+		uint64 dropped = mDroppedCount.load(std::memory_order_relaxed);
+		if (dropped == mReportedDropCount)
+			return;
+
+		log(LogMessage(warnLevel(), utility::stringFormat("Log queue full, dropped %llu messages", static_cast<unsigned long long>(dropped - mReportedDropCount))));
+		mReportedDropCount = dropped;
+	}
+
+
+	void Logger::flushHandlers()
+	{
+		std::lock_guard<std::recursive_mutex> lock(mHandlerMutex);
+		for (auto& handler : mHandlers)
+			handler->flush();
+	}
+
+
 	void Logger::addFileHandler(const std::string& filename)
 	{
 		debug("Logging to file: %s", filename.c_str());
@@ -189,7 +365,7 @@ namespace nap
 				writeQueue.pop();
 				if (stream.good())
 				{
-					stream << formatMessage(msg) << std::endl;
+					stream << formatMessage(msg) << '\n';
 				}
 				else
 				{
@@ -197,6 +373,7 @@ namespace nap
 					break;
 				}
 			}
+			stream.flush();
 
 			std::this_thread::sleep_for(std::chrono::milliseconds(50));
 		}
@@ -7,6 +7,8 @@
 // Local Includes
 #include "utility/stringutils.h"
 #include "signalslot.h"
+#include "logqueue.h"
+#include "numeric.h"
 #include "rtti/object.h"
 
 // External Includes
@@ -35,24 +37,24 @@
 																											\
 	static void NAME(const std::string& msg)																\
 	{																										\
-		instance().log(LogMessage(NAME##Level(), msg));														\
+		instance().write(NAME##Level(), nullptr, msg);														\
 	}																										\
 																											\
 	static void	NAME(const rtti::Object& obj, const std::string& msg)										\
 	{																										\
-		instance().log(LogMessage(NAME##Level(), obj.mID + ": " + msg));									\
+		instance().write(NAME##Level(), &obj, msg);															\
 	}																										\
 																											\
 	template <typename... Args>																				\
 	static void NAME(const std::string& msg, Args... args)													\
 	{																										\
-		instance().log(LogMessage(NAME##Level(), utility::stringFormat(msg, args...)));						\
+		instance().writeFormat(NAME##Level(), nullptr, msg, args...);										\
 	}																										\
 																											\
 	template <typename... Args>																				\
 	static void NAME(rtti::Object& obj, const std::string& msg, Args... args)								\
 	{																										\
-		instance().log(LogMessage(NAME##Level(), utility::stringFormat(obj.mID + ": " + msg, args...)));	\
+		instance().writeFormat(NAME##Level(), &obj, msg, args...);											\
 	}
 
 
@@ -101,6 +103,11 @@ namespace nap
 	public:
 		LogMessage(const LogLevel& lvl, const std::string& msg);
 
+		/**
+		 * Creates a message that was logged at the given time, used when messages are handled asynchronously
+		 */
+		LogMessage(const LogLevel& lvl, const std::string& msg, const SystemTimeStamp& timeStamp);
+
 		/**
 		 * @return the log level of this message
 		 */
@@ -155,6 +162,12 @@ namespace nap
 		 */
 		virtual void commit(LogMessage msg) = 0;
 
+		/**
+		 * Write out all committed messages. Called after every message,
+		 * or after every batch of messages when logging asynchronously.
+		 */
+		virtual void flush()							{ }
+
 		/**
 		 * Set the log level on this handler, log messages lower than the provided level
 		 * will not be sent to this handler.
@@ -206,12 +219,19 @@ namespace nap
 		 */
 		void setCurrentLevel(const LogLevel& level);
 
+		/**
+		 * @return the current log level
+		 */
+		const LogLevel& getCurrentLevel() const				{ return *mLevel; }
+
 		/**
 		 * @return instance of the actual logger
 		 */
 		static Logger& instance();
 
 		// this signal is emitted every time a log message is output.
+		// When logging asynchronously it is emitted on the background thread, connecting or disconnecting
+		// while asynchronous logging runs is a race: connect before startAsyncLogging() or after stopAsyncLogging().
 		Signal<LogMessage> log;
 
 		// all log messages will be displayed
@@ -279,18 +299,83 @@ namespace nap
 		 */
 		void addHandler(std::unique_ptr<LogHandler> handler);
 
+		/**
+		 * Start handling log messages on a background thread.
+		 * Logging a message only formats the text into a preallocated record of a lock free queue,
+		 * the log signal is emitted and handlers are invoked on the background thread in batches.
+		 * Messages that are logged while the queue is full are dropped and counted.
+		 * A message that repeats is handled once per second, followed by the number of repetitions.
+		 * The log signal is emitted on the background thread, don't connect to it while asynchronous logging runs.
+		 * Messages that are still queued from a previous run are handled on the calling thread before the background thread starts.
+		 * @param capacity number of messages the queue holds, only used the first time asynchronous logging starts.
+		 */
+		static void startAsyncLogging(int capacity = 1024);
+
+		/**
+		 * Stop handling log messages on a background thread, all queued messages are handled before this call returns.
+		 * A message that another thread logs while logging stops can be queued after the queue is drained.
+		 * That message is handled when asynchronous logging starts again, it is lost when it doesn't.
+		 */
+		static void stopAsyncLogging();
+
+		/**
+		 * @return if log messages are handled on a background thread
+		 */
+		static bool isAsyncLogging()						{ return instance().mAsync.load(std::memory_order_acquire); }
+
+		/**
+		 * @return number of log messages that were dropped because the asynchronous log queue was full
+		 */
+		static uint64 getDroppedMessageCount()				{ return instance().mDroppedCount.load(std::memory_order_relaxed); }
+
 	private:
 		// The logger is a singleton
 		Logger();
 		Logger(Logger const&);
+		~Logger();
 		void operator=(Logger const&);
 
 		void initialize();
 		void onLog(const LogMessage& message);
 
+		// Logs a message, prefixed with the ID of the object when given
+		void write(const LogLevel& level, const rtti::Object* object, const std::string& message);
+
+		// Formats and logs a message, prefixed with the ID of the object when given
+		template <typename... Args>
+		void writeFormat(const LogLevel& level, const rtti::Object* object, const std::string& format, Args... args);
+
+		// Formats a message into the end of the text, without allocating when the text has enough capacity
+		template <typename... Args>
+		static void appendFormat(std::string& text, const std::string& format, Args... args);
+
+		void stopAsync();
+		void asyncLoop();
+		bool handleRecords();
+		void handleRecord(const LogRecord& record);
+		void reportRepeats();
+		void reportDropped();
+		void flushHandlers();
+
 		Slot<LogMessage> onLogSlot = {[&](LogMessage message)	{ onLog(message); }};
 		const LogLevel* mLevel;
 		std::vector<std::unique_ptr<LogHandler>> mHandlers{};
+		std::recursive_mutex mHandlerMutex;								///< Handlers are invoked from the background thread when logging asynchronously
+
+		// Asynchronous logging
+		std::atomic<bool> mAsync = { false };							///< If messages are pushed to the queue
+		std::atomic<bool> mAsyncRunning = { false };					///< Keeps the background thread running
+		std::atomic<uint64> mDroppedCount = { 0 };						///< Number of messages dropped because the queue was full
+		std::unique_ptr<LogQueue> mQueue;								///< Messages to handle on the background thread
+		std::unique_ptr<std::thread> mAsyncThread;						///< Handles the queued messages
+		std::mutex mAsyncMutex;											///< Serializes starting and stopping
+
+		// Owned by the background thread
+		uint64 mReportedDropCount = 0;									///< Dropped messages that have been reported
+		const LogLevel* mRepeatLevel = nullptr;							///< Level of the last handled message
+		std::string mRepeatText;										///< Text of the last handled message
+		SystemTimeStamp mRepeatTime;									///< Time the last message was handled
+		int mRepeatCount = 0;											///< Number of times the last message repeated since it was handled
 	};
 
 
@@ -308,6 +393,11 @@ namespace nap
 		 */
 		void commit(LogMessage message) override;
 
+		/**
+		 * Flush the output streams
+		 */
+		void flush() override;
+
 	private:
 		std::mutex mOutStreamMutex;
 	};
@@ -341,4 +431,53 @@ namespace nap
 	};
 
 
+	//////////////////////////////////////////////////////////////////////////
+	// Template Definitions
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename... Args>
+	void Logger::writeFormat(const LogLevel& level, const rtti::Object* object, const std::string& format, Args... args)
+	{
+		if (!mAsync.load(std::memory_order_acquire))
+		{
+			log(LogMessage(level, utility::stringFormat(object != nullptr ? object->mID + ": " + format : format, args...)));
+			return;
+		}
+
+		bool queued = mQueue->push(level, [&](std::string& text)
+		{
+			text.clear();
+			if (object != nullptr)
+				text.append(object->mID).append(": ");
+			appendFormat(text, format, args...);
+		});
+
+		if (!queued)
+			mDroppedCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+
+	template <typename... Args>
+	void Logger::appendFormat(std::string& text, const std::string& format, Args... args)
+	{
+		// Try to format into the reserved capacity first, format again when the text doesn't fit
+		auto offset = text.size();
+		text.resize(text.capacity());
+		int size = snprintf(&text[offset], text.size() - offset + 1, format.c_str(), args...);
+		if (size < 0)
+		{
+			text.resize(offset);
+			return;
+		}
+
+		if (offset + size > text.size())
+		{
+			text.resize(offset + size);
+			snprintf(&text[offset], size + 1, format.c_str(), args...);
+		}
+		else
+		{
+			text.resize(offset + size);
+		}
+	}
 }
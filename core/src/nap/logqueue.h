@@ -0,0 +1,157 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Local Includes
+#include "datetime.h"
+
+// External Includes
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace nap
+{
+	// Forward declarations
+	class LogLevel;
+
+	/**
+	 * Log message stored in a LogQueue.
+	 * The text memory of a record is reused by the next message that is written to it.
+	 */
+	struct LogRecord
+	{
+		const LogLevel* mLevel = nullptr;			///< Level of the message
+		SystemTimeStamp mTimeStamp;					///< Time the message was logged
+		std::string mText;							///< Text of the message
+	};
+
+
+	/**
+	 * Bounded queue of log records that is written to by any number of threads and read by a single thread.
+	 * Writing a record doesn't lock and doesn't allocate memory, as long as the message fits in the reserved text capacity.
+	 * Writing fails when the queue is full, the caller is expected to count and report the dropped message.
+	 */
+	class LogQueue final
+	{
+	public:
+		/**
+		 * Allocates all records up front.
+		 * @param capacity number of records, rounded up to a power of two
+		 * @param textCapacity number of characters reserved for the text of every record
+		 */
+		LogQueue(int capacity, int textCapacity);
+
+		LogQueue(const LogQueue&) = delete;
+		LogQueue& operator=(const LogQueue&) = delete;
+
+		/**
+		 * Adds a record to the queue, safe to call from any thread.
+		 * @param level level of the message
+		 * @param writeText called with the text of the record, writes the message into the text
+		 * @return if the record was added, false when the queue is full
+		 */
+		template<typename Writer>
+		bool push(const LogLevel& level, Writer&& writeText);
+
+		/**
+		 * Removes the oldest record from the queue, must always be called from the same thread.
+		 * @param readRecord called with the record before it is handed back to the writers
+		 * @return if a record was available
+		 */
+		template<typename Reader>
+		bool pop(Reader&& readRecord);
+
+		/**
+		 * @return the number of records in the queue
+		 */
+		int getCapacity() const										{ return static_cast<int>(mMask + 1); }
+
+	private:
+		// A record can be written when its sequence equals the write position
+		// and can be read when its sequence equals the read position + 1
+		struct Slot
+		{
+			std::atomic<std::size_t> mSequence;
+			LogRecord mRecord;
+		};
+
+		std::unique_ptr<Slot[]>		mSlots;							///< All records
+		std::size_t					mMask = 0;						///< Capacity - 1, maps a position to a slot
+		std::atomic<std::size_t>	mWritePosition = { 0 };			///< Position of the next record to write
+		char						mPadding[64];					///< Keeps the read position on another cache line than the write position
+		std::size_t					mReadPosition = 0;				///< Position of the next record to read
+	};
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Template Definitions
+	//////////////////////////////////////////////////////////////////////////
+
+	inline LogQueue::LogQueue(int capacity, int textCapacity)
+	{
+		std::size_t size = 1;
+		while (size < static_cast<std::size_t>(capacity))
+			size <<= 1;
+
+		mSlots = std::make_unique<Slot[]>(size);
+		mMask = size - 1;
+		for (std::size_t i = 0; i < size; i++)
+		{
+			mSlots[i].mSequence.store(i, std::memory_order_relaxed);
+			mSlots[i].mRecord.mText.reserve(textCapacity);
+		}
+	}
+
+
+	template<typename Writer>
+	bool LogQueue::push(const LogLevel& level, Writer&& writeText)
+	{
+		// Claim the slot at the write position, another writer might claim it first
+		std::size_t position = mWritePosition.load(std::memory_order_relaxed);
+		Slot* slot = nullptr;
+		while (true)
+		{
+			slot = &mSlots[position & mMask];
+			std::size_t sequence = slot->mSequence.load(std::memory_order_acquire);
+			std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+			if (difference == 0)
+			{
+				if (mWritePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (difference < 0)
+			{
+				// The reader hasn't released the slot yet
+				return false;
+			}
+			else
+			{
+				position = mWritePosition.load(std::memory_order_relaxed);
+			}
+		}
+
+		slot->mRecord.mLevel = &level;
+		slot->mRecord.mTimeStamp = SystemClock::now();
+		writeText(slot->mRecord.mText);
+		slot->mSequence.store(position + 1, std::memory_order_release);
+		return true;
+	}
+
+
+	template<typename Reader>
+	bool LogQueue::pop(Reader&& readRecord)
+	{
+		Slot& slot = mSlots[mReadPosition & mMask];
+		if (slot.mSequence.load(std::memory_order_acquire) != mReadPosition + 1)
+			return false;
+
+		readRecord(slot.mRecord);
+		slot.mSequence.store(mReadPosition + mMask + 1, std::memory_order_release);
+		mReadPosition++;
+		return true;
+	}
+}
@@ -17,9 +17,18 @@ namespace nap
 		bool isError = message.level() >= Logger::errorLevel();
 		mOutStreamMutex.lock();
 		if (isError)
-			std::cerr << formatMessage(message) << std::endl;
+			std::cerr << formatMessage(message) << '\n';
 		else
-			std::cout << formatMessage(message) << std::endl;
+			std::cout << formatMessage(message) << '\n';
+		mOutStreamMutex.unlock();
+	}
+
+
+	void ConsoleLogHandler::flush()
+	{
+		mOutStreamMutex.lock();
+		std::cerr.flush();
+		std::cout.flush();
 		mOutStreamMutex.unlock();
 	}
 }
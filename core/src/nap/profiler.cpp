@@ -0,0 +1,294 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "profiler.h"
+
+// External Includes
+#include <utility/stringutils.h>
+#include <algorithm>
+#include <fstream>
+#include <map>
+
+namespace nap
+{
+	constexpr uint32 ProfileThreadBuffer::capacity;
+	constexpr const char* Profiler::frameZone;
+	std::atomic<bool> Profiler::sEnabled = { false };
+
+
+	/**
+	 * Buffer of the calling thread, resolved once per thread
+	 */
+	static thread_local ProfileThreadBuffer* sThreadBuffer = nullptr;
+
+
+	/**
+	 * Escapes a zone or thread name for use inside a JSON string
+	 */
+	static std::string escapeJSON(const char* text)
+	{
+		std::string escaped;
+		if (text == nullptr)
+			return escaped;
+
+		for (const char* c = text; *c != '\0'; c++)
+		{
+			switch (*c)
+			{
+			case '"':
+				escaped += "\\\"";
+				break;
+			case '\\':
+				escaped += "\\\\";
+				break;
+			case '\n':
+				escaped += "\\n";
+				break;
+			case '\t':
+				escaped += "\\t";
+				break;
+			default:
+				if (static_cast<unsigned char>(*c) >= 0x20)
+					escaped += *c;
+				break;
+			}
+		}
+		return escaped;
+	}
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// ProfileThreadBuffer
+	//////////////////////////////////////////////////////////////////////////
+
+	void ProfileThreadBuffer::push(const ProfileZone& zone)
+	{
+		// The fence orders the previous head update before overwriting the slot,
+		// a reader that copies any part of this zone is guaranteed to see that head afterwards
+		uint64 head = mHead.load(std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		Slot& slot = mZones[head & (capacity - 1)];
+		slot.mName.store(zone.mName, std::memory_order_relaxed);
+		slot.mCategory.store(zone.mCategory, std::memory_order_relaxed);
+		slot.mStart.store(zone.mStart, std::memory_order_relaxed);
+		slot.mEnd.store(zone.mEnd, std::memory_order_relaxed);
+		slot.mDepth.store(zone.mDepth, std::memory_order_relaxed);
+		mHead.store(head + 1, std::memory_order_release);
+	}
+
+
+	void ProfileThreadBuffer::copy(std::vector<ProfileZone>& outZones) const
+	{
+		// Find range of valid zones
+		uint64 head = mHead.load(std::memory_order_acquire);
+		uint64 tail = std::max<uint64>(mTail.load(std::memory_order_acquire), head > capacity ? head - capacity : 0);
+		if (tail >= head)
+			return;
+
+		std::size_t offset = outZones.size();
+		for (uint64 i = tail; i < head; i++)
+		{
+			const Slot& slot = mZones[i & (capacity - 1)];
+			outZones.emplace_back();
+			ProfileZone& zone = outZones.back();
+			zone.mName = slot.mName.load(std::memory_order_relaxed);
+			zone.mCategory = slot.mCategory.load(std::memory_order_relaxed);
+			zone.mStart = slot.mStart.load(std::memory_order_relaxed);
+			zone.mEnd = slot.mEnd.load(std::memory_order_relaxed);
+			zone.mDepth = slot.mDepth.load(std::memory_order_relaxed);
+		}
+
+		// Order the copy before reading the head again
+		std::atomic_thread_fence(std::memory_order_acquire);
+
+		// Discard zones that have been overwritten by the owning thread while copying.
+		// The owner writes zone 'new_head' before publishing it, which overwrites zone 'new_head - capacity' as well.
+		uint64 new_head = mHead.load(std::memory_order_relaxed);
+		if (new_head + 1 > capacity + tail)
+		{
+			uint64 overwritten = std::min<uint64>(new_head + 1 - capacity - tail, head - tail);
+			outZones.erase(outZones.begin() + offset, outZones.begin() + offset + overwritten);
+		}
+	}
+
+
+	void ProfileThreadBuffer::clear()
+	{
+		mTail.store(mHead.load(std::memory_order_acquire), std::memory_order_release);
+	}
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Profiler
+	//////////////////////////////////////////////////////////////////////////
+
+	Profiler::Profiler() : mEpoch(HighResolutionClock::now())
+	{ }
+
+
+	Profiler& Profiler::instance()
+	{
+		static Profiler instance;
+		return instance;
+	}
+
+
+	void Profiler::setThreadName(const std::string& name)
+	{
+		Profiler& profiler = instance();
+		ProfileThreadBuffer& buffer = profiler.getThreadBuffer();
+		std::lock_guard<std::mutex> lock(profiler.mBufferMutex);
+		buffer.mName = name;
+	}
+
+
+	int64 Profiler::getTime() const
+	{
+		return std::chrono::duration_cast<NanoSeconds>(HighResolutionClock::now() - mEpoch).count();
+	}
+
+
+	ProfileThreadBuffer& Profiler::getThreadBuffer()
+	{
+		if (sThreadBuffer != nullptr)
+			return *sThreadBuffer;
+
+		// First zone recorded on this thread, create a buffer.
+		// Buffers are never removed, zones stay available after the thread exits.
+		std::lock_guard<std::mutex> lock(mBufferMutex);
+		uint32 id = static_cast<uint32>(mBuffers.size());
+		mBuffers.emplace_back(std::make_unique<ProfileThreadBuffer>(id));
+		mBuffers.back()->mName = utility::stringFormat("thread %d", id);
+		sThreadBuffer = mBuffers.back().get();
+		return *sThreadBuffer;
+	}
+
+
+	void Profiler::collect(std::vector<ProfileThread>& outThreads) const
+	{
+		std::lock_guard<std::mutex> lock(mBufferMutex);
+		outThreads.clear();
+		outThreads.reserve(mBuffers.size());
+		for (const auto& buffer : mBuffers)
+		{
+			outThreads.emplace_back();
+			ProfileThread& thread = outThreads.back();
+			thread.mID = buffer->mID;
+			thread.mName = buffer->mName;
+			buffer->copy(thread.mZones);
+		}
+	}
+
+
+	void Profiler::getStatistics(double window, std::vector<ProfileStatistics>& outStatistics) const
+	{
+		std::vector<ProfileThread> threads;
+		collect(threads);
+
+		// Aggregate zones that ended within the window
+		int64 begin = getTime() - static_cast<int64>(window * 1000000000.0);
+		std::map<std::pair<std::string, std::string>, ProfileStatistics> stats;
+		for (const auto& thread : threads)
+		{
+			for (const auto& zone : thread.mZones)
+			{
+				if (zone.mEnd < begin)
+					continue;
+
+				std::string name = zone.mName != nullptr ? zone.mName : "";
+				std::string category = zone.mCategory != nullptr ? zone.mCategory : "";
+				ProfileStatistics& entry = stats[std::make_pair(name, category)];
+				double duration = zone.getDuration();
+				entry.mCount++;
+				entry.mTotal += duration;
+				entry.mMax = std::max(entry.mMax, duration);
+			}
+		}
+
+		outStatistics.clear();
+		outStatistics.reserve(stats.size());
+		for (auto& entry : stats)
+		{
+			ProfileStatistics& stat = entry.second;
+			stat.mName = entry.first.first;
+			stat.mCategory = entry.first.second;
+			stat.mAverage = stat.mTotal / static_cast<double>(stat.mCount);
+			outStatistics.emplace_back(std::move(stat));
+		}
+
+		std::sort(outStatistics.begin(), outStatistics.end(), [](const ProfileStatistics& a, const ProfileStatistics& b)
+		{
+			return a.mTotal > b.mTotal;
+		});
+	}
+
+
+	bool Profiler::writeTrace(const std::string& path, utility::ErrorState& error) const
+	{
+		std::ofstream stream(path);
+		if (!error.check(stream.is_open(), "Unable to open trace file for writing: %s", path.c_str()))
+			return false;
+
+		std::vector<ProfileThread> threads;
+		collect(threads);
+
+		// Write all zones as complete events, time stamps are in microseconds
+		stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+		bool first = true;
+		for (const auto& thread : threads)
+		{
+			stream << (first ? "" : ",") << utility::stringFormat(
+				"\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+				thread.mID, escapeJSON(thread.mName.c_str()).c_str());
+			first = false;
+
+			for (const auto& zone : thread.mZones)
+			{
+				stream << utility::stringFormat(
+					",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+					escapeJSON(zone.mName).c_str(),
+					zone.mCategory != nullptr ? escapeJSON(zone.mCategory).c_str() : "zone",
+					thread.mID,
+					static_cast<double>(zone.mStart) / 1000.0,
+					static_cast<double>(zone.mEnd - zone.mStart) / 1000.0);
+			}
+		}
+		stream << "\n]}\n";
+
+		return error.check(stream.good(), "Failed to write trace file: %s", path.c_str());
+	}
+
+
+	void Profiler::clear()
+	{
+		std::lock_guard<std::mutex> lock(mBufferMutex);
+		for (auto& buffer : mBuffers)
+			buffer->clear();
+	}
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// ProfileScope
+	//////////////////////////////////////////////////////////////////////////
+
+	void ProfileScope::begin(const char* name, const char* category)
+	{
+		Profiler& profiler = Profiler::instance();
+		mBuffer = &profiler.getThreadBuffer();
+		mZone.mName = name;
+		mZone.mCategory = category;
+		mZone.mDepth = mBuffer->mDepth++;
+		mZone.mStart = profiler.getTime();
+	}
+
+
+	void ProfileScope::end()
+	{
+		mZone.mEnd = Profiler::instance().getTime();
+		mBuffer->mDepth--;
+		mBuffer->push(mZone);
+	}
+}
@@ -0,0 +1,266 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Local Includes
+#include "numeric.h"
+#include "datetime.h"
+
+// External Includes
+#include <utility/dllexport.h>
+#include <utility/errorstate.h>
+#include <atomic>
+#include <array>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * Times the enclosing scope as a zone with the given name, when the profiler is enabled.
+ * The name must be a string literal, or a string that outlives the recorded zone.
+ *
+ *~~~~~{.cpp}
+ * void MyService::update(double deltaTime)
+ * {
+ *		NAP_PROFILE_SCOPE("MyService::update")
+ *		...
+ * }
+ *~~~~~
+ */
+#define NAP_PROFILE_CONCAT_IMPL(a, b) a##b
+#define NAP_PROFILE_CONCAT(a, b) NAP_PROFILE_CONCAT_IMPL(a, b)
+#define NAP_PROFILE_SCOPE(NAME) nap::ProfileScope NAP_PROFILE_CONCAT(nap_profile_scope_, __LINE__)(NAME);
+
+namespace nap
+{
+	/**
+	 * A single timed zone, recorded by a nap::ProfileScope.
+	 * Time stamps are in nanoseconds, relative to the moment the profiler was created.
+	 */
+	struct NAPAPI ProfileZone
+	{
+		const char*	mName = nullptr;			///< Name of the zone, not owned
+		const char*	mCategory = nullptr;		///< Optional category of the zone, not owned
+		int64		mStart = 0;					///< Start of the zone in nanoseconds
+		int64		mEnd = 0;					///< End of the zone in nanoseconds
+		uint32		mDepth = 0;					///< Nesting depth of the zone on the recording thread
+
+		/**
+		 * @return duration of the zone in milliseconds
+		 */
+		double getDuration() const				{ return static_cast<double>(mEnd - mStart) / 1000000.0; }
+	};
+
+
+	/**
+	 * All zones recorded on a single thread, copied out of the profiler by Profiler::collect().
+	 */
+	struct NAPAPI ProfileThread
+	{
+		uint32 mID = 0;							///< Unique id of the thread, assigned by the profiler
+		std::string mName;						///< Display name of the thread
+		std::vector<ProfileZone> mZones;		///< Zones recorded on this thread, ordered by completion
+	};
+
+
+	/**
+	 * Aggregated timing information of all zones that share the same name and category.
+	 */
+	struct NAPAPI ProfileStatistics
+	{
+		std::string mName;						///< Name of the zone
+		std::string mCategory;					///< Category of the zone
+		uint32 mCount = 0;						///< Number of times the zone was recorded
+		double mTotal = 0.0;					///< Total time spent in the zone in milliseconds
+		double mAverage = 0.0;					///< Average duration of the zone in milliseconds
+		double mMax = 0.0;						///< Longest duration of the zone in milliseconds
+	};
+
+
+	/**
+	 * Fixed size ring buffer of zones, written by a single thread and read by any other thread.
+	 * The profiler creates one buffer for every thread that records a zone.
+	 * Writing a zone is wait-free: when the buffer is full, the oldest zone is overwritten.
+	 */
+	class NAPAPI ProfileThreadBuffer final
+	{
+		friend class Profiler;
+		friend class ProfileScope;
+	public:
+		// Number of zones stored per thread, must be a power of 2
+		static constexpr uint32 capacity = 8192;
+
+		ProfileThreadBuffer(uint32 id) : mID(id)		{ }
+
+	private:
+		/**
+		 * Adds a zone to the buffer, only called from the owning thread
+		 */
+		void push(const ProfileZone& zone);
+
+		/**
+		 * Copies all valid zones out of the buffer, can be called from any thread.
+		 * Zones that are overwritten by the owning thread while copying are discarded.
+		 */
+		void copy(std::vector<ProfileZone>& outZones) const;
+
+		/**
+		 * Marks all zones currently in the buffer as consumed
+		 */
+		void clear();
+
+		/**
+		 * Stored zone, the fields are atomic because they are copied while the owning thread might overwrite them
+		 */
+		struct Slot
+		{
+			std::atomic<const char*> mName;
+			std::atomic<const char*> mCategory;
+			std::atomic<int64> mStart;
+			std::atomic<int64> mEnd;
+			std::atomic<uint32> mDepth;
+		};
+
+		std::array<Slot, capacity> mZones;			///< All recorded zones
+		std::atomic<uint64> mHead = { 0 };			///< Total number of written zones
+		std::atomic<uint64> mTail = { 0 };			///< First zone that is not cleared
+		uint32 mDepth = 0;							///< Current nesting depth, only accessed by the owning thread
+		uint32 mID = 0;								///< Unique id of this thread
+		std::string mName;							///< Thread name, protected by the profiler mutex
+	};
+
+
+	/**
+	 * Records timed zones on any thread with minimal overhead.
+	 *
+	 * Zones are recorded using the NAP_PROFILE_SCOPE macro or a nap::ProfileScope.
+	 * Every thread that records a zone gets its own lock-free ring buffer, which means that
+	 * recording a zone never blocks the audio, video or main thread. When the profiler is disabled
+	 * a zone costs a single relaxed atomic load. The profiler is disabled by default.
+	 *
+	 * nap::Core records a zone for every service preUpdate(), update() and postUpdate() call,
+	 * the application update call and the frame as a whole. The recorded zones can be inspected
+	 * live using Profiler::getStatistics() or exported as a Chrome trace / Perfetto JSON file
+	 * using Profiler::writeTrace(). Open the file using chrome://tracing or https://ui.perfetto.dev.
+	 *
+	 * The profiler is a singleton, use Profiler::instance() to access it.
+	 */
+	class NAPAPI Profiler final
+	{
+	public:
+		// Name of the zone that spans a complete Core::update() call
+		static constexpr const char* frameZone = "Core::update";
+
+		/**
+		 * @return the profiler
+		 */
+		static Profiler& instance();
+
+		/**
+		 * @return if zones are recorded
+		 */
+		static bool isEnabled()											{ return sEnabled.load(std::memory_order_relaxed); }
+
+		/**
+		 * Enable or disable recording of zones.
+		 * @param enable if zones are recorded
+		 */
+		static void setEnabled(bool enable)								{ sEnabled.store(enable, std::memory_order_relaxed); }
+
+		/**
+		 * Sets the display name of the calling thread, used when exporting a trace.
+		 * @param name name of the calling thread, for example: 'audio' or 'video decode'
+		 */
+		static void setThreadName(const std::string& name);
+
+		/**
+		 * @return number of nanoseconds since the profiler was created
+		 */
+		int64 getTime() const;
+
+		/**
+		 * Copies all recorded zones out of the thread buffers. Can be called from any thread.
+		 * @param outThreads all recorded zones, grouped by thread
+		 */
+		void collect(std::vector<ProfileThread>& outThreads) const;
+
+		/**
+		 * Aggregates all zones that ended within the given time window, grouped by name and category.
+		 * The result is sorted on total time spent, highest first.
+		 * @param window time window in seconds, relative to now
+		 * @param outStatistics the aggregated zones
+		 */
+		void getStatistics(double window, std::vector<ProfileStatistics>& outStatistics) const;
+
+		/**
+		 * Writes all recorded zones to a Chrome trace / Perfetto compatible JSON file.
+		 * @param path destination file on disk
+		 * @param error contains the error if the file could not be written
+		 * @return if the file was written
+		 */
+		bool writeTrace(const std::string& path, utility::ErrorState& error) const;
+
+		/**
+		 * Discards all recorded zones. Zones that are being recorded while clearing are kept.
+		 */
+		void clear();
+
+		/**
+		 * @return the ring buffer of the calling thread, created on first use.
+		 */
+		ProfileThreadBuffer& getThreadBuffer();
+
+	private:
+		Profiler();
+		Profiler(const Profiler&) = delete;
+		Profiler& operator=(const Profiler&) = delete;
+
+		static std::atomic<bool> sEnabled;								///< If zones are recorded
+		HighResTimeStamp mEpoch;										///< Point in time all zones are relative to
+		std::vector<std::unique_ptr<ProfileThreadBuffer>> mBuffers;		///< All thread buffers, never removed
+		mutable std::mutex mBufferMutex;								///< Guards the list of buffers
+	};
+
+
+	/**
+	 * Records the time spent in between construction and destruction as a zone, when the profiler is enabled.
+	 * The name and category are not copied and must outlive the recorded zone, use string literals where possible.
+	 * Use the NAP_PROFILE_SCOPE macro for convenience.
+	 */
+	class NAPAPI ProfileScope final
+	{
+	public:
+		/**
+		 * Starts the zone
+		 * @param name name of the zone
+		 * @param category optional category of the zone
+		 */
+		ProfileScope(const char* name, const char* category = nullptr)
+		{
+			if (Profiler::isEnabled())
+				begin(name, category);
+		}
+
+		/**
+		 * Ends the zone
+		 */
+		~ProfileScope()
+		{
+			if (mBuffer != nullptr)
+				end();
+		}
+
+		ProfileScope(const ProfileScope&) = delete;
+		ProfileScope& operator=(const ProfileScope&) = delete;
+
+	private:
+		void begin(const char* name, const char* category);
+		void end();
+
+		ProfileThreadBuffer* mBuffer = nullptr;
+		ProfileZone mZone;
+	};
+}
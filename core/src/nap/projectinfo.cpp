@@ -23,6 +23,8 @@ RTTI_BEGIN_CLASS(nap::ProjectInfo)
 	RTTI_PROPERTY("PathMapping", &nap::ProjectInfo::mPathMappingFile, nap::rtti::EPropertyMetaData::Required)
 	RTTI_PROPERTY("ServiceConfig", &nap::ProjectInfo::mServiceConfigFilename, nap::rtti::EPropertyMetaData::Default)
 	RTTI_PROPERTY("RequiredModules", &nap::ProjectInfo::mRequiredModules, nap::rtti::EPropertyMetaData::Required)
+	RTTI_PROPERTY("ParallelServiceUpdate", &nap::ProjectInfo::mParallelServiceUpdate, nap::rtti::EPropertyMetaData::Default)
+	RTTI_PROPERTY("ServiceUpdateThreads", &nap::ProjectInfo::mServiceUpdateThreads, nap::rtti::EPropertyMetaData::Default)
 RTTI_END_CLASS
 
 RTTI_BEGIN_CLASS(nap::ModuleInfo)
@@ -62,6 +62,8 @@ namespace nap
 		std::string mPathMappingFile;									///< Property: 'PathMapping' relative path to the path mapping file
 		std::string mServiceConfigFilename = {};						///< Property: 'ServiceConfig' optional relative path to service configuration file.
 		std::vector<std::string> mRequiredModules;						///< Property: 'RequiredModules' names of modules this project depends on
+		bool mParallelServiceUpdate = false;							///< Property: 'ParallelServiceUpdate' if thread-safe services are updated in parallel, see Core::enableParallelServiceUpdate()
+		uint32 mServiceUpdateThreads = 0;								///< Property: 'ServiceUpdateThreads' number of threads used to update services in parallel, 0 uses the number of hardware threads
 
 		/**
 		 * @return True if this process is running in an editor
@@ -0,0 +1,131 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Local Includes
+#include "signalslot.h"
+
+// External Includes
+#include <concurrentqueue.h>
+#include <atomic>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace nap
+{
+	/**
+	 * Signal that can be triggered from any thread, the connected slots, functions and signals are called later on the
+	 * thread that calls dispatch(), ie: from the update of the service or component that owns the signal.
+	 * The arguments are copied when the signal is triggered, pointers and references must remain valid until dispatch() is called.
+	 * The decayed argument types must be default constructible.
+	 * Connecting and disconnecting is only allowed on the thread that calls dispatch().
+	 *
+	 * Triggering is lock free and doesn't allocate, the queue is allocated up front with a fixed capacity.
+	 * The first trigger from a thread registers that thread with the queue, which allocates once.
+	 * When the queue is full the trigger is dropped, see getDroppedCount().
+	 * Use this to emit a signal from the audio thread or a worker thread without locking the receivers,
+	 * as long as copying the arguments doesn't allocate either.
+	 */
+	template <typename... Args>
+	class QueuedSignal final
+	{
+	public:
+		using Function = typename Signal<Args...>::Function;
+
+		/**
+		 * @param maxQueueItems max number of triggers that can be queued in between two dispatches.
+		 */
+		QueuedSignal(std::uint32_t maxQueueItems = 256) : mQueue(maxQueueItems)	{ }
+
+		/**
+		 * Queues the signal to be emitted on the next dispatch(), safe to call from any thread.
+		 * The trigger is dropped when the queue is full.
+		 */
+		void trigger(Args... args)
+		{
+			if (!mQueue.try_enqueue(Arguments(std::forward<Args>(args)...)))
+				mDroppedCount.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		/**
+		 * Call operator to queue the signal to be emitted, safe to call from any thread.
+		 */
+		inline void operator()(Args... args)
+		{
+			trigger(std::forward<Args>(args)...);
+		}
+
+		/**
+		 * Emits the signal once for every trigger since the last call.
+		 * Triggers from the same thread are emitted in the order the signal was triggered.
+		 * The signal is called on the calling thread. Triggers that occur during dispatch are emitted on the next dispatch.
+		 */
+		void dispatch();
+
+		/**
+		 * @return total number of triggers that were dropped because the queue was full
+		 */
+		std::uint64_t getDroppedCount() const								{ return mDroppedCount.load(std::memory_order_relaxed); }
+
+		/**
+		 * @return the signal that is emitted on dispatch, use it to connect slots, functions and other signals
+		 */
+		Signal<Args...>& getSignal()										{ return mSignal; }
+
+		/**
+		 * Connects a slot, function or signal to the signal that is emitted on dispatch, see Signal::connect()
+		 */
+		template <typename... T>
+		auto connect(T&&... args) -> decltype(std::declval<Signal<Args...>&>().connect(std::forward<T>(args)...))
+		{
+			return mSignal.connect(std::forward<T>(args)...);
+		}
+
+		/**
+		 * Disconnects a slot, function or signal from the signal that is emitted on dispatch, see Signal::disconnect()
+		 */
+		template <typename T>
+		void disconnect(T&& target)
+		{
+			mSignal.disconnect(std::forward<T>(target));
+		}
+
+	private:
+		using Arguments = std::tuple<typename std::decay<Args>::type...>;
+
+		template <std::size_t... Indices>
+		void emit(Arguments& arguments, std::index_sequence<Indices...>)
+		{
+			mSignal.trigger(std::get<Indices>(arguments)...);
+		}
+
+		Signal<Args...>							mSignal;						// Signal emitted on dispatch
+		moodycamel::ConcurrentQueue<Arguments>	mQueue;							// Arguments of every trigger since the last dispatch
+		Arguments								mArguments;						// Arguments being dispatched
+		std::atomic<std::uint64_t>				mDroppedCount = { 0 };			// Number of triggers dropped because the queue was full
+		bool									mDispatching = false;			// Prevents dispatching from a connected function
+	};
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Template Implementations
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename... Args>
+	void QueuedSignal<Args...>::dispatch()
+	{
+		if (mDispatching)
+			return;
+
+		// Only emit what is queued when dispatching starts
+		mDispatching = true;
+		std::size_t count = mQueue.size_approx();
+		while (count-- > 0 && mQueue.try_dequeue(mArguments))
+			emit(mArguments, std::index_sequence_for<Args...>());
+		mDispatching = false;
+	}
+}
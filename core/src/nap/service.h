@@ -68,6 +68,17 @@ namespace nap
 		 */
 		const std::string getTypeName() const;
 
+		/**
+		 * Override this method to declare that the update() call of this service is thread-safe.
+		 * When parallel service updates are enabled in core, see Core::enableParallelServiceUpdate(),
+		 * the update() call of a thread-safe service can be invoked from a worker thread,
+		 * at the same time as other services that are at the same level in the dependency graph.
+		 * Only return true when update() does not touch state owned by other services or the render thread,
+		 * and does not trigger signals: connected application and component slots expect to be called on the main thread.
+		 * @return if the update() call of this service can be invoked from a worker thread, false by default.
+		 */
+		virtual bool isUpdateThreadSafe() const											{ return false; }
+
 		/**
 		 * Copy is not allowed
 		 */
@@ -10,6 +10,10 @@
 #include <vector>
 #include <memory>
 #include <iostream>
+#include <cstdint>
+
+// Local includes
+#include "inlinefunction.h"
 
 // Pybind includes
 #include "python.h"
@@ -19,16 +23,44 @@ namespace nap
     
     // Forward declarations
 	template<typename... Args> class Slot;
+
+	/**
+	 * Handle to a function that is connected to a signal, used to disconnect the function again.
+	 * Disconnecting using a handle takes constant time. A handle remains safe to use after the function is disconnected,
+	 * disconnecting it a second time has no effect.
+	 */
+	struct SignalConnection
+	{
+		static constexpr uint32_t invalidIndex = 0xffffffff;
+
+		uint32_t mIndex = invalidIndex;				///< Index of the connection in the signal
+		uint32_t mGeneration = 0;					///< Generation of the connection, changes when the connection is removed
+
+		/**
+		 * @return if this handle was returned by a signal
+		 */
+		bool isValid() const						{ return mIndex != invalidIndex; }
+	};
+
     
     /**
      * A callable signal to which slots, functions or other signals can be connected to provide loose coupling.
      * The signal variadic template arguments to be able to work with different sets of arguments.
+     * Connections made while the signal is triggered are called the next time the signal is triggered.
+     * Connections removed while the signal is triggered are not called anymore.
+     * A signal is not thread safe: triggering, connecting and disconnecting must happen on one thread at a time.
+     * Use a nap::QueuedSignal to emit a signal from another thread.
      */
 	template <typename... Args>
 	class Signal final
 	{
 	public:
-		using Function = std::function<void(Args... args)>;
+		using Function = InlineFunction<void(Args... args)>;
+
+		// Construction
+		Signal() = default;
+		Signal(const Signal&) = delete;
+		Signal& operator=(const Signal&) = delete;
 
 		// Destruction
 		~Signal();
@@ -61,10 +93,18 @@ namespace nap
         /**
          * Connect a raw function object.
          * Note that when any captured data in a connected function is deleted this signal will be unsafe to call.
-         * Also disconnecting a raw function is not possible.
+         * Use the returned handle to disconnect the function.
          * Connecting a function is mainly only good practice when the scope of the signal is the same as the function's.
+         * @param inFunction the function to call when the signal is triggered
+         * @return handle to the connection
          */
-		void connect(const Function& inFunction);
+		SignalConnection connect(Function inFunction);
+
+		/**
+		 * Disconnect a function using the handle returned by connect()
+		 * @param connection handle to the connection
+		 */
+		void disconnect(const SignalConnection& connection);
 
 #ifdef NAP_ENABLE_PYTHON
         /**
@@ -74,12 +114,12 @@ namespace nap
 #endif // NAP_ENABLE_PYTHON
 
         /**
-         * Convenience method to connect a member function with one argument.
+         * Convenience method to connect a member function. The object and function are stored without allocating memory.
          */
 		template <typename U, typename F>
-		void connect(U* object, F memberFunction)
+		SignalConnection connect(U* object, F memberFunction)
 		{
-			connect(std::bind(memberFunction, object, std::placeholders::_1));
+			return connect(Function([object, memberFunction](Args... args) { (object->*memberFunction)(std::forward<Args>(args)...); }));
 		}
 
         /**
@@ -96,44 +136,56 @@ namespace nap
 		void trigger(Args... args);
 
 	private:
-		void addCause(Signal<Args...>& event);
-		void removeCause(Signal<Args...>& event);
-
-	private:
+		template<typename... Args_> friend class Slot;
 
-		// Data acts like a variant type with a few known types.  
+		// Entry acts like a variant type with a few known types.
 		// The reason for this approach is that we can use a single list
-		// of elements in Signal instead of having a separate list for each.
-		// This saves out a number of dynamic memory allocations and a large
-		// overhead in member data, without introducing any virtual function
-		// calls.
-		struct Data
+		// of elements in Signal instead of having a separate list for each,
+		// without introducing any virtual function calls.
+		// Entries never move to another index, a connected signal or slot
+		// stores the index of its entry to disconnect without searching.
+		struct Entry
 		{
-			union 
-			{
-				struct
-				{
-					Signal<Args...>* mSignal;
-				} Signal;
-
-				struct
-				{
-					Slot<Args...>* mSlot;
-				} Slot;
-			};
-
 			enum class EType : uint8_t
 			{
+				Free,
 				SignalCause,
 				SignalEffect,
-				SlotEffect
+				SlotEffect,
+				FunctionEffect
 			};
-			EType mType;
+
+			union
+			{
+				Signal<Args...>* mSignal;
+				Slot<Args...>* mSlot;
+			};
+
+			Function mFunction;											// Function effect
+			uint32_t mTargetIndex = SignalConnection::invalidIndex;		// Index of the entry in the connected signal or slot, next free entry when free
+			uint32_t mGeneration = 0;									// Incremented when the entry is removed
+			EType mType = EType::Free;
 		};
 
+		// Connection changes made while the signal is triggered, applied when triggering finishes
+		struct Deferred
+		{
+			std::vector<Entry>		mEntries;							// Entries added while triggering
+			std::vector<uint32_t>	mReleased;							// Entries removed while triggering
+		};
+
+		uint32_t addEntry(typename Entry::EType type);
+		void removeEntry(uint32_t index);
+		void releaseEntry(uint32_t index);
+		void applyDeferred();
+		uint32_t getEntryCount() const;
+		Entry& getEntry(uint32_t index);
+
 		// Members
-		std::vector<Data>						mData;					// Signal/slot effects, Signal causes
-		std::unique_ptr<std::vector<Function>>	mFunctionEffects;		// function objects
+		std::vector<Entry>						mEntries;										// Signal/slot/function effects, Signal causes
+		uint32_t								mFreeIndex = SignalConnection::invalidIndex;	// First free entry
+		uint32_t								mTriggerDepth = 0;								// Number of triggers in progress
+		std::unique_ptr<Deferred>				mDeferred;										// Created when connections change while triggering
 	};
 
 
@@ -147,34 +199,47 @@ namespace nap
 	class Slot final
 	{
 	public:
-		using Function = std::function<void(Args... args)>;
+		using Function = InlineFunction<void(Args... args)>;
 
 	public:
 		//@name Construction
 		Slot() = default;
 
 		Slot(Function inFunction) : 
-			mFunction(inFunction) 
+			mFunction(std::move(inFunction))
 		{
 		}
 
-		//! This templated constructor can be used to initialize the slot with a member function with one single
-		//! parameter
+		//! This templated constructor can be used to initialize the slot with a member function.
+		//! The object and function are stored without allocating memory.
 		template <typename U, typename F>
 		Slot(U* parent, F memberFunction) : 
-			mFunction(std::bind(memberFunction, parent, std::placeholders::_1))
+			mFunction([parent, memberFunction](Args... args) { (parent->*memberFunction)(std::forward<Args>(args)...); })
 		{
 		}
 
-		//! This templated constructor can be used to initialize the slot with a member function with one single
-		//! parameter, last argument is a signal to connect to straightaway after construction
+		//! This templated constructor can be used to initialize the slot with a member function,
+		//! last argument is a signal to connect to straightaway after construction
 		template <typename U, typename F>
 		Slot(U* parent, F memberFunction, Signal<Args...>& signal) : 
-			mFunction(std::bind(memberFunction, parent, std::placeholders::_1))
+			Slot(parent, memberFunction)
 		{
 			signal.connect(*this);
 		}
 
+		//! Copies the function, connections are not copied: use copyCauses() to connect to the same signals
+		Slot(const Slot& rhs) :
+			mFunction(rhs.mFunction)
+		{
+		}
+
+		//! Copies the function, the connections of this slot are left unchanged
+		Slot& operator=(const Slot& rhs)
+		{
+			mFunction = rhs.mFunction;
+			return *this;
+		}
+
 		~Slot()
 		{
 			disconnect();
@@ -187,7 +252,7 @@ namespace nap
 
 		void setFunction(Function func) 
 		{ 
-			mFunction = func; 
+			mFunction = std::move(func);
 		}
 
 		void trigger(Args... args)
@@ -198,20 +263,30 @@ namespace nap
 
 		void copyCauses(const Slot& rhs)
 		{
-			for (auto cause : rhs.mCauses)
-				cause->connect(*this);
+			auto count = rhs.mCauses.size();
+			for (std::size_t index = 0; index < count; ++index)
+				rhs.mCauses[index].mSignal->connect(*this);
 		}
 
 	private:
 		template<typename... Args_> friend class Signal;
 
-		void addCause(Signal<Args...>& event);
-		void removeCause(Signal<Args...>& event);
+		/**
+		 * Signal this slot is connected to and the index of the connection in that signal
+		 */
+		struct Cause
+		{
+			Signal<Args...>* mSignal;
+			uint32_t mIndex;
+		};
+
+		uint32_t addCause(Signal<Args...>& signal, uint32_t index);
+		int findCause(const Signal<Args...>& signal) const;
+		void removeCause(uint32_t causeIndex);
 
 	private:
-		typedef std::vector<Signal<Args...>*> SignalList;
 		Function mFunction;
-		SignalList mCauses;
+		std::vector<Cause> mCauses;
 	};
 
 
@@ -222,61 +297,124 @@ namespace nap
 	template <typename... Args>
 	Signal<Args...>::~Signal()
 	{
-		for (auto& data : mData)
+		if (mDeferred != nullptr)
+			applyDeferred();
+
+		for (auto& entry : mEntries)
 		{
-			if (data.mType == Data::EType::SignalCause)
-				data.Signal.mSignal->disconnect(*this);
-			else if (data.mType == Data::EType::SignalEffect)
-				data.Signal.mSignal->removeCause(*this);
-			else
-				data.Slot.mSlot->removeCause(*this);
+			if (entry.mType == Entry::EType::SignalCause || entry.mType == Entry::EType::SignalEffect)
+				entry.mSignal->removeEntry(entry.mTargetIndex);
+			else if (entry.mType == Entry::EType::SlotEffect)
+				entry.mSlot->removeCause(entry.mTargetIndex);
 		}
 	}
 
 	template <typename... Args>
-	void Signal<Args...>::addCause(Signal<Args...>& signal)
+	uint32_t Signal<Args...>::addEntry(typename Entry::EType type)
 	{
-		Data data;
-		data.mType = Data::EType::SignalCause;
-		data.Signal.mSignal = &signal;
-		mData.push_back(data);
+		uint32_t index;
+		if (mTriggerDepth > 0)
+		{
+			// Adding to the entries could move the function that is currently being called
+			if (mDeferred == nullptr)
+				mDeferred = std::make_unique<Deferred>();
+			index = mEntries.size() + mDeferred->mEntries.size();
+			mDeferred->mEntries.emplace_back();
+		}
+		else if (mFreeIndex != SignalConnection::invalidIndex)
+		{
+			index = mFreeIndex;
+			mFreeIndex = mEntries[index].mTargetIndex;
+		}
+		else
+		{
+			index = mEntries.size();
+			mEntries.emplace_back();
+		}
+
+		getEntry(index).mType = type;
+		return index;
 	}
 
 	template <typename... Args>
-	void Signal<Args...>::removeCause(Signal<Args...>& event)
+	void Signal<Args...>::removeEntry(uint32_t index)
 	{
-		for (int index = 0; index < mData.size(); ++index)
+		Entry& entry = getEntry(index);
+		entry.mType = Entry::EType::Free;
+		entry.mGeneration++;
+
+		// The function can't be destroyed while it might be running
+		if (mTriggerDepth > 0)
 		{
-			Data& value = mData[index];
-			if (value.mType == Data::EType::SignalCause && value.Signal.mSignal == &event)
-			{
-				mData.erase(mData.begin() + index);
-				break;
-			}
+			if (mDeferred == nullptr)
+				mDeferred = std::make_unique<Deferred>();
+			mDeferred->mReleased.push_back(index);
+		}
+		else
+		{
+			releaseEntry(index);
 		}
 	}
+
+	template <typename... Args>
+	void Signal<Args...>::releaseEntry(uint32_t index)
+	{
+		Entry& entry = mEntries[index];
+		entry.mFunction = nullptr;
+		entry.mTargetIndex = mFreeIndex;
+		mFreeIndex = index;
+	}
+
+	template <typename... Args>
+	void Signal<Args...>::applyDeferred()
+	{
+		for (auto& entry : mDeferred->mEntries)
+			mEntries.emplace_back(std::move(entry));
+		mDeferred->mEntries.clear();
+
+		for (auto index : mDeferred->mReleased)
+			releaseEntry(index);
+		mDeferred->mReleased.clear();
+	}
+
+	template <typename... Args>
+	uint32_t Signal<Args...>::getEntryCount() const
+	{
+		return mEntries.size() + (mDeferred != nullptr ? mDeferred->mEntries.size() : 0);
+	}
+
+	template <typename... Args>
+	typename Signal<Args...>::Entry& Signal<Args...>::getEntry(uint32_t index)
+	{
+		return index < mEntries.size() ? mEntries[index] : mDeferred->mEntries[index - mEntries.size()];
+	}
     
 	template <typename... Args>
 	void Signal<Args...>::connect(Signal<Args...>& signal)
 	{
-		Data data;
-		data.mType = Data::EType::SignalEffect;
-		data.Signal.mSignal = &signal;
-		mData.push_back(data);
+		uint32_t effect_index = addEntry(Entry::EType::SignalEffect);
+		uint32_t cause_index = signal.addEntry(Entry::EType::SignalCause);
+
+		Entry& effect = getEntry(effect_index);
+		effect.mSignal = &signal;
+		effect.mTargetIndex = cause_index;
 
-		signal.addCause(*this);
+		Entry& cause = signal.getEntry(cause_index);
+		cause.mSignal = this;
+		cause.mTargetIndex = effect_index;
 	}
 
 	template <typename... Args>
 	void Signal<Args...>::disconnect(Signal<Args...>& signal)
 	{
-		for (int index = 0; index < mData.size(); ++index)
+		uint32_t count = getEntryCount();
+		for (uint32_t index = 0; index < count; ++index)
 		{
-			Data& value = mData[index];
-			if (value.mType == Data::EType::SignalEffect && value.Signal.mSignal == &signal)
+			Entry& entry = getEntry(index);
+			if (entry.mType == Entry::EType::SignalEffect && entry.mSignal == &signal)
 			{
-				value.Signal.mSignal->removeCause(*this);
-				mData.erase(mData.begin() + index);
+				signal.removeEntry(entry.mTargetIndex);
+				removeEntry(index);
 				break;
 			}
 		}
@@ -285,37 +423,50 @@ namespace nap
 	template <typename... Args>
 	void Signal<Args...>::connect(Slot<Args...>& slot)
 	{
-		Data data;
-		data.mType = Data::EType::SlotEffect;
-		data.Slot.mSlot = &slot;
-		mData.push_back(data);
+		uint32_t index = addEntry(Entry::EType::SlotEffect);
+		uint32_t cause_index = slot.addCause(*this, index);
 
-		slot.addCause(*this);
+		Entry& entry = getEntry(index);
+		entry.mSlot = &slot;
+		entry.mTargetIndex = cause_index;
 	}
 
 	template <typename... Args>
 	void Signal<Args...>::disconnect(Slot<Args...>& slot)
 	{
-		for (int index = 0; index < mData.size(); ++index)
-		{
-			Data& data = mData[index];
-			if (data.mType == Data::EType::SlotEffect && data.Slot.mSlot == &slot)
-			{
-				data.Slot.mSlot->removeCause(*this);
-				mData.erase(mData.begin() + index);
-				break;
-			}
-		}
+		int cause_index = slot.findCause(*this);
+		if (cause_index < 0)
+			return;
+
+		uint32_t index = slot.mCauses[cause_index].mIndex;
+		slot.removeCause(cause_index);
+		removeEntry(index);
 	}
     
     
 	template <typename... Args>
-	void Signal<Args...>::connect(const Function& inFunction)
+	SignalConnection Signal<Args...>::connect(Function inFunction)
+	{
+		SignalConnection connection;
+		if (!inFunction)
+			return connection;
+
+		connection.mIndex = addEntry(Entry::EType::FunctionEffect);
+		Entry& entry = getEntry(connection.mIndex);
+		entry.mFunction = std::move(inFunction);
+		connection.mGeneration = entry.mGeneration;
+		return connection;
+	}
+
+	template <typename... Args>
+	void Signal<Args...>::disconnect(const SignalConnection& connection)
 	{
-		if (!mFunctionEffects)
-			mFunctionEffects = std::make_unique<std::vector<Function>>();
+		if (connection.mIndex >= getEntryCount())
+			return;
 
-		mFunctionEffects->emplace_back(inFunction);
+		Entry& entry = getEntry(connection.mIndex);
+		if (entry.mType == Entry::EType::FunctionEffect && entry.mGeneration == connection.mGeneration)
+			removeEntry(connection.mIndex);
 	}
     
 #ifdef NAP_ENABLE_PYTHON   
@@ -338,7 +489,7 @@ namespace nap
                 std::cout << message << std::endl;
             }
         };
-        connect(func);
+        connect(std::move(func));
     }
 #endif // NAP_ENABLE_PYTHON
     
@@ -346,43 +497,74 @@ namespace nap
 	template <typename... Args>
 	void Signal<Args...>::trigger(Args... args)
 	{
-		for (auto& data : mData)
+		if (mEntries.empty())
+			return;
+
+		// Only the entries that exist when triggering starts are visited
+		mTriggerDepth++;
+		std::size_t count = mEntries.size();
+		for (std::size_t index = 0; index < count; ++index)
 		{
-			if (data.mType == Data::EType::SignalEffect)
-				data.Signal.mSignal->trigger(std::forward<Args>(args)...);
-			else if (data.mType == Data::EType::SlotEffect)
-				data.Slot.mSlot->trigger(std::forward<Args>(args)...);
+			Entry& entry = mEntries[index];
+			switch (entry.mType)
+			{
+			case Entry::EType::SignalEffect:
+				entry.mSignal->trigger(std::forward<Args>(args)...);
+				break;
+			case Entry::EType::SlotEffect:
+				entry.mSlot->trigger(std::forward<Args>(args)...);
+				break;
+			case Entry::EType::FunctionEffect:
+				entry.mFunction(std::forward<Args>(args)...);
+				break;
+			default:
+				break;
+			}
 		}
 
-		if (mFunctionEffects)
-			for (auto& effect : *mFunctionEffects)
-				effect(std::forward<Args>(args)...);
+		if (--mTriggerDepth == 0 && mDeferred != nullptr)
+			applyDeferred();
 	}
 
 	template <typename... Args>
 	void Slot<Args...>::disconnect()
 	{
-		for (int index = mCauses.size() - 1; index >= 0; --index)
-			mCauses[index]->disconnect(*this);
+		while (!mCauses.empty())
+		{
+			Cause cause = mCauses.back();
+			mCauses.pop_back();
+			cause.mSignal->removeEntry(cause.mIndex);
+		}
+	}
+
+	template <typename... Args>
+	uint32_t Slot<Args...>::addCause(Signal<Args...>& signal, uint32_t index)
+	{
+		mCauses.push_back({ &signal, index });
+		return mCauses.size() - 1;
 	}
 
 	template <typename... Args>
-	void Slot<Args...>::addCause(Signal<Args...>& event)
+	int Slot<Args...>::findCause(const Signal<Args...>& signal) const
 	{
-		mCauses.push_back(&event);
+		for (int index = mCauses.size() - 1; index >= 0; --index)
+			if (mCauses[index].mSignal == &signal)
+				return index;
+		return -1;
 	}
 
 	template <typename... Args>
-	void Slot<Args...>::removeCause(Signal<Args...>& event)
+	void Slot<Args...>::removeCause(uint32_t causeIndex)
 	{
-		for (typename SignalList::iterator pos = mCauses.begin(); pos != mCauses.end(); ++pos)
+		// Move the last cause into the gap and tell its signal where the cause is now
+		uint32_t last_index = mCauses.size() - 1;
+		if (causeIndex != last_index)
 		{
-			if ((*pos) == &event)
-			{
-				mCauses.erase(pos);
-				break;
-			}
+			Cause& cause = mCauses[causeIndex];
+			cause = mCauses[last_index];
+			cause.mSignal->getEntry(cause.mIndex).mTargetIndex = causeIndex;
 		}
+		mCauses.pop_back();
 	}
 
 } // End Namespace nap
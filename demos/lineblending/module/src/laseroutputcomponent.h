@@ -6,6 +6,7 @@
 
 // Local Includes
 #include "etherdreamdac.h"
+#include "laserpath.h"
 
 // External Includes
 #include <component.h>
@@ -32,6 +33,7 @@ namespace nap
 		bool		mFlipVertical = false;				//< If the output should be flipped vertical
 		int			mFrameRate = 60;					//< Preferred framerate
 		float		mGapThreshold = 0.01f;				//< Threshold used to consider a gap between the begin and end vertex
+		LaserPathSettings mPathSettings;				//< Resample, dwell and blanking settings
 	};
 
 
@@ -59,9 +61,9 @@ namespace nap
 
 	/**
 	 * Converts and sends a polygon line to an ether-dream laser DAC
-	 * This component re-samples the polyline and creates additional points for gaps
-	 * between the beginning and ends of line segments. The final distribution
-	 * depends on the line to gap ratio of the line that is updated and sent.
+	 * This component re-samples the polyline using a nap::LaserPathBuilder, which limits the scan speed,
+	 * adds dwell points to sharp corners and blanks the gap between the beginning and end of an open line.
+	 * The total number of points per frame approximates the point rate of the DAC divided by the framerate.
 	 */
 	class NAPAPI LaserOutputComponentInstance : public ComponentInstance
 	{
@@ -106,7 +108,6 @@ namespace nap
 
 		// Converted laser points
 		std::vector<nap::EtherDreamPoint> mPoints;			//< DAC points
-		std::vector<glm::vec3> mVerts;						//< Converted vertex positions
-		std::vector<glm::vec4> mColors;						//< Converted vertex colors
+		LaserPathBuilder mPathBuilder;						//< Converts the line into laser points
 	};
 }
@@ -93,10 +93,6 @@ namespace nap
 
 	void LineBlendComponentInstance::cacheVertexAttributes(const LineSelectionComponentInstance& selector)
 	{
-		// Update distance sample map
-		std::map<float, int>& distances = mSelectorOne == &selector ? mDistancesLineOne : mDistancesLineTwo;
-		selector.getLine().getDistances(distances);
-
 		// Get vectors to cache
 		std::vector<glm::vec3>& positions = mSelectorOne == &selector ? mPositionsLineOne : mPoistionsLineTwo;
 		std::vector<glm::vec3>& normals = mSelectorOne == &selector ? mNormalsLineOne : mNormalsLineTwo;
@@ -113,23 +109,17 @@ namespace nap
 		int vertex_count = mTarget->getMeshInstance().getNumVertices();
 		assert(vertex_count > 1);
 		
-		positions.resize(vertex_count);
-		normals.resize(vertex_count);
-		uvs.resize(vertex_count);
-
-		// Value used to blend
+		// Calculate equally spaced sample locations along line
 		float inc = 1.0f / static_cast<float>(vertex_count - 1);
-
+		mLocations.resize(vertex_count);
 		for (int i = 0; i < vertex_count; i++)
-		{
-			// Calculate inc value along line
-			float c_inc = static_cast<float>(i) * inc;
+			mLocations[i] = math::min<float>(static_cast<float>(i) * inc, 1.0f);
 
-			// Get interpolated data
-			current_line.getValue<glm::vec3>(distances, pos_attr, c_inc, positions[i]);
-			current_line.getNormal(distances, nor_attr, c_inc, normals[i]);
-			current_line.getValue<glm::vec3>(distances, uvs_attr, c_inc, uvs[i]);
-		}
+		// Resolve samples once and interpolate all attributes
+		current_line.getSamples(mLocations.data(), vertex_count, mSamples);
+		current_line.getValues<glm::vec3>(pos_attr, mSamples, positions);
+		current_line.getNormals(nor_attr, mSamples, normals);
+		current_line.getValues<glm::vec3>(uvs_attr, mSamples, uvs);
 	}
 
 
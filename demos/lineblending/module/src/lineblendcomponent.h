@@ -103,8 +103,8 @@ namespace nap
 		ComponentInstancePtr<LineSelectionComponent> mSelectorOne = { this, &LineBlendComponent::mSelectionComponentOne };
 		ComponentInstancePtr<LineSelectionComponent> mSelectorTwo = { this, &LineBlendComponent::mSelectionComponentTwo };
 
-		std::map<float, int>			mDistancesLineOne;			// Distance values associated with line 1
-		std::map<float, int>			mDistancesLineTwo;			// Distance values associated with line 2
+		std::vector<float>				mLocations;					// Sample locations along the selected line
+		std::vector<math::LineSample>	mSamples;					// Resolved samples along the selected line
 
 		std::vector<glm::vec3>			mPositionsLineOne;			// Interpolated positions of the first selected line
 		std::vector<glm::vec3>			mPoistionsLineTwo;			// Interpolated positions of the second selected line
@@ -82,6 +82,8 @@ namespace nap
 
 		// Begin with pigmesh as object to paint on
 		mSelectedMeshRendererID = "PigRenderer";
+		const MeshInstance& mesh = mWorldEntity->findComponentByID<nap::RenderableMeshComponentInstance>(mSelectedMeshRendererID)->getMeshInstance();
+		mMeshBVH.build(mesh, mesh.getAttribute<glm::vec3>(vertexid::position));
 
 		// Create parameter GUI, used to draw parameters
 		mParameterGUI = std::make_unique<ParameterGUI>(*mParameterService);
@@ -409,9 +411,8 @@ namespace nap
 	 * Performs a ray-cast and looks for any intersecting triangles
 	 * When intersection occurs, lookup the UV coordinate of the mouse position on the object
 	 * This will be the position we use to add paint in UV space.
-	 * Depending on the complexity of the geometry this call can be slow, as it currently iterates
-	 * over all triangles until it finds a possible match. Can be optimized using faster indexing methods such
-	 * as a KD-tree etc. 
+	 * The ray is traced against a bounding volume hierarchy of the selected mesh, which is built when
+	 * the mesh is selected. This keeps tracing fast, regardless of the complexity of the geometry.
 	 * @param event the pointer event
 	 */
 	void PaintObjectApp::doTrace(const PointerEvent& event)
@@ -430,10 +431,8 @@ namespace nap
 		// Get object to world transformation matrix
 		TransformComponentInstance& world_xform = mWorldEntity->getComponent<TransformComponentInstance>();
 
-		// Get the attributes we need, the vertices (position data) is used to perform a world space triangle intersection
-		// The uv attribute is to compute the uv coordinates when a triangle is hit
+		// Get the uv attribute, used to compute the uv coordinates when a triangle is hit
 		MeshInstance& mesh = mWorldEntity->findComponentByID<nap::RenderableMeshComponentInstance>(mSelectedMeshRendererID)->getMeshInstance();
-		VertexAttribute<glm::vec3>& vertices = mesh.getOrCreateAttribute<glm::vec3>(vertexid::position);
 		VertexAttribute<glm::vec3>& uvs = mesh.getOrCreateAttribute<glm::vec3>(vertexid::getUVName(0));
 
 		// Get ray from screen in to scene (world space)
@@ -444,31 +443,20 @@ namespace nap
 		// World space camera position
 		glm::vec3 cam_pos = math::extractPosition(camera_xform.getGlobalTransform());
 
-		// Used by intersection call
-		TriangleData<glm::vec3> tri_vertices;
+		// Transform the ray into object space, the bounding volume hierarchy is built in object space.
+		// The direction is not normalized, the ray factor is therefore the same in object and world space.
+		glm::mat4 world_to_object = glm::inverse(world_xform.getGlobalTransform());
+		glm::vec3 ray_origin = glm::vec3(world_to_object * glm::vec4(cam_pos, 1.0f));
+		glm::vec3 ray_direction = glm::vec3(world_to_object * glm::vec4(screen_to_world_ray, 0.0f));
 
-		// Create the triangle iterator
-		TriangleIterator triangle_it(mesh);
-
-		// Perform intersection test, walk over every triangle in the mesh
-		mMouseOnObject = false;
-		while (!triangle_it.isDone())
+		// Perform intersection test against the hierarchy instead of every triangle in the mesh
+		MeshHit hit;
+		mMouseOnObject = mMeshBVH.intersect(ray_origin, ray_direction, hit);
+		if (mMouseOnObject)
 		{
-			// Use the indices to get the vertex positions
-			Triangle triangle = triangle_it.next();
-
-			tri_vertices[0] = (math::objectToWorld(vertices[triangle[0]], world_xform.getGlobalTransform()));
-			tri_vertices[1] = (math::objectToWorld(vertices[triangle[1]], world_xform.getGlobalTransform()));
-			tri_vertices[2] = (math::objectToWorld(vertices[triangle[2]], world_xform.getGlobalTransform()));
-
-			glm::vec3 bary_coord;
-			if (utility::intersect(cam_pos, screen_to_world_ray, tri_vertices, bary_coord))
-			{
-				TriangleData<glm::vec3> uv_triangle_data = triangle.getVertexData(uvs);
-				mMousePosOnObject = utility::interpolateVertexAttr<glm::vec3>(uv_triangle_data, bary_coord);
-				mMouseOnObject = true;
-				break;
-			}
+			const uint32* indices = mMeshBVH.getTriangleIndices(hit.mTriangle);
+			TriangleData<glm::vec3> uv_triangle_data(uvs[indices[0]], uvs[indices[1]], uvs[indices[2]]);
+			mMousePosOnObject = utility::interpolateVertexAttr<glm::vec3>(uv_triangle_data, hit.mCoordinates);
 		}
 	}
 
@@ -491,6 +479,10 @@ namespace nap
 			break;
 		}
 
+		// Build hierarchy used to trace the selected mesh
+		const MeshInstance& mesh = mWorldEntity->findComponentByID<nap::RenderableMeshComponentInstance>(mSelectedMeshRendererID)->getMeshInstance();
+		mMeshBVH.build(mesh, mesh.getAttribute<glm::vec3>(vertexid::position));
+
 		mClearPaint = true;
 	}
 
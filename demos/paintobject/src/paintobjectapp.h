@@ -22,6 +22,7 @@
 #include <parameternumeric.h>
 #include <parametercolor.h>
 #include <parametergui.h>
+#include <meshbvh.h>
 
 namespace nap
 {
@@ -148,6 +149,7 @@ namespace nap
 
 		// Selected mesh renderer
 		std::string mSelectedMeshRendererID;
+		MeshBVH mMeshBVH;								//< Accelerates tracing the selected mesh
 		int mPaintIndex = 0;
 
 		// Handle debug popup
@@ -135,12 +135,12 @@ namespace nap
 		{
 		case EWebSocketForwardMode::WebSocketEvent:
 		{
-			addEvent(std::make_unique<WebSocketMessageReceivedEvent>(mConnection, msg));
+			addMessageEvent(mConnection, msg);
 			return;
 		}
 		case EWebSocketForwardMode::Both:
 		{
-			addEvent(std::make_unique<WebSocketMessageReceivedEvent>(mConnection, msg));
+			addMessageEvent(mConnection, msg);
 			break;
 		}
 		default:
@@ -81,12 +81,12 @@ namespace nap
 		{
 		case EWebSocketForwardMode::WebSocketEvent:
 		{
-			addEvent(std::make_unique<WebSocketMessageReceivedEvent>(connection, message));
+			addMessageEvent(connection, message);
 			return;
 		}
 		case EWebSocketForwardMode::Both:
 		{
-			addEvent(std::make_unique<WebSocketMessageReceivedEvent>(connection, message));
+			addMessageEvent(connection, message);
 			break;
 		}
 		default:
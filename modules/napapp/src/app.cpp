@@ -20,6 +20,34 @@ namespace nap
 	}
 
 
+	void BaseApp::enableFixedTimeStep(double timeStep, int maxSteps)
+	{
+		assert(timeStep > 0.0 && maxSteps > 0);
+		mFixedTimeStep = timeStep;
+		mMaxFixedSteps = maxSteps;
+		mTimeStep.reset();
+	}
+
+
+	void BaseApp::disableFixedTimeStep()
+	{
+		mFixedTimeStep = 0.0;
+		mTimeStep.reset();
+	}
+
+
+	void BaseApp::advance(double deltaTime)
+	{
+		if (fixedTimeStepEnabled())
+		{
+			int steps = mTimeStep.advance(deltaTime, mFixedTimeStep, mMaxFixedSteps);
+			for (int i = 0; i < steps; i++)
+				fixedUpdate(mFixedTimeStep);
+		}
+		update(deltaTime);
+	}
+
+
 	App::App(Core& core) : BaseApp(core)
 	{
 
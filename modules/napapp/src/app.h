@@ -12,6 +12,9 @@
 #include <windowevent.h>
 #include <mathutils.h>
 
+// Local includes
+#include "framepacer.h"
+
 namespace nap
 {
 	/**
@@ -57,6 +60,15 @@ namespace nap
 		 */
 		virtual void update(double deltaTime)							{ }
 
+		/**
+		 * Advance your simulation by a fixed amount of time.
+		 * Only called when a fixed time step is enabled, see enableFixedTimeStep().
+		 * Called zero or more times per frame, depending on the elapsed time, before update().
+		 * Use getFixedTimeStepAlpha() in update() or render() to interpolate in between simulation states.
+		 * @param deltaTime the fixed time step in seconds
+		 */
+		virtual void fixedUpdate(double deltaTime)						{ }
+
 		/**
 		 * Render your application. This is called after update at the end of the loop
 		 */
@@ -137,11 +149,53 @@ namespace nap
 		 */
 		bool framerateCapped() const									{ return mCapFramerate; }
 
+		/**
+		 * Enables fixed time step simulation. Every frame fixedUpdate() is called zero or more times with
+		 * the given time step, depending on the time elapsed since the previous frame, before update() is called.
+		 * The number of fixed updates per frame is limited to prevent the simulation from falling further
+		 * behind every frame when a single step takes longer than the time step.
+		 * @param timeStep duration of a single simulation step in seconds
+		 * @param maxSteps maximum number of fixed updates per frame
+		 */
+		void enableFixedTimeStep(double timeStep, int maxSteps = 8);
+
+		/**
+		 * Disables fixed time step simulation, fixedUpdate() is no longer called.
+		 */
+		void disableFixedTimeStep();
+
+		/**
+		 * @return if fixed time step simulation is enabled
+		 */
+		bool fixedTimeStepEnabled() const								{ return mFixedTimeStep > 0.0; }
+
+		/**
+		 * @return duration of a single simulation step in seconds, 0 when disabled
+		 */
+		double getFixedTimeStep() const									{ return mFixedTimeStep; }
+
+		/**
+		 * Returns the time that is not yet simulated as a fraction of the fixed time step, 0-1.
+		 * Use this value to interpolate in between the previous and current simulation state when rendering.
+		 * @return interpolation factor in between the previous and current simulation state
+		 */
+		float getFixedTimeStepAlpha() const								{ return mTimeStep.getAlpha(); }
+
+		/**
+		 * Invoked by the app runner every frame from within the core update loop.
+		 * Calls fixedUpdate() when a fixed time step is enabled, followed by update().
+		 * @param deltaTime the time in seconds between calls
+		 */
+		void advance(double deltaTime);
+
 	private:
 		bool mQuit = false;												// When set to true the application will exit
 		nap::Core& mCore;												// Core
 		float mRequestedFramerate = 60.0f;								// Requested framerate, only applied when mCapFramerate is enabled.
 		bool mCapFramerate = false;										// If the framerate should be capped.
+		double mFixedTimeStep = 0.0;									// Fixed simulation time step in seconds, 0 when disabled
+		int mMaxFixedSteps = 8;											// Maximum number of fixed updates per frame
+		FixedTimeStep mTimeStep;										// Accumulates frame time into fixed steps
 	};
 
 
@@ -7,6 +7,7 @@
 // Local Includes
 #include "app.h"
 #include "appeventhandler.h"
+#include "framepacer.h"
 
 // External Includes
 #include <rtti/typeinfo.h>
@@ -85,12 +86,19 @@ namespace nap
 		 */
 		int exitCode() const								{ return mExitCode; }
 
+		/**
+		 * Paces the application loop when the framerate is capped and records the frame time histogram.
+		 * @return the frame pacer
+		 */
+		const FramePacer& getFramePacer() const				{ return mFramePacer; }
+
 	private:
 		nap::Core&					mCore;					// Core
 		std::unique_ptr<APP>		mApp = nullptr;			// App this runner works with
 		std::unique_ptr<HANDLER>	mHandler = nullptr;		// App handler this runner works with
 		bool						mStop = false;			// If the runner should stop
 		int							mExitCode = 0;			// Application exit code* Call update() to force an update.
+		FramePacer					mFramePacer;			// Paces the loop, records frame times
 	};
 
 
@@ -180,21 +188,15 @@ namespace nap
 		app_event_handler.start();
 
 		// Pointer to function used inside update call by core
-		std::function<void(double)> update_call = std::bind(&APP::update, mApp.get(), std::placeholders::_1);
+		std::function<void(double)> update_call = std::bind(&BaseApp::advance, mApp.get(), std::placeholders::_1);
 
 		// Start core
 		mCore.start();
 
 		// Begin running
-		HighResolutionTimer timer;
-		Milliseconds frame_time, delay_time, zero_delay(0);
+		mFramePacer.reset();
 		while (!app.shouldQuit() && !mStop)
 		{
-			// Get point in time when frame is requested to be completed
-			frame_time = timer.getMillis() + (app.framerateCapped() ? 
-				Milliseconds(static_cast<long>(1000.0 / static_cast<double>(app.getRequestedFramerate()))) :
-				zero_delay);
-			 
 			// Process app specific messages
 			app_event_handler.process();
 
@@ -204,13 +206,13 @@ namespace nap
 			// render
 			app.render();
 
-			// Only sleep when there is at least 1 millisecond that needs to be compensated for
-			// The actual outcome of the sleep call can vary greatly from system to system
-			// And is more accurate with lower framerate limitations
-			delay_time = frame_time - timer.getMillis();
-			if(delay_time.count() > 0)
-				std::this_thread::sleep_for(delay_time);
+			// Wait for the frame deadline when capped, sleeps and spins to hit the deadline accurately
+			if (app.framerateCapped())
+				mFramePacer.wait(app.getRequestedFramerate());
+			else
+				mFramePacer.frame();
 		}
+		nap::Logger::debug("Frame times: %s", mFramePacer.getHistogram().toString().c_str());
 
 		// Stop handling events
 		app_event_handler.shutdown();
@@ -0,0 +1,181 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "framepacer.h"
+
+// External Includes
+#include <utility/stringutils.h>
+#include <algorithm>
+#include <cassert>
+#include <thread>
+
+namespace nap
+{
+	constexpr int FrameHistogram::binCount;
+	constexpr double FrameHistogram::binWidth;
+
+	// Bounds of the adaptive spin window in milliseconds
+	static constexpr double minSpinWindow = 0.25;
+	static constexpr double maxSpinWindow = 4.0;
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// FrameHistogram
+	//////////////////////////////////////////////////////////////////////////
+
+	void FrameHistogram::record(double milliseconds)
+	{
+		int bin = std::min<int>(static_cast<int>(std::max<double>(milliseconds, 0.0) / binWidth), binCount - 1);
+		mBins[bin]++;
+		mMin = mCount == 0 ? milliseconds : std::min<double>(mMin, milliseconds);
+		mMax = std::max<double>(mMax, milliseconds);
+		mTotal += milliseconds;
+		mCount++;
+	}
+
+
+	void FrameHistogram::reset()
+	{
+		mBins.fill(0);
+		mCount = 0;
+		mTotal = 0.0;
+		mMin = 0.0;
+		mMax = 0.0;
+	}
+
+
+	double FrameHistogram::getAverage() const
+	{
+		return mCount > 0 ? mTotal / static_cast<double>(mCount) : 0.0;
+	}
+
+
+	double FrameHistogram::getPercentile(float percentile) const
+	{
+		if (mCount == 0)
+			return 0.0;
+
+		uint64 target = static_cast<uint64>(static_cast<double>(mCount) * std::min<float>(std::max<float>(percentile, 0.0f), 1.0f));
+		uint64 count = 0;
+		for (int i = 0; i < binCount; i++)
+		{
+			count += mBins[i];
+			if (count >= target)
+				return i < binCount - 1 ? std::min<double>(static_cast<double>(i + 1) * binWidth, mMax) : mMax;
+		}
+		return mMax;
+	}
+
+
+	std::string FrameHistogram::toString() const
+	{
+		return utility::stringFormat("frames: %llu, avg: %.03f ms, min: %.03f ms, max: %.03f ms, p50: %.02f ms, p95: %.02f ms, p99: %.02f ms",
+			static_cast<unsigned long long>(mCount), getAverage(), getMin(), getMax(),
+			getPercentile(0.5f), getPercentile(0.95f), getPercentile(0.99f));
+	}
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// FramePacer
+	//////////////////////////////////////////////////////////////////////////
+
+	FramePacer::FramePacer()
+	{
+		reset();
+	}
+
+
+	void FramePacer::reset()
+	{
+		mDeadline = HighResolutionClock::now();
+		mLastFrame = mDeadline;
+		mHistogram.reset();
+	}
+
+
+	void FramePacer::wait(float framerate)
+	{
+		auto interval = std::chrono::duration_cast<HighResolutionClock::duration>(
+			std::chrono::duration<double>(1.0 / static_cast<double>(std::max<float>(framerate, 1.0f))));
+
+		// Schedule relative to previous deadline, reset schedule when more than a frame behind
+		mDeadline += interval;
+		HighResTimeStamp now = HighResolutionClock::now();
+		if (now - mDeadline > interval)
+			mDeadline = now;
+		else
+			waitUntil(mDeadline);
+
+		record();
+	}
+
+
+	void FramePacer::frame()
+	{
+		mDeadline = HighResolutionClock::now();
+		record();
+	}
+
+
+	void FramePacer::waitUntil(const HighResTimeStamp& deadline)
+	{
+		// Sleep until the spin window is reached, sleep accuracy varies greatly from system to system.
+		// Track how much a sleep overshoots and adapt the spin window accordingly.
+		auto spin_window = std::chrono::duration<double, std::milli>(mSpinWindow);
+		HighResTimeStamp now = HighResolutionClock::now();
+		while (deadline - now > spin_window)
+		{
+			auto sleep_time = std::chrono::duration_cast<MicroSeconds>(deadline - now - spin_window);
+			std::this_thread::sleep_for(sleep_time);
+			HighResTimeStamp woke = HighResolutionClock::now();
+
+			double overshoot = std::chrono::duration<double, std::milli>((woke - now) - sleep_time).count();
+			mSpinWindow = std::min<double>(std::max<double>(mSpinWindow * 0.9 + overshoot * 0.2, minSpinWindow), maxSpinWindow);
+			now = woke;
+		}
+
+		// Spin for the remainder
+		while (HighResolutionClock::now() < deadline)
+			std::this_thread::yield();
+	}
+
+
+	void FramePacer::record()
+	{
+		HighResTimeStamp now = HighResolutionClock::now();
+		mHistogram.record(std::chrono::duration<double, std::milli>(now - mLastFrame).count());
+		mLastFrame = now;
+	}
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// FixedTimeStep
+	//////////////////////////////////////////////////////////////////////////
+
+	int FixedTimeStep::advance(double deltaTime, double timeStep, int maxSteps)
+	{
+		assert(timeStep > 0.0);
+		mAccumulator += deltaTime;
+		int steps = static_cast<int>(mAccumulator / timeStep);
+		if (steps > maxSteps)
+		{
+			steps = maxSteps;
+			mAccumulator = 0.0;
+		}
+		else
+		{
+			mAccumulator -= static_cast<double>(steps) * timeStep;
+		}
+		mAlpha = static_cast<float>(mAccumulator / timeStep);
+		return steps;
+	}
+
+
+	void FixedTimeStep::reset()
+	{
+		mAccumulator = 0.0;
+		mAlpha = 0.0f;
+	}
+}
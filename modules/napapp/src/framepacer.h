@@ -0,0 +1,183 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// External Includes
+#include <nap/datetime.h>
+#include <nap/numeric.h>
+#include <utility/dllexport.h>
+#include <array>
+#include <string>
+
+namespace nap
+{
+	/**
+	 * Collects frame times in fixed size bins of 0.25 milliseconds, up to 64 milliseconds.
+	 * Frame times longer than 64 milliseconds are stored in the last bin.
+	 * Used to measure the stability of the application loop.
+	 */
+	class NAPAPI FrameHistogram final
+	{
+	public:
+		// Number of bins in the histogram
+		static constexpr int binCount = 256;
+
+		// Width of a bin in milliseconds
+		static constexpr double binWidth = 0.25;
+
+		/**
+		 * Adds a frame time to the histogram
+		 * @param milliseconds frame time in milliseconds
+		 */
+		void record(double milliseconds);
+
+		/**
+		 * Removes all recorded frame times
+		 */
+		void reset();
+
+		/**
+		 * @return number of recorded frames
+		 */
+		uint64 getCount() const												{ return mCount; }
+
+		/**
+		 * @return average frame time in milliseconds
+		 */
+		double getAverage() const;
+
+		/**
+		 * @return longest recorded frame time in milliseconds
+		 */
+		double getMax() const												{ return mMax; }
+
+		/**
+		 * @return shortest recorded frame time in milliseconds
+		 */
+		double getMin() const												{ return mCount > 0 ? mMin : 0.0; }
+
+		/**
+		 * Returns the frame time below which the given percentage of frames fall, for example: 0.99
+		 * The accuracy of the result is limited to the bin width.
+		 * @param percentile percentage of frames, 0-1
+		 * @return the frame time in milliseconds
+		 */
+		double getPercentile(float percentile) const;
+
+		/**
+		 * @return all bins, every bin holds the number of frames that fall in that bin.
+		 */
+		const std::array<uint64, binCount>& getBins() const					{ return mBins; }
+
+		/**
+		 * @return a human readable summary of the histogram: average, min, max and percentiles.
+		 */
+		std::string toString() const;
+
+	private:
+		std::array<uint64, binCount> mBins = {};
+		uint64 mCount = 0;
+		double mTotal = 0.0;
+		double mMin = 0.0;
+		double mMax = 0.0;
+	};
+
+
+	/**
+	 * Paces the application loop to a requested framerate.
+	 *
+	 * Frame deadlines are scheduled relative to the previous deadline, not relative to the end of the frame,
+	 * which prevents the framerate from drifting. To hit a deadline accurately the pacer sleeps until
+	 * shortly before the deadline and spins for the remainder. The spin window adapts to the measured
+	 * sleep accuracy of the system. When a deadline is missed by more than a frame, the schedule is reset.
+	 * Every frame time is recorded in a nap::FrameHistogram.
+	 */
+	class NAPAPI FramePacer final
+	{
+	public:
+		/**
+		 * Constructor, starts the schedule.
+		 */
+		FramePacer();
+
+		/**
+		 * Blocks until the deadline of the current frame is reached, based on the given framerate.
+		 * @param framerate the requested number of frames per second
+		 */
+		void wait(float framerate);
+
+		/**
+		 * Marks the end of a frame without waiting, call this when the framerate is not capped.
+		 */
+		void frame();
+
+		/**
+		 * Restarts the schedule and clears the frame time histogram.
+		 */
+		void reset();
+
+		/**
+		 * @return histogram of frame times, measured in between calls to wait() or frame().
+		 */
+		const FrameHistogram& getHistogram() const							{ return mHistogram; }
+
+		/**
+		 * @return the current spin window in milliseconds, based on the measured sleep overshoot.
+		 */
+		double getSpinWindow() const										{ return mSpinWindow; }
+
+		/**
+		 * Blocks the calling thread until the given point in time, using a hybrid of sleeping and spinning.
+		 * @param deadline point in time to wait for
+		 */
+		void waitUntil(const HighResTimeStamp& deadline);
+
+	private:
+		/**
+		 * Records the time since the previous frame
+		 */
+		void record();
+
+		HighResTimeStamp mDeadline;					///< Deadline of the current frame
+		HighResTimeStamp mLastFrame;				///< Point in time the last frame ended
+		FrameHistogram mHistogram;					///< Frame time histogram
+		double mSpinWindow = 2.0;					///< Time in milliseconds spent spinning before a deadline
+	};
+
+
+	/**
+	 * Accumulates variable frame times into fixed time steps.
+	 * Use this to run a simulation at a fixed rate, independent of the framerate.
+	 * The remainder, as a fraction of the time step, can be used to interpolate in between simulation states.
+	 */
+	class NAPAPI FixedTimeStep final
+	{
+	public:
+		/**
+		 * Adds the elapsed time to the accumulator and returns the number of fixed steps to take.
+		 * The number of steps is limited to prevent the simulation from falling further behind every frame,
+		 * time that is not consumed because of that limit is discarded.
+		 * @param deltaTime elapsed time in seconds
+		 * @param timeStep duration of a single step in seconds
+		 * @param maxSteps maximum number of steps to take
+		 * @return number of steps to take
+		 */
+		int advance(double deltaTime, double timeStep, int maxSteps);
+
+		/**
+		 * @return the time that is not yet consumed as a fraction of the time step, 0-1
+		 */
+		float getAlpha() const												{ return mAlpha; }
+
+		/**
+		 * Clears the accumulator
+		 */
+		void reset();
+
+	private:
+		double mAccumulator = 0.0;
+		float mAlpha = 0.0f;
+	};
+}
@@ -0,0 +1,163 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Local Includes
+#include "servicerunner.h"
+#include "framepacer.h"
+
+// External Includes
+#include <nap/logger.h>
+
+namespace nap
+{
+	/**
+	 * Utility class that runs a nap::BaseApp with a fixed time step, as fast as possible.
+	 * Every frame core is updated with the same fixed delta time, regardless of how long the frame took to compute.
+	 * This makes the runner suitable for offline rendering and for measuring the throughput of the update loop,
+	 * for example on a build machine without a display or audio device.
+	 * Note that only the delta time is fixed: services and components that read the wall clock,
+	 * for example through Core::getElapsedTime(), still observe real time.
+	 *
+	 * The runner uses a nap::ServiceRunner to initialize, update and shut down core and the app.
+	 * The time it takes to compute every frame is recorded in a nap::FrameHistogram.
+	 *
+	 * The APP template argument should be derived from nap::BaseApp.
+	 * The HANDLER template argument should be of type nap::AppEventHandler()
+	 *
+	 *~~~~~{.cpp}
+	 * nap::HeadlessRunner<MyApp, nap::AppEventHandler> runner(core);
+	 * if (!runner.start(1000, 1.0 / 60.0, error))
+	 *		return -1;
+	 * nap::Logger::info("%.02f frames per second", runner.getThroughput());
+	 *~~~~~
+	 */
+	template<typename APP, typename HANDLER>
+	class HeadlessRunner
+	{
+	public:
+		/**
+		 * Constructor
+		 * @param core the nap core this runner uses in conjunction with the app and handler
+		 * @param render if BaseApp::render() is called after every update
+		 */
+		HeadlessRunner(nap::Core& core, bool render = true);
+
+		/**
+		 * Copy is not allowed
+		 */
+		HeadlessRunner(HeadlessRunner&) = delete;
+		HeadlessRunner& operator=(const HeadlessRunner&) = delete;
+
+		/**
+		 * Move is not allowed
+		 */
+		HeadlessRunner(HeadlessRunner&&) = delete;
+		HeadlessRunner& operator=(HeadlessRunner&&) = delete;
+
+		/**
+		 * Initializes core and the application, runs the requested number of frames and shuts down.
+		 * Every frame core is advanced by the given delta time. Frames are computed as fast as possible.
+		 * The loop also stops when BaseApp::quit() or HeadlessRunner::stop() is called.
+		 * @param frameCount number of frames to compute, 0 to run until the app quits
+		 * @param deltaTime the time in seconds core is advanced every frame
+		 * @param error the error message if the loop couldn't be started
+		 * @return if the loop ran successfully
+		 */
+		bool start(uint32 frameCount, double deltaTime, utility::ErrorState& error);
+
+		/**
+		 * Stops the loop after the current frame
+		 */
+		void stop()											{ mStop = true; }
+
+		/**
+		 * @return the app
+		 */
+		APP& getApp()										{ return mRunner.getApp(); }
+
+		/**
+		 * @return the app handler
+		 */
+		HANDLER& getHandler()								{ return mRunner.getHandler(); }
+
+		/**
+		 * @return the application exit code
+		 */
+		int exitCode() const								{ return mRunner.exitCode(); }
+
+		/**
+		 * @return number of computed frames
+		 */
+		uint64 getFrameCount() const						{ return mHistogram.getCount(); }
+
+		/**
+		 * @return histogram of the time in milliseconds it took to compute every frame.
+		 */
+		const FrameHistogram& getHistogram() const			{ return mHistogram; }
+
+		/**
+		 * @return average number of frames computed per second of wall clock time.
+		 */
+		double getThroughput() const;
+
+	private:
+		ServiceRunner<APP, HANDLER> mRunner;				// Initializes, updates and stops core and the app
+		FrameHistogram mHistogram;							// Wall clock time of every frame
+		double mElapsedTime = 0.0;							// Total wall clock time spent in the loop
+		bool mRender = true;								// If the app is rendered every frame
+		bool mStop = false;									// If the runner should stop
+	};
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Template definitions
+	//////////////////////////////////////////////////////////////////////////
+
+	template<typename APP, typename HANDLER>
+	nap::HeadlessRunner<APP, HANDLER>::HeadlessRunner(nap::Core& core, bool render) :
+		mRunner(core), mRender(render)
+	{ }
+
+
+	template<typename APP, typename HANDLER>
+	bool nap::HeadlessRunner<APP, HANDLER>::start(uint32 frameCount, double deltaTime, utility::ErrorState& error)
+	{
+		if (!error.check(deltaTime > 0.0, "Delta time must be greater than 0"))
+			return false;
+
+		if (!mRunner.init(error))
+			return false;
+
+		// Compute frames as fast as possible
+		BaseApp& app = getApp();
+		mHistogram.reset();
+		HighResolutionTimer loop_timer, frame_timer;
+		loop_timer.start();
+		while (!app.shouldQuit() && !mStop && (frameCount == 0 || mHistogram.getCount() < frameCount))
+		{
+			frame_timer.start();
+			mRunner.update(deltaTime);
+			if (mRender)
+				app.render();
+			mHistogram.record(static_cast<double>(frame_timer.getNanos().count()) / 1000000.0);
+		}
+		mElapsedTime = loop_timer.getElapsedTime();
+
+		nap::Logger::info("Computed %d frames in %.03f seconds, %.02f frames per second",
+			static_cast<int>(mHistogram.getCount()), mElapsedTime, getThroughput());
+		nap::Logger::info("Frame times: %s", mHistogram.toString().c_str());
+
+		mRunner.shutdown();
+		return true;
+	}
+
+
+	template<typename APP, typename HANDLER>
+	double nap::HeadlessRunner<APP, HANDLER>::getThroughput() const
+	{
+		return mElapsedTime > 0.0 ? static_cast<double>(mHistogram.getCount()) / mElapsedTime : 0.0;
+	}
+}
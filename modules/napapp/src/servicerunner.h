@@ -72,6 +72,13 @@ namespace nap
 		 */
 		void update();
 
+		/**
+		 * Call this from an external environment to advance the app by a fixed amount of time.
+		 * On update all events are processed, after that update on core is called using the given delta time.
+		 * @param deltaTime the time in seconds to advance
+		 */
+		void update(double deltaTime);
+
 		/**
 		 * Call this before exiting your application.
 		 * Ensures the app is exited and running services are stopped appropiately.
@@ -180,7 +187,7 @@ namespace nap
 		app_event_handler.start();
 
 		// Pointer to function used inside update call by core
-		mUpdateCall = std::bind(&APP::update, mApp.get(), std::placeholders::_1);		
+		mUpdateCall = std::bind(&BaseApp::advance, mApp.get(), std::placeholders::_1);
 
 		// Start core
 		mCore.start();
@@ -202,6 +209,18 @@ namespace nap
 	}
 
 
+	template<typename APP, typename HANDLER>
+	void nap::ServiceRunner<APP, HANDLER>::update(double deltaTime)
+	{
+		// Process app specific messages
+		nap::AppEventHandler& app_event_handler = getHandler();
+		app_event_handler.process();
+
+		// update
+		mCore.update(mUpdateCall, deltaTime);
+	}
+
+
 	template<typename APP, typename HANDLER>
 	int nap::ServiceRunner<APP, HANDLER>::shutdown()
 	{
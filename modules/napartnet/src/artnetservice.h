@@ -55,6 +55,12 @@ namespace nap
 		*/
 		virtual void update(double deltaTime) override;
 
+		/**
+		 * Only accesses the registered artnet controllers.
+		 * @return true, the update call of this service can be invoked from a worker thread.
+		 */
+		virtual bool isUpdateThreadSafe() const override				{ return true; }
+
 	private:
 		/**
 		 * Adds a controller to the service. This should be called from init() and the return value should be tested to validate
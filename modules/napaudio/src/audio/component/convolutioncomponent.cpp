@@ -0,0 +1,92 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "convolutioncomponent.h"
+
+// Std includes
+#include <algorithm>
+
+// Nap includes
+#include <entity.h>
+
+// Audio includes
+#include <audio/core/audionodemanager.h>
+#include <audio/utility/fft.h>
+
+// RTTI
+RTTI_BEGIN_CLASS(nap::audio::ConvolutionComponent)
+	RTTI_PROPERTY("Input", &nap::audio::ConvolutionComponent::mInput, nap::rtti::EPropertyMetaData::Required)
+	RTTI_PROPERTY("ImpulseResponse", &nap::audio::ConvolutionComponent::mImpulseResponse, nap::rtti::EPropertyMetaData::Required)
+	RTTI_PROPERTY("PartitionSize", &nap::audio::ConvolutionComponent::mPartitionSize, nap::rtti::EPropertyMetaData::Default)
+	RTTI_PROPERTY("MaxLength", &nap::audio::ConvolutionComponent::mMaxLength, nap::rtti::EPropertyMetaData::Default)
+	RTTI_PROPERTY("Gain", &nap::audio::ConvolutionComponent::mGain, nap::rtti::EPropertyMetaData::Default)
+RTTI_END_CLASS
+
+RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::ConvolutionComponentInstance)
+	RTTI_CONSTRUCTOR(nap::EntityInstance &, nap::Component &)
+	RTTI_FUNCTION("setImpulseResponse", &nap::audio::ConvolutionComponentInstance::setImpulseResponse)
+RTTI_END_CLASS
+
+namespace nap
+{
+
+	namespace audio
+	{
+
+		bool ConvolutionComponentInstance::init(utility::ErrorState& errorState)
+		{
+			mResource = getComponent<ConvolutionComponent>();
+			auto& nodeManager = getNodeManager();
+
+			// The partition is transformed at twice its size
+			if (!errorState.check(RealFFT::isValidSize(mResource->mPartitionSize * 2),
+			                      "%s: PartitionSize has to be a power of two of at least 2", mResource->mID.c_str()))
+				return false;
+
+			if (!errorState.check(mResource->mImpulseResponse->getChannelCount() > 0 && mInput->getChannelCount() > 0,
+			                      "%s: Impulse response and input need at least one channel", mResource->mID.c_str()))
+				return false;
+
+			mKernel = nodeManager.makeSafe<ConvolutionKernel>(*mResource->mImpulseResponse->getBuffer(), mResource->mPartitionSize, mResource->mGain);
+			int maxLength = std::max<int>(mResource->mImpulseResponse->getSize(), mResource->mMaxLength * nodeManager.getSamplesPerMillisecond());
+
+			if (mInput->getChannelCount() == 1)
+			{
+				// A single node shares the transform of the input among all channels of the impulse response
+				auto node = nodeManager.makeSafe<ConvolutionNode>(nodeManager, mResource->mPartitionSize, maxLength, mKernel->getChannelCount());
+				node->audioInput.connect(*mInput->getOutputForChannel(0));
+				node->setKernel(mKernel.get());
+				for (auto i = 0; i < node->getOutputCount(); ++i)
+					mOutputs.emplace_back(&node->getOutput(i));
+				mNodes.emplace_back(std::move(node));
+			}
+			else
+			{
+				for (auto channel = 0; channel < mInput->getChannelCount(); ++channel)
+				{
+					auto node = nodeManager.makeSafe<ConvolutionNode>(nodeManager, mResource->mPartitionSize, maxLength, 1);
+					node->audioInput.connect(*mInput->getOutputForChannel(channel));
+					node->setKernel(mKernel.get(), channel);
+					mOutputs.emplace_back(&node->getOutput(0));
+					mNodes.emplace_back(std::move(node));
+				}
+			}
+
+			return true;
+		}
+
+
+		void ConvolutionComponentInstance::setImpulseResponse(AudioBufferResource& impulseResponse, ControllerValue gain)
+		{
+			auto kernel = getNodeManager().makeSafe<ConvolutionKernel>(*impulseResponse.getBuffer(), mResource->mPartitionSize, gain);
+			for (auto i = 0; i < mNodes.size(); ++i)
+				mNodes[i]->setKernel(kernel.get(), mNodes.size() > 1 ? i : 0);
+
+			mPreviousKernel = std::move(mKernel);
+			mKernel = std::move(kernel);
+		}
+
+	}
+
+}
@@ -0,0 +1,83 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Nap includes
+#include <nap/resourceptr.h>
+
+// Audio includes
+#include <audio/component/audiocomponentbase.h>
+#include <audio/node/convolutionnode.h>
+#include <audio/resource/audiobufferresource.h>
+#include <audio/utility/safeptr.h>
+
+namespace nap
+{
+
+	namespace audio
+	{
+
+		class ConvolutionComponentInstance;
+
+
+		/**
+		 * Component that convolves the audio output of another component with an impulse response, for example to add the reverb of a room.
+		 * A mono input is convolved with every channel of the impulse response, sharing the transform of the input.
+		 * A multichannel input is convolved channel by channel, input channel i with channel i of the impulse response (wrapping around).
+		 * The impulse response is not resampled: its sample rate has to match the sample rate of the audio service.
+		 */
+		class NAPAPI ConvolutionComponent : public AudioComponentBase
+		{
+			RTTI_ENABLE(AudioComponentBase)
+			DECLARE_COMPONENT(ConvolutionComponent, ConvolutionComponentInstance)
+
+		public:
+			ConvolutionComponent() : AudioComponentBase() { }
+
+			nap::ComponentPtr<AudioComponentBase> mInput; ///< property: 'Input' The component whose audio output will be convolved.
+			ResourcePtr<AudioBufferResource> mImpulseResponse = nullptr; ///< property: 'ImpulseResponse' The impulse response to convolve with.
+			int mPartitionSize = 512; ///< property: 'PartitionSize' Number of samples per partition, a power of two. Equals the latency in samples: smaller partitions mean lower latency but more CPU.
+			TimeValue mMaxLength = 0; ///< property: 'MaxLength' Maximum length in milliseconds of impulse responses set at runtime. The length of the initial impulse response is always supported.
+			ControllerValue mGain = 1.f; ///< property: 'Gain' Gain factor applied to the impulse response.
+		};
+
+
+		/**
+		 * Instance of @ConvolutionComponent
+		 */
+		class NAPAPI ConvolutionComponentInstance : public AudioComponentBaseInstance
+		{
+			RTTI_ENABLE(AudioComponentBaseInstance)
+		public:
+			ConvolutionComponentInstance(EntityInstance& entity, Component& resource) : AudioComponentBaseInstance(entity, resource) { }
+
+			// Inherited from ComponentInstance
+			bool init(utility::ErrorState& errorState) override;
+
+			// Inherited from AudioComponentBaseInstance
+			int getChannelCount() const override { return mOutputs.size(); }
+			OutputPin* getOutputForChannel(int channel) override { return mOutputs[channel]; }
+
+			/**
+			 * Replaces the impulse response while playing, the old and the new impulse response are crossfaded.
+			 * The impulse response is prepared on the calling thread, impulse responses longer than 'MaxLength' are truncated.
+			 * @param impulseResponse: the new impulse response
+			 * @param gain: gain factor applied to the new impulse response
+			 */
+			void setImpulseResponse(AudioBufferResource& impulseResponse, ControllerValue gain = 1.f);
+
+		private:
+			ConvolutionComponent* mResource = nullptr;
+			ComponentInstancePtr<AudioComponentBase> mInput = { this, &ConvolutionComponent::mInput };
+
+			std::vector<SafeOwner<ConvolutionNode>> mNodes; // One node for a mono input, a node per channel otherwise
+			std::vector<OutputPin*> mOutputs; // Output pin per channel
+			SafeOwner<ConvolutionKernel> mKernel = nullptr; // Kernel in use
+			SafeOwner<ConvolutionKernel> mPreviousKernel = nullptr; // Kernel being faded out, kept alive until the next replacement
+		};
+
+	}
+
+}
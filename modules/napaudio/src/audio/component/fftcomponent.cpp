@@ -0,0 +1,86 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "fftcomponent.h"
+
+// Nap includes
+#include <entity.h>
+#include <nap/core.h>
+
+// Audio includes
+#include <audio/service/audioservice.h>
+
+// RTTI
+RTTI_BEGIN_CLASS(nap::audio::FFTComponent)
+		RTTI_PROPERTY("Input", &nap::audio::FFTComponent::mInput, nap::rtti::EPropertyMetaData::Required)
+		RTTI_PROPERTY("Channel", &nap::audio::FFTComponent::mChannel, nap::rtti::EPropertyMetaData::Default)
+		RTTI_PROPERTY("FFTSize", &nap::audio::FFTComponent::mFFTSize, nap::rtti::EPropertyMetaData::Default)
+		RTTI_PROPERTY("HopSize", &nap::audio::FFTComponent::mHopSize, nap::rtti::EPropertyMetaData::Default)
+		RTTI_PROPERTY("BandCount", &nap::audio::FFTComponent::mBandCount, nap::rtti::EPropertyMetaData::Default)
+		RTTI_PROPERTY("MinFrequency", &nap::audio::FFTComponent::mMinFrequency, nap::rtti::EPropertyMetaData::Default)
+		RTTI_PROPERTY("MaxFrequency", &nap::audio::FFTComponent::mMaxFrequency, nap::rtti::EPropertyMetaData::Default)
+RTTI_END_CLASS
+
+RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::FFTComponentInstance)
+		RTTI_CONSTRUCTOR(nap::EntityInstance &, nap::Component &)
+		RTTI_FUNCTION("getBandEnergy", &nap::audio::FFTComponentInstance::getBandEnergy)
+		RTTI_FUNCTION("getBinFrequency", &nap::audio::FFTComponentInstance::getBinFrequency)
+RTTI_END_CLASS
+
+namespace nap
+{
+
+	namespace audio
+	{
+
+		bool FFTComponentInstance::init(utility::ErrorState& errorState)
+		{
+			mResource = getComponent<FFTComponent>();
+			mAudioService = getEntityInstance()->getCore()->getService<AudioService>();
+			auto& nodeManager = mAudioService->getNodeManager();
+
+			if (!errorState.check(mResource->mChannel < mInput->getChannelCount(),
+			                      "%s: Channel exceeds number of input channels", mResource->mID.c_str()))
+				return false;
+
+			if (!errorState.check(RealFFT::isValidSize(mResource->mFFTSize),
+			                      "%s: FFTSize has to be a power of two of at least 4", mResource->mID.c_str()))
+				return false;
+
+			if (!errorState.check(mResource->mBandCount >= 0 && mResource->mMinFrequency > 0.f && mResource->mMaxFrequency > mResource->mMinFrequency,
+			                      "%s: Invalid band layout", mResource->mID.c_str()))
+				return false;
+
+			auto bandEdges = FFTNode::makeLogarithmicBands(mResource->mBandCount, mResource->mMinFrequency, mResource->mMaxFrequency);
+			mFFT = nodeManager.makeSafe<FFTNode>(nodeManager, mResource->mFFTSize, mResource->mHopSize, bandEdges);
+			mFFT->input.connect(*mInput->getOutputForChannel(mResource->mChannel));
+
+			return true;
+		}
+
+
+		void FFTComponentInstance::update(double deltaTime)
+		{
+			mFFT->update();
+		}
+
+
+		float FFTComponentInstance::getBandEnergy(int band) const
+		{
+			const auto& energies = getBandEnergies();
+			return band >= 0 && band < energies.size() ? energies[band] : 0.f;
+		}
+
+
+		void FFTComponentInstance::setInput(AudioComponentBaseInstance& input)
+		{
+			auto inputPtr = &input;
+			mAudioService->enqueueTask([&, inputPtr]() {
+				mFFT->input.connect(*inputPtr->getOutputForChannel(mResource->mChannel));
+			});
+		}
+
+	}
+
+}
@@ -0,0 +1,112 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Nap includes
+#include <component.h>
+#include <audio/utility/safeptr.h>
+
+// Audio includes
+#include <audio/node/fftnode.h>
+#include <audio/component/audiocomponentbase.h>
+
+namespace nap
+{
+
+	namespace audio
+	{
+
+		class FFTComponentInstance;
+
+
+		/**
+		 * Component to analyze the spectrum of the audio signal from an @AudioComponentBase.
+		 * Measures the magnitude and phase of every bin and the energy within a number of logarithmically spaced bands.
+		 * A single FFT replaces a bank of filters with a level meter per band.
+		 */
+		class NAPAPI FFTComponent : public Component
+		{
+			RTTI_ENABLE(Component)
+			DECLARE_COMPONENT(FFTComponent, FFTComponentInstance)
+
+		public:
+			FFTComponent() : Component()
+			{}
+
+			nap::ComponentPtr<AudioComponentBase> mInput; ///< property: 'Input' The component whose audio output will be analyzed.
+			int mChannel = 0; ///< property: 'Channel' Channel of the input that will be analyzed.
+			int mFFTSize = 1024; ///< property: 'FFTSize' Number of samples analyzed at once, a power of two.
+			int mHopSize = 256; ///< property: 'HopSize' Number of samples in between the start of two analyses.
+			int mBandCount = 16; ///< property: 'BandCount' Number of logarithmically spaced bands whose energy is measured.
+			float mMinFrequency = 40.f; ///< property: 'MinFrequency' Lower edge of the first band in Hz.
+			float mMaxFrequency = 16000.f; ///< property: 'MaxFrequency' Upper edge of the last band in Hz.
+		};
+
+
+		/**
+		 * Instance of component to analyze the spectrum of the audio signal from an @AudioComponentBase.
+		 * The result of the last analysis on the audio thread is picked up every update.
+		 */
+		class NAPAPI FFTComponentInstance : public ComponentInstance
+		{
+			RTTI_ENABLE(ComponentInstance)
+		public:
+			FFTComponentInstance(EntityInstance& entity, Component& resource) : ComponentInstance(entity, resource)
+			{}
+
+			// Initialize the component
+			bool init(utility::ErrorState& errorState) override;
+
+			/**
+			 * Picks up the result of the last analysis.
+			 */
+			void update(double deltaTime) override;
+
+			/**
+			 * @return the amplitude of every bin, from DC up to and including the Nyquist frequency.
+			 */
+			const std::vector<float>& getMagnitudes() const { return mFFT->getFrame().mMagnitudes; }
+
+			/**
+			 * @return the phase in radians of every bin.
+			 */
+			const std::vector<float>& getPhases() const { return mFFT->getFrame().mPhases; }
+
+			/**
+			 * @return the energy within every band.
+			 */
+			const std::vector<float>& getBandEnergies() const { return mFFT->getFrame().mBandEnergies; }
+
+			/**
+			 * @return the energy within a band, 0 if the band doesn't exist.
+			 */
+			float getBandEnergy(int band) const;
+
+			/**
+			 * @return the center frequency of a bin in Hz.
+			 */
+			float getBinFrequency(int bin) const { return mFFT->getBinFrequency(bin); }
+
+			/**
+			 * Sets the number of samples in between the start of two analyses.
+			 */
+			void setHopSize(int hopSize) { mFFT->setHopSize(hopSize); }
+
+			/**
+			 * Connects a different audio component as input to be analyzed.
+			 */
+			void setInput(AudioComponentBaseInstance& input);
+
+		private:
+			ComponentInstancePtr<AudioComponentBase> mInput = {this, &FFTComponent::mInput}; // Pointer to component that outputs this components audio input
+			SafeOwner<FFTNode> mFFT = nullptr; // Node doing the actual analysis
+
+			FFTComponent* mResource = nullptr;
+			AudioService* mAudioService = nullptr;
+		};
+
+	}
+
+}
@@ -0,0 +1,66 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Nap includes
+#include <nap/resourceptr.h>
+
+// Audio includes
+#include <audio/component/audiocomponentbase.h>
+#include <audio/resource/voicepool.h>
+
+namespace nap
+{
+
+	namespace audio
+	{
+
+		class VoicePoolComponentInstance;
+
+
+		/**
+		 * Outputs the stereo mix of all voices of a @VoicePool.
+		 * The component has to be used in combination with an @OutputComponent to send the voices to the DAC.
+		 */
+		class NAPAPI VoicePoolComponent : public AudioComponentBase
+		{
+			RTTI_ENABLE(AudioComponentBase)
+			DECLARE_COMPONENT(VoicePoolComponent, VoicePoolComponentInstance)
+
+		public:
+			VoicePoolComponent() : AudioComponentBase() { }
+
+			ResourcePtr<VoicePool> mVoicePool = nullptr; ///< property: 'VoicePool' The pool of voices to output
+		};
+
+
+		/**
+		 * Instance of @VoicePoolComponent
+		 */
+		class NAPAPI VoicePoolComponentInstance : public AudioComponentBaseInstance
+		{
+			RTTI_ENABLE(AudioComponentBaseInstance)
+		public:
+			VoicePoolComponentInstance(EntityInstance& entity, Component& resource) : AudioComponentBaseInstance(entity, resource) { }
+
+			// Inherited from ComponentInstance
+			bool init(utility::ErrorState& errorState) override;
+
+			// Inherited from AudioComponentBaseInstance
+			int getChannelCount() const override { return 2; }
+			OutputPin* getOutputForChannel(int channel) override;
+
+			/**
+			 * @return the pool of voices
+			 */
+			VoicePool& getVoicePool() { return *mVoicePool; }
+
+		private:
+			VoicePool* mVoicePool = nullptr;
+		};
+
+	}
+
+}
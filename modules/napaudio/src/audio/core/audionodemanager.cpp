@@ -8,10 +8,23 @@
 #include <nap/logger.h>
 #include <nap/core.h>
 
+#include <algorithm>
+
 namespace nap
 {
 	namespace audio
 	{
+		// Max number of timed tasks that are waiting on the audio thread, remaining tasks wait in the queue
+		static constexpr size_t timedTaskCapacity = 256;
+		
+		
+		NodeManager::NodeManager(DeletionQueue& deletionQueue) : mDeletionQueue(deletionQueue)
+		{
+			// Timed tasks are handled on the audio thread, reserve up front so that thread never allocates
+			mTimedTasks.reserve(timedTaskCapacity);
+			mTimedTaskOffsets.reserve(timedTaskCapacity);
+		}
+		
 		
 		NodeManager::~NodeManager()
 		{
@@ -30,6 +43,9 @@ namespace nap
 			for (auto channel = 0; channel < mOutputChannelCount; ++channel)
 				memset(outputBuffer[channel], 0, sizeof(float) * framesPerBuffer);
 			
+			// Position timed tasks within this callback
+			prepareTimedTasks(framesPerBuffer);
+			
 			for (auto channel = 0; channel < mInputChannelCount; ++channel)
 				mInputBuffer[channel] = inputBuffer[channel];
 			
@@ -37,12 +53,18 @@ namespace nap
 			while (mInternalBufferOffset < framesPerBuffer)
 			{
 				mTaskQueue.process();
+				processTimedTasks();
 				for (auto& channelMapping : mOutputMapping)
 					channelMapping.clear();
 				
 				{
 					for (auto& root : mRootProcesses)
-						root->process();
+					{
+						if (mProfilingEnabled)
+							root->processProfiled();
+						else
+							root->process();
+					}
 				}
 				
 				for (auto channel = 0; channel < mOutputChannelCount; ++channel) {
@@ -56,6 +78,7 @@ namespace nap
 				
 				mUpdateSignal(mSampleTime);
 			}
+			finishTimedTasks();
 		}
 		
 		
@@ -66,6 +89,9 @@ namespace nap
 			for (auto channel = 0; channel < mOutputChannelCount; ++channel)
 				memset(outputBuffer[channel]->data(), 0, sizeof(float) * framesPerBuffer);
 			
+			// Position timed tasks within this callback
+			prepareTimedTasks(framesPerBuffer);
+			
 			for (auto channel = 0; channel < mInputChannelCount; ++channel)
 				mInputBuffer[channel] = inputBuffer[channel]->data();
 			
@@ -73,12 +99,18 @@ namespace nap
 			while (mInternalBufferOffset < framesPerBuffer)
 			{
 				mTaskQueue.process();
+				processTimedTasks();
 				for (auto& channelMapping : mOutputMapping)
 					channelMapping.clear();
 				
 				{
 					for (auto& root : mRootProcesses)
-						root->update();
+					{
+						if (mProfilingEnabled)
+							root->processProfiled();
+						else
+							root->process();
+					}
 				}
 				
 				for (auto channel = 0; channel < mOutputChannelCount; ++channel) {
@@ -92,6 +124,62 @@ namespace nap
 				
 				mUpdateSignal(mSampleTime);
 			}
+			finishTimedTasks();
+		}
+		
+		
+		void NodeManager::prepareTimedTasks(unsigned long framesPerBuffer)
+		{
+			// The interval between the previous and the current callback is mapped onto this callback
+			auto now = HighResolutionClock::now();
+			if (mPreviousCallbackTime == HighResTimeStamp())
+				mPreviousCallbackTime = now;
+			
+			// Fetch new tasks and insert them sorted by time, tasks with the same time keep the order they were enqueued in.
+			// Tasks that don't fit in the reserved capacity stay in the queue until a next callback.
+			TimedTask task;
+			while (mTimedTasks.size() < timedTaskCapacity && mTimedTaskQueue.try_dequeue(task))
+			{
+				auto position = std::upper_bound(mTimedTasks.begin(), mTimedTasks.end(), task.mTime, [](const HighResTimeStamp& time, const TimedTask& timedTask)
+				{
+					return time < timedTask.mTime;
+				});
+				mTimedTasks.emplace(position, std::move(task));
+			}
+			
+			// Compute the position of all tasks that are due, late tasks are executed at the start of the callback
+			mTimedTaskOffsets.clear();
+			mExecutedTimedTaskCount = 0;
+			for (const auto& timed_task : mTimedTasks)
+			{
+				if (timed_task.mTime >= now)
+					break;
+				
+				float millis = std::chrono::duration<float, std::milli>(timed_task.mTime - mPreviousCallbackTime).count();
+				float offset = std::max<float>(millis * mSamplesPerMillisecond, 0.0f);
+				mTimedTaskOffsets.emplace_back(std::min<unsigned int>(static_cast<unsigned int>(offset), framesPerBuffer - 1));
+			}
+			mPreviousCallbackTime = now;
+		}
+		
+		
+		void NodeManager::processTimedTasks()
+		{
+			while (mExecutedTimedTaskCount < mTimedTaskOffsets.size() &&
+				mTimedTaskOffsets[mExecutedTimedTaskCount] < mInternalBufferOffset + mInternalBufferSize)
+			{
+				mTimedTasks[mExecutedTimedTaskCount].mTask();
+				mExecutedTimedTaskCount++;
+			}
+		}
+		
+		
+		void NodeManager::finishTimedTasks()
+		{
+			// Erasing keeps the reserved capacity
+			mTimedTasks.erase(mTimedTasks.begin(), mTimedTasks.begin() + mExecutedTimedTaskCount);
+			mExecutedTimedTaskCount = 0;
+			mTimedTaskOffsets.clear();
 		}
 		
 		
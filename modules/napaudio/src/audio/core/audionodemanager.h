@@ -11,6 +11,8 @@
 // Nap includes
 #include <utility/threading.h>
 #include <nap/signalslot.h>
+#include <nap/datetime.h>
+#include <concurrentqueue.h>
 
 // Audio includes
 #include <audio/utility/audiotypes.h>
@@ -40,7 +42,7 @@ namespace nap
 			using OutputMapping = std::vector<std::vector<SampleBuffer*>>;
 		
 		public:
-			NodeManager(DeletionQueue& deletionQueue) : mDeletionQueue(deletionQueue) { }
+			NodeManager(DeletionQueue& deletionQueue);
 			
 			~NodeManager();
 			
@@ -75,6 +77,18 @@ namespace nap
 			 */
 			void enqueueTask(nap::TaskQueue::Task task) { mTaskQueue.enqueue(task); }
 			
+			/**
+			 * Enqueue a lambda to be executed at the position in the audio stream that corresponds to the given time.
+			 * A task with a time stamp that falls within the interval between the previous and the current audio callback
+			 * is executed at the same relative position within the current callback. This adds a constant latency of one
+			 * callback, but removes the jitter caused by the callback interval and the thread the task is enqueued from.
+			 * Use this to apply events that are time stamped on arrival, for example midi events, with a timing accuracy
+			 * that corresponds to the internal buffer size. Tasks with a time stamp in the future wait for the callback they fall in.
+			 * @param task Lambda without arguments that will be called at the given time
+			 * @param time the time the task should be executed at, usually the time the event that triggered the task was received.
+			 */
+			void enqueueTask(nap::TaskQueue::Task task, const HighResTimeStamp& time) { mTimedTaskQueue.enqueue({ std::move(task), time }); }
+			
 			/**
 			 * @return: the number of input channels that will be fed into the node system
 			 */
@@ -187,9 +201,36 @@ namespace nap
 			 * Signal triggered whenever the input or output channel count of the node manager changes
 			 */
 			Signal<NodeManager&> mChannelCountChangedSignal;
+			
+			/**
+			 * Enables measuring the CPU time spent by every process, see Process::getCPUTime().
+			 * Profiling adds two clock reads to every process call, only enable it when measuring.
+			 * Should only be called while the node manager is not processing, for example from the offline renderer.
+			 * @param enable: if profiling is enabled
+			 */
+			void setProfilingEnabled(bool enable) { mProfilingEnabled = enable; }
+			
+			/**
+			 * @return: if the CPU time spent by every process is measured
+			 */
+			bool isProfilingEnabled() const { return mProfilingEnabled; }
+			
+			/**
+			 * @return: all nodes managed by this node manager. Only safe to access while the node manager is not processing.
+			 */
+			const std::set<Node*>& getNodes() const { return mNodes; }
 		
 		
 		private:
+			/**
+			 * Task with the time it should be executed at
+			 */
+			struct TimedTask
+			{
+				nap::TaskQueue::Task mTask;
+				HighResTimeStamp mTime;
+			};
+			
 			// Used by the nodes to register themselves on construction
 			void registerNode(Node& node);
 			
@@ -216,6 +257,15 @@ namespace nap
 				return mInputBuffer[channel][mInternalBufferOffset + index];
 			}
 			
+			// Fetches enqueued timed tasks and computes the position of all tasks that are due in this callback
+			void prepareTimedTasks(unsigned long framesPerBuffer);
+			
+			// Executes the due timed tasks that are positioned before the end of the current internal buffer
+			void processTimedTasks();
+			
+			// Removes the timed tasks that were executed in this callback
+			void finishTimedTasks();
+			
 			int mInputChannelCount = 0; // Number of input channels this node manager processes
 			int mOutputChannelCount = 0; // Number of channel this node manager outputs
 			float mSampleRate = 0; // Current sample rate the node manager runs on.
@@ -234,7 +284,13 @@ namespace nap
 			std::set<Process*> mRootProcesses; // the nodes that will be processed directly by the manager on every audio callback
 			
 			nap::TaskQueue mTaskQueue = { 256 }; // Queue with lambda functions to be executed before processing the next itnernal buffer.
+			moodycamel::ConcurrentQueue<TimedTask> mTimedTaskQueue = { 256 }; // Queue with lambda functions to be executed at a specific time.
+			std::vector<TimedTask> mTimedTasks; // Timed tasks that are not executed yet, sorted by time, only accessed on the audio thread. Never grows beyond its reserved capacity.
+			std::vector<unsigned int> mTimedTaskOffsets; // Position within the current callback of the timed tasks that are due.
+			size_t mExecutedTimedTaskCount = 0; // Number of timed tasks executed in the current callback.
+			HighResTimeStamp mPreviousCallbackTime; // Time the previous audio callback started.
 			DeletionQueue& mDeletionQueue; // Deletion queue used to safely create and destruct nodes in a threadsafe manner.
+			bool mProfilingEnabled = false; // If the CPU time of every process is measured
 		};
 		
 	}
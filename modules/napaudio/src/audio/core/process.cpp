@@ -29,12 +29,32 @@ namespace nap
 		{
 			if (mLastCalculatedSample < getSampleTime())
 			{
-				process();
+				if (getNodeManager().isProfilingEnabled())
+					processProfiled();
+				else
+					process();
 				mLastCalculatedSample = getSampleTime();
 			}
 		}
 		
 		
+		// Time spent in nested updates on the current thread, subtracted from the process that pulls its inputs
+		static thread_local double sNestedCPUTime = 0.0;
+		
+		void Process::processProfiled()
+		{
+			double outer_time = sNestedCPUTime;
+			sNestedCPUTime = 0.0;
+			
+			auto start = HighResolutionClock::now();
+			process();
+			double elapsed = std::chrono::duration<double>(HighResolutionClock::now() - start).count();
+			
+			mCPUTime += elapsed - sNestedCPUTime;
+			sNestedCPUTime = outer_time + elapsed;
+		}
+		
+		
 		int Process::getBufferSize() const
 		{
 			return getNodeManager().getInternalBufferSize();
@@ -87,6 +87,17 @@ namespace nap
 			 * Returns the current time in samples
 			 */
 			DiscreteTimeValue getSampleTime() const;
+			
+			/**
+			 * Returns the time in seconds spent in the process() method while profiling is enabled on the node manager.
+			 * The time spent updating the inputs of this process is not included.
+			 */
+			double getCPUTime() const { return mCPUTime; }
+			
+			/**
+			 * Resets the time spent in the process() method to zero.
+			 */
+			void resetCPUTime() { mCPUTime = 0.0; }
 		
 		protected:
 			/**
@@ -109,8 +120,14 @@ namespace nap
 			 */
 			virtual void process() = 0;
 			
+			/*
+			 * Calls process() and adds the time spent to the CPU time of this process, excluding nested updates of inputs.
+			 */
+			void processProfiled();
+			
 			NodeManager* mNodeManager = nullptr; // The node manager that this process is processed on
 			DiscreteTimeValue mLastCalculatedSample = 0; // The time stamp of the latest calculated sample by this node
+			double mCPUTime = 0.0; // Time in seconds spent in process() while profiling
 		};
 		
 		
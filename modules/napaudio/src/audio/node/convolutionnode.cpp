@@ -0,0 +1,153 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "convolutionnode.h"
+
+// Std includes
+#include <algorithm>
+
+#include <audio/core/audionodemanager.h>
+
+RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::ConvolutionNode)
+	RTTI_PROPERTY("audioInput", &nap::audio::ConvolutionNode::audioInput, nap::rtti::EPropertyMetaData::Embedded)
+RTTI_END_CLASS
+
+
+namespace nap
+{
+	namespace audio
+	{
+
+		ConvolutionNode::ConvolutionNode(NodeManager& nodeManager, int partitionSize, int maxLength, int outputCount) :
+			Node(nodeManager), mPartitionSize(partitionSize), mFFT(partitionSize * 2)
+		{
+			mHistorySize = std::max(1, (maxLength + partitionSize - 1) / partitionSize);
+			auto binCount = mFFT.getBinCount();
+
+			mInput.resize(partitionSize * 2, 0.f);
+			mHistory.resize(mHistorySize * binCount);
+			mAccumulator.resize(binCount);
+			mTimeDomain.resize(partitionSize * 2, 0.f);
+			mFadeOutput.resize(partitionSize, 0.f);
+
+			for (auto i = 0; i < outputCount; ++i)
+			{
+				mOutputs.emplace_back(std::make_unique<OutputPin>(this));
+				mOutputPartitions.emplace_back(partitionSize, 0.f);
+			}
+		}
+
+
+		bool ConvolutionNode::setKernel(SafePtr<ConvolutionKernel> kernel, int firstChannel)
+		{
+			if (kernel != nullptr && kernel->getPartitionSize() != mPartitionSize)
+				return false;
+
+			getNodeManager().enqueueTask([&, kernel, firstChannel]()
+			{
+				mNextKernel = kernel;
+				mNextFirstChannel = firstChannel;
+				mFading = true;
+			});
+			return true;
+		}
+
+
+		void ConvolutionNode::process()
+		{
+			auto inputBuffer = audioInput.pull();
+			auto bufferSize = getBufferSize();
+
+			// Play the current output partition while gathering the next input partition, in chunks up to the partition boundary
+			int position = 0;
+			while (position < bufferSize)
+			{
+				int chunk = std::min(bufferSize - position, mPartitionSize - mInputIndex);
+				if (inputBuffer != nullptr)
+					std::copy_n(inputBuffer->begin() + position, chunk, mInput.begin() + mPartitionSize + mInputIndex);
+				else
+					std::fill_n(mInput.begin() + mPartitionSize + mInputIndex, chunk, 0.f);
+
+				for (auto output = 0; output < mOutputs.size(); ++output)
+					std::copy_n(mOutputPartitions[output].begin() + mInputIndex, chunk, getOutputBuffer(*mOutputs[output]).begin() + position);
+
+				position += chunk;
+				mInputIndex += chunk;
+				if (mInputIndex == mPartitionSize)
+				{
+					mInputIndex = 0;
+					processPartition();
+				}
+			}
+		}
+
+
+		void ConvolutionNode::processPartition()
+		{
+			auto binCount = mFFT.getBinCount();
+
+			// Transform the previous and current input partition, then move the current partition to the front
+			mHistoryIndex = (mHistoryIndex + 1) % mHistorySize;
+			mFFT.transform(mInput.data(), &mHistory[mHistoryIndex * binCount]);
+			std::copy(mInput.begin() + mPartitionSize, mInput.end(), mInput.begin());
+
+			// Kernels that were released by their owner are treated as silence
+			const ConvolutionKernel* kernel = mKernel != nullptr ? &(*mKernel) : nullptr;
+			const ConvolutionKernel* nextKernel = mNextKernel != nullptr ? &(*mNextKernel) : nullptr;
+
+			for (auto output = 0; output < mOutputs.size(); ++output)
+			{
+				auto& partition = mOutputPartitions[output];
+				convolve(kernel, mFirstChannel + output, partition.data());
+				if (mFading)
+				{
+					// Linear crossfade from the old to the new kernel over one partition
+					convolve(nextKernel, mNextFirstChannel + output, mFadeOutput.data());
+					for (auto i = 0; i < mPartitionSize; ++i)
+					{
+						float position = float(i + 1) / mPartitionSize;
+						partition[i] += position * (mFadeOutput[i] - partition[i]);
+					}
+				}
+			}
+
+			if (mFading)
+			{
+				mKernel = mNextKernel;
+				mFirstChannel = mNextFirstChannel;
+				mNextKernel = nullptr;
+				mFading = false;
+			}
+		}
+
+
+		void ConvolutionNode::convolve(const ConvolutionKernel* kernel, int channel, float* output)
+		{
+			if (kernel == nullptr || kernel->getChannelCount() == 0)
+			{
+				std::fill(output, output + mPartitionSize, 0.f);
+				return;
+			}
+
+			// Multiply every kernel partition with the input partition of the same age and accumulate
+			auto binCount = mFFT.getBinCount();
+			auto partitionCount = std::min(kernel->getPartitionCount(), mHistorySize);
+			channel = channel % kernel->getChannelCount();
+			std::fill(mAccumulator.begin(), mAccumulator.end(), std::complex<float>(0.f, 0.f));
+			for (auto partition = 0; partition < partitionCount; ++partition)
+			{
+				auto historyIndex = (mHistoryIndex - partition + mHistorySize) % mHistorySize;
+				const auto* input = &mHistory[historyIndex * binCount];
+				const auto* weights = kernel->getPartition(channel, partition);
+				for (auto bin = 0; bin < binCount; ++bin)
+					mAccumulator[bin] += input[bin] * weights[bin];
+			}
+
+			// The second half of the circular convolution is the valid output of this partition
+			mFFT.inverse(mAccumulator.data(), mTimeDomain.data());
+			std::copy(mTimeDomain.begin() + mPartitionSize, mTimeDomain.end(), output);
+		}
+
+	}
+}
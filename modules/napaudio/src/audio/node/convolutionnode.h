@@ -0,0 +1,106 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Std includes
+#include <complex>
+#include <memory>
+#include <vector>
+
+// Audio includes
+#include <audio/core/audionode.h>
+#include <audio/utility/convolutionkernel.h>
+#include <audio/utility/fft.h>
+#include <audio/utility/safeptr.h>
+
+namespace nap
+{
+	namespace audio
+	{
+
+		/**
+		 * Convolves an audio signal with an impulse response, for reverb or long FIR filters.
+		 * Implements uniformly partitioned convolution: the input is transformed once per partition of input samples
+		 * and multiplied with every partition of the @ConvolutionKernel in the frequency domain.
+		 * The latency of the node is one partition. Smaller partitions mean lower latency but more CPU.
+		 * The node has one input and a number of outputs. Every output convolves the same input with another channel of the kernel,
+		 * so the forward transform of the input is shared by all outputs: a mono source through a stereo impulse response
+		 * needs a single node with two outputs.
+		 * The kernel can be replaced while playing: the outputs of the old and the new kernel are crossfaded over one partition.
+		 */
+		class NAPAPI ConvolutionNode : public Node
+		{
+			RTTI_ENABLE(Node)
+		
+		public:
+			/**
+			 * @param nodeManager: the node manager this node is processed by
+			 * @param partitionSize: number of samples per partition, a power of two. Equals the latency of the node in samples.
+			 * @param maxLength: maximum length of the impulse response in samples, longer kernels are truncated
+			 * @param outputCount: number of outputs
+			 */
+			ConvolutionNode(NodeManager& nodeManager, int partitionSize = 512, int maxLength = 192000, int outputCount = 1);
+
+			InputPin audioInput = {this}; /**< The input for the audio signal that will be convolved. */
+
+			/**
+			 * @return the output for the given index.
+			 */
+			OutputPin& getOutput(int index) { return *mOutputs[index]; }
+
+			/**
+			 * @return number of outputs.
+			 */
+			int getOutputCount() const { return mOutputs.size(); }
+
+			/**
+			 * Replaces the kernel, the outputs of the old and the new kernel are crossfaded over one partition.
+			 * Output i convolves with channel (firstChannel + i) of the kernel, wrapping around the channel count of the kernel.
+			 * The kernel has to stay alive while in use, so keep the SafeOwner of a replaced kernel until the next replacement.
+			 * @param kernel: the new kernel, nullptr to fade out to silence
+			 * @param firstChannel: the channel of the kernel used by the first output
+			 * @return false if the partition size of the kernel doesn't match the partition size of the node
+			 */
+			bool setKernel(SafePtr<ConvolutionKernel> kernel, int firstChannel = 0);
+
+			/**
+			 * @return number of samples per partition.
+			 */
+			int getPartitionSize() const { return mPartitionSize; }
+
+			// Inherited from Node
+			void process() override;
+
+		private:
+			// Transforms the last input partition and calculates the next output partition
+			void processPartition();
+
+			// Convolves the transformed input history with a channel of a kernel and writes one partition of output
+			void convolve(const ConvolutionKernel* kernel, int channel, float* output);
+
+			int mPartitionSize = 0;
+			int mHistorySize = 0; // Number of input partitions kept in the frequency domain
+			RealFFT mFFT; // Transform of twice the partition size
+
+			std::vector<float> mInput; // Previous and current partition of input samples
+			int mInputIndex = 0; // Write index in the current partition of input samples
+			std::vector<std::complex<float>> mHistory; // Transformed input partitions, circular
+			int mHistoryIndex = 0; // Index of the last transformed partition in the history
+			std::vector<std::complex<float>> mAccumulator; // Sum of the products of kernel partitions and input partitions
+			std::vector<float> mTimeDomain; // Inverse transform of the accumulator
+			std::vector<float> mFadeOutput; // Output of the new kernel during a crossfade
+			std::vector<std::vector<float>> mOutputPartitions; // Partition of output samples being played per output
+
+			std::vector<std::unique_ptr<OutputPin>> mOutputs;
+
+			SafePtr<ConvolutionKernel> mKernel = nullptr; // Kernel in use, only accessed on the audio thread
+			int mFirstChannel = 0;
+			SafePtr<ConvolutionKernel> mNextKernel = nullptr; // Kernel to crossfade to, only accessed on the audio thread
+			int mNextFirstChannel = 0;
+			bool mFading = false;
+		};
+
+	}
+}
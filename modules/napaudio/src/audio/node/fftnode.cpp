@@ -0,0 +1,181 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "fftnode.h"
+
+// Std includes
+#include <algorithm>
+#include <cmath>
+
+#include <audio/core/audionodemanager.h>
+
+RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::FFTNode)
+	RTTI_PROPERTY("input", &nap::audio::FFTNode::input, nap::rtti::EPropertyMetaData::Embedded)
+	RTTI_FUNCTION("update", &nap::audio::FFTNode::update)
+	RTTI_FUNCTION("getBinFrequency", &nap::audio::FFTNode::getBinFrequency)
+RTTI_END_CLASS
+
+
+namespace nap
+{
+	namespace audio
+	{
+
+		FFTNode::FFTNode(NodeManager& nodeManager, int fftSize, int hopSize, const std::vector<float>& bandEdges, bool rootProcess)
+				: Node(nodeManager), mFFT(fftSize), mBandEdges(bandEdges),
+				  mFrames(makeFrame(mFFT.getBinCount(), getBandCount())), mRootProcess(rootProcess)
+		{
+			const double pi = 3.14159265358979323846;
+
+			// Periodic Hann window, overlapping windows with a hop of a quarter or half the size sum to a constant
+			mWindow.resize(fftSize);
+			float windowSum = 0.f;
+			for (auto i = 0; i < fftSize; ++i)
+			{
+				mWindow[i] = 0.5f - 0.5f * std::cos(2.0 * pi * i / fftSize);
+				windowSum += mWindow[i];
+			}
+			mNormalization = 2.f / windowSum;
+
+			mHistory.resize(fftSize, 0.f);
+			mWindowed.resize(fftSize, 0.f);
+			mSpectrum.resize(mFFT.getBinCount());
+			setHopSize(hopSize);
+
+			mBandBins.resize(getBandCount());
+			calculateBandBins(getNodeManager().getSampleRate());
+
+			if (rootProcess)
+				getNodeManager().registerRootProcess(*this);
+		}
+
+
+		FFTNode::~FFTNode()
+		{
+			if (mRootProcess)
+				getNodeManager().unregisterRootProcess(*this);
+		}
+
+
+		bool FFTNode::update()
+		{
+			return mFrames.update();
+		}
+
+
+		void FFTNode::setHopSize(int hopSize)
+		{
+			mHopSize.store(std::max(1, std::min(hopSize, mFFT.getSize())));
+		}
+
+
+		float FFTNode::getBinFrequency(int bin) const
+		{
+			return bin * getNodeManager().getSampleRate() / mFFT.getSize();
+		}
+
+
+		std::vector<float> FFTNode::makeLogarithmicBands(int bandCount, float minFrequency, float maxFrequency)
+		{
+			std::vector<float> edges;
+			if (bandCount <= 0 || minFrequency <= 0.f || maxFrequency <= minFrequency)
+				return edges;
+
+			edges.resize(bandCount + 1);
+			float ratio = std::log(maxFrequency / minFrequency);
+			for (auto i = 0; i <= bandCount; ++i)
+				edges[i] = minFrequency * std::exp(ratio * i / bandCount);
+			return edges;
+		}
+
+
+		void FFTNode::process()
+		{
+			auto inputBuffer = input.pull();
+
+			if (inputBuffer == nullptr)
+				return;
+
+			int size = mHistory.size();
+			int hopSize = mHopSize.load(std::memory_order_relaxed);
+			for (auto& sample : *inputBuffer)
+			{
+				mHistory[mWriteIndex] = sample;
+				if (++mWriteIndex == size)
+					mWriteIndex = 0;
+				if (++mHopCounter >= hopSize)
+				{
+					mHopCounter = 0;
+					analyze();
+				}
+			}
+		}
+
+
+		void FFTNode::sampleRateChanged(float sampleRate)
+		{
+			calculateBandBins(sampleRate);
+		}
+
+
+		void FFTNode::analyze()
+		{
+			// Unroll the circular buffer, oldest sample first
+			int size = mHistory.size();
+			int tail = size - mWriteIndex;
+			for (auto i = 0; i < tail; ++i)
+				mWindowed[i] = mHistory[mWriteIndex + i] * mWindow[i];
+			for (auto i = tail; i < size; ++i)
+				mWindowed[i] = mHistory[i - tail] * mWindow[i];
+
+			mFFT.transform(mWindowed.data(), mSpectrum.data());
+
+			auto& frame = mFrames.getWriteBuffer();
+			for (auto bin = 0; bin < mSpectrum.size(); ++bin)
+			{
+				frame.mMagnitudes[bin] = std::abs(mSpectrum[bin]) * mNormalization;
+				frame.mPhases[bin] = std::arg(mSpectrum[bin]);
+			}
+
+			for (auto band = 0; band < mBandBins.size(); ++band)
+			{
+				float energy = 0.f;
+				for (auto bin = mBandBins[band].first; bin < mBandBins[band].second; ++bin)
+					energy += frame.mMagnitudes[bin] * frame.mMagnitudes[bin];
+				frame.mBandEnergies[band] = energy;
+			}
+
+			frame.mIndex = mAnalysisCount++;
+			mFrames.publish();
+		}
+
+
+		FFTNode::Frame FFTNode::makeFrame(int binCount, int bandCount)
+		{
+			Frame frame;
+			frame.mMagnitudes.resize(binCount, 0.f);
+			frame.mPhases.resize(binCount, 0.f);
+			frame.mBandEnergies.resize(bandCount, 0.f);
+			return frame;
+		}
+
+
+		void FFTNode::calculateBandBins(float sampleRate)
+		{
+			if (sampleRate <= 0.f)
+				return;
+
+			// Every band contains at least one bin, so narrow low bands don't measure silence
+			int binCount = mFFT.getBinCount();
+			float binsPerHz = mFFT.getSize() / sampleRate;
+			for (auto band = 0; band < mBandBins.size(); ++band)
+			{
+				int first = std::min<int>(std::lround(mBandEdges[band] * binsPerHz), binCount - 1);
+				int last = std::min<int>(std::lround(mBandEdges[band + 1] * binsPerHz), binCount);
+				mBandBins[band] = { std::max(first, 0), std::max(last, first + 1) };
+			}
+		}
+
+	}
+}
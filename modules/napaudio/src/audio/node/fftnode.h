@@ -0,0 +1,148 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Std includes
+#include <atomic>
+#include <complex>
+#include <vector>
+
+// Nap includes
+#include <utility/triplebuffer.h>
+
+// Audio includes
+#include <audio/core/audionode.h>
+#include <audio/utility/fft.h>
+
+namespace nap
+{
+	namespace audio
+	{
+
+		/**
+		 * Node that analyzes the spectrum of an audio signal on the audio thread.
+		 * Every hop the last fftSize samples are multiplied with a Hann window and transformed using a real FFT.
+		 * Consecutive analysis windows overlap when the hop size is smaller than the FFT size.
+		 * The magnitudes, phases and band energies of the last analysis are handed to the main thread without locking:
+		 * call @update() on the main thread and read the result using @getFrame().
+		 * All buffers are allocated on construction, the analysis does not allocate on the audio thread.
+		 */
+		class NAPAPI FFTNode : public Node
+		{
+			RTTI_ENABLE(Node)
+		
+		public:
+			/**
+			 * Result of one analysis.
+			 */
+			struct Frame
+			{
+				std::vector<float> mMagnitudes; // Amplitude per bin, from DC up to and including the Nyquist frequency. A full scale sine in the center of a bin measures 1.
+				std::vector<float> mPhases; // Phase in radians per bin
+				std::vector<float> mBandEnergies; // Sum of the squared magnitudes of the bins within each band
+				uint64_t mIndex = 0; // Number of analyses performed before this one
+			};
+
+			/**
+			 * @param nodeManager: the node manager this node is processed by
+			 * @param fftSize: number of samples analyzed at once, a power of two of at least 4. Determines the number of bins.
+			 * @param hopSize: number of samples in between the start of two analyses
+			 * @param bandEdges: edge frequencies in Hz of the bands whose energy is measured, in ascending order. N + 1 edges describe N bands.
+			 * @param rootProcess: indicates that the node is registered as root process with the @NodeManager and is processed automatically.
+			 */
+			FFTNode(NodeManager& nodeManager, int fftSize = 1024, int hopSize = 256, const std::vector<float>& bandEdges = {}, bool rootProcess = true);
+
+			virtual ~FFTNode();
+
+			InputPin input = {this}; /**< The input for the audio signal that will be analyzed. */
+
+			/**
+			 * Picks up the result of the last analysis performed on the audio thread. Call from the main thread only.
+			 * @return true if a new analysis was performed since the last update
+			 */
+			bool update();
+
+			/**
+			 * @return the result of the analysis picked up by the last @update(). Call from the main thread only.
+			 */
+			const Frame& getFrame() const { return mFrames.getReadBuffer(); }
+
+			/**
+			 * Sets the number of samples in between the start of two analyses, clamped to the range 1 to the FFT size.
+			 * Can be called from any thread.
+			 */
+			void setHopSize(int hopSize);
+
+			/**
+			 * @return the number of samples in between the start of two analyses.
+			 */
+			int getHopSize() const { return mHopSize.load(); }
+
+			/**
+			 * @return number of samples analyzed at once.
+			 */
+			int getFFTSize() const { return mFFT.getSize(); }
+
+			/**
+			 * @return number of bins in the magnitude and phase spectrum.
+			 */
+			int getBinCount() const { return mFFT.getBinCount(); }
+
+			/**
+			 * @return number of bands whose energy is measured.
+			 */
+			int getBandCount() const { return mBandEdges.size() > 1 ? mBandEdges.size() - 1 : 0; }
+
+			/**
+			 * @return the center frequency of a bin in Hz.
+			 */
+			float getBinFrequency(int bin) const;
+
+			/**
+			 * Creates the edges of logarithmically spaced bands, which roughly matches the perception of pitch.
+			 * @param bandCount: number of bands
+			 * @param minFrequency: lower edge of the first band in Hz, has to be larger than 0
+			 * @param maxFrequency: upper edge of the last band in Hz
+			 * @return bandCount + 1 edge frequencies
+			 */
+			static std::vector<float> makeLogarithmicBands(int bandCount, float minFrequency, float maxFrequency);
+
+			// Inherited from Node
+			void process() override;
+
+		private:
+			// Inherited from Node
+			void sampleRateChanged(float sampleRate) override;
+
+			// Windows and transforms the last fftSize samples and publishes the result
+			void analyze();
+
+			// Creates a frame with all buffers allocated, used to allocate the triple buffer up front
+			static Frame makeFrame(int binCount, int bandCount);
+
+			// Calculates the range of bins of every band for the current sample rate
+			void calculateBandBins(float sampleRate);
+
+			RealFFT mFFT; // The transform
+			std::vector<float> mWindow; // Hann window
+			std::vector<float> mHistory; // Circular buffer with the last fftSize input samples
+			std::vector<float> mWindowed; // Windowed samples being transformed
+			std::vector<std::complex<float>> mSpectrum; // Output of the transform
+			int mWriteIndex = 0; // Write index in mHistory
+			int mHopCounter = 0; // Samples received since the last analysis
+			uint64_t mAnalysisCount = 0; // Number of analyses performed
+			float mNormalization = 1.f; // Scales magnitudes to the amplitude of a sine
+			std::atomic<int> mHopSize = { 256 };
+
+			std::vector<float> mBandEdges; // Edge frequencies of the bands
+			std::vector<std::pair<int, int>> mBandBins; // First and last (exclusive) bin per band
+
+			nap::utility::TripleBuffer<Frame> mFrames; // Hands the analysis to the main thread, all three frames are allocated on construction
+
+			bool mRootProcess = false;
+		};
+
+	}
+}
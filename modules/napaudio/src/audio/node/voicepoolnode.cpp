@@ -0,0 +1,295 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "voicepoolnode.h"
+
+// Std includes
+#include <algorithm>
+
+// Audio includes
+#include <audio/core/audionodemanager.h>
+#include <audio/utility/audiofunctions.h>
+
+RTTI_BEGIN_ENUM(nap::audio::VoicePoolNode::EStealPolicy)
+	RTTI_ENUM_VALUE(nap::audio::VoicePoolNode::EStealPolicy::None, "None"),
+	RTTI_ENUM_VALUE(nap::audio::VoicePoolNode::EStealPolicy::Oldest, "Oldest"),
+	RTTI_ENUM_VALUE(nap::audio::VoicePoolNode::EStealPolicy::Quietest, "Quietest")
+RTTI_END_ENUM
+
+RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::VoicePoolNode)
+	RTTI_PROPERTY("leftOutput", &nap::audio::VoicePoolNode::leftOutput, nap::rtti::EPropertyMetaData::Embedded)
+	RTTI_PROPERTY("rightOutput", &nap::audio::VoicePoolNode::rightOutput, nap::rtti::EPropertyMetaData::Embedded)
+	RTTI_FUNCTION("stop", &nap::audio::VoicePoolNode::stop)
+	RTTI_FUNCTION("stopAll", &nap::audio::VoicePoolNode::stopAll)
+	RTTI_FUNCTION("getActiveVoiceCount", &nap::audio::VoicePoolNode::getActiveVoiceCount)
+RTTI_END_CLASS
+
+namespace nap
+{
+	namespace audio
+	{
+
+		VoicePoolNode::VoicePoolNode(NodeManager& nodeManager, int voiceCount, EStealPolicy stealPolicy, int commandQueueSize, TimeValue stealFadeTime) :
+			Node(nodeManager), mStealPolicy(stealPolicy), mCommands(commandQueueSize)
+		{
+			mVoices.resize(voiceCount);
+			mStealFadeSamples = std::max(1, int(stealFadeTime * nodeManager.getSamplesPerMillisecond()));
+		}
+
+
+		VoiceHandle VoicePoolNode::play(SafePtr<MultiSampleBuffer> buffer, float bufferSampleRate, const VoiceSettings& settings)
+		{
+			VoiceHandle handle = mNextHandle++;
+			Command command;
+			command.mType = Command::EType::Play;
+			command.mHandle = handle;
+			command.mSettings = settings;
+
+			// Convert times to buffer samples up front, the audio thread only deals with positions
+			float samplesPerMillisecond = bufferSampleRate / 1000.f;
+			command.mSpeed = std::max(settings.mSpeed, 0.f) * bufferSampleRate / getNodeManager().getSampleRate();
+			command.mStart = std::max(settings.mStartPosition, 0.f) * samplesPerMillisecond;
+			command.mEnd = settings.mDuration > 0.f ? command.mStart + settings.mDuration * samplesPerMillisecond : 0.0;
+			command.mBuffer = std::move(buffer);
+
+			if (!mCommands.try_enqueue(std::move(command)))
+			{
+				mDroppedVoiceCount++;
+				return 0;
+			}
+			return handle;
+		}
+
+
+		bool VoicePoolNode::stop(VoiceHandle voice, TimeValue releaseTime)
+		{
+			Command command;
+			command.mType = Command::EType::Stop;
+			command.mHandle = voice;
+			command.mSettings.mRelease = releaseTime;
+			return mCommands.try_enqueue(std::move(command));
+		}
+
+
+		bool VoicePoolNode::stopAll(TimeValue releaseTime)
+		{
+			Command command;
+			command.mType = Command::EType::StopAll;
+			command.mSettings.mRelease = releaseTime;
+			return mCommands.try_enqueue(std::move(command));
+		}
+
+
+		void VoicePoolNode::process()
+		{
+			// Handle at most the commands that were queued before this callback started
+			Command command;
+			auto commandCount = mCommands.size_approx();
+			for (auto i = 0; i < commandCount && mCommands.try_dequeue(command); ++i)
+				handleCommand(command);
+			command.mBuffer = nullptr;
+
+			auto& left = getOutputBuffer(leftOutput);
+			auto& right = getOutputBuffer(rightOutput);
+			std::fill(left.begin(), left.end(), 0.f);
+			std::fill(right.begin(), right.end(), 0.f);
+
+			int activeVoiceCount = 0;
+			for (auto& slot : mVoices)
+			{
+				if (slot.mTail.isActive())
+					renderVoice(slot.mTail, left, right);
+				if (slot.mVoice.isActive())
+				{
+					renderVoice(slot.mVoice, left, right);
+					activeVoiceCount++;
+				}
+			}
+			mActiveVoiceCount.store(activeVoiceCount);
+		}
+
+
+		void VoicePoolNode::handleCommand(Command& command)
+		{
+			float samplesPerMillisecond = getNodeManager().getSamplesPerMillisecond();
+			switch (command.mType)
+			{
+				case Command::EType::Play:
+					startVoice(command);
+					break;
+
+				case Command::EType::Stop:
+					for (auto& slot : mVoices)
+					{
+						if (slot.mVoice.isActive() && slot.mVoice.mHandle == command.mHandle)
+						{
+							auto releaseSamples = command.mSettings.mRelease < 0.f ? slot.mVoice.mReleaseSamples : int(command.mSettings.mRelease * samplesPerMillisecond);
+							release(slot.mVoice, releaseSamples);
+							break;
+						}
+					}
+					break;
+
+				case Command::EType::StopAll:
+					for (auto& slot : mVoices)
+					{
+						if (slot.mVoice.isActive())
+						{
+							auto releaseSamples = command.mSettings.mRelease < 0.f ? slot.mVoice.mReleaseSamples : int(command.mSettings.mRelease * samplesPerMillisecond);
+							release(slot.mVoice, releaseSamples);
+						}
+					}
+					break;
+			}
+		}
+
+
+		void VoicePoolNode::startVoice(Command& command)
+		{
+			if (command.mBuffer == nullptr || command.mSettings.mChannel < 0 || command.mSettings.mChannel >= command.mBuffer->getChannelCount())
+			{
+				mDroppedVoiceCount++;
+				return;
+			}
+
+			// Prefer a free slot
+			Slot* slot = nullptr;
+			for (auto& candidate : mVoices)
+			{
+				if (!candidate.mVoice.isActive())
+				{
+					slot = &candidate;
+					break;
+				}
+			}
+
+			// Steal a busy slot, handles increase so the lowest handle is the oldest voice.
+			// Slots that are still fading out a previously stolen voice are skipped, their tail is never cut off.
+			if (slot == nullptr && mStealPolicy != EStealPolicy::None)
+			{
+				auto loudness = [](const Voice& voice) { return voice.mEnvelope * std::max(voice.mLeftGain, voice.mRightGain); };
+				for (auto& candidate : mVoices)
+				{
+					if (candidate.mTail.isActive())
+						continue;
+					if (slot == nullptr || (mStealPolicy == EStealPolicy::Oldest ? candidate.mVoice.mHandle < slot->mVoice.mHandle : loudness(candidate.mVoice) < loudness(slot->mVoice)))
+						slot = &candidate;
+				}
+
+				// Fade out the stolen voice as the tail of the slot
+				if (slot != nullptr)
+				{
+					slot->mTail = slot->mVoice;
+					release(slot->mTail, mStealFadeSamples);
+					mStolenVoiceCount++;
+				}
+			}
+
+			if (slot == nullptr)
+			{
+				mDroppedVoiceCount++;
+				return;
+			}
+
+			float samplesPerMillisecond = getNodeManager().getSamplesPerMillisecond();
+			const auto& settings = command.mSettings;
+			auto& voice = slot->mVoice;
+			auto bufferEnd = double(command.mBuffer->getSize()) - 1.0;
+
+			voice.mHandle = command.mHandle;
+			voice.mBuffer = command.mBuffer;
+			voice.mChannel = settings.mChannel;
+			voice.mPosition = command.mStart;
+			voice.mSpeed = command.mSpeed;
+			voice.mEnd = command.mEnd > 0.0 ? std::min(command.mEnd, bufferEnd) : bufferEnd;
+			voice.mReleaseSamples = std::max(1, int(settings.mRelease * samplesPerMillisecond));
+			voice.mReleasePosition = voice.mEnd - voice.mReleaseSamples * voice.mSpeed;
+			equalPowerPan<float>(settings.mPanning, voice.mLeftGain, voice.mRightGain);
+			voice.mLeftGain *= settings.mGain;
+			voice.mRightGain *= settings.mGain;
+
+			auto attackSamples = int(settings.mAttack * samplesPerMillisecond);
+			voice.mEnvelope = attackSamples > 0 ? 0.f : 1.f;
+			voice.mAttackStep = attackSamples > 0 ? 1.f / attackSamples : 1.f;
+			voice.mStage = attackSamples > 0 ? Voice::EStage::Attack : Voice::EStage::Sustain;
+		}
+
+
+		void VoicePoolNode::release(Voice& voice, int releaseSamples)
+		{
+			voice.mStage = Voice::EStage::Release;
+			voice.mReleaseStep = voice.mEnvelope / std::max(1, releaseSamples);
+		}
+
+
+		void VoicePoolNode::renderVoice(Voice& voice, SampleBuffer& left, SampleBuffer& right)
+		{
+			// The buffer was released by its owner
+			if (voice.mBuffer == nullptr)
+			{
+				freeVoice(voice);
+				return;
+			}
+
+			const auto& samples = voice.mBuffer->channels[voice.mChannel];
+			for (auto i = 0; i < left.size(); ++i)
+			{
+				if (voice.mPosition >= voice.mEnd)
+				{
+					freeVoice(voice);
+					return;
+				}
+
+				switch (voice.mStage)
+				{
+					case Voice::EStage::Attack:
+						voice.mEnvelope += voice.mAttackStep;
+						if (voice.mEnvelope >= 1.f)
+						{
+							voice.mEnvelope = 1.f;
+							voice.mStage = Voice::EStage::Sustain;
+						}
+						// A voice shorter than its attack is released from the level it reached
+						if (voice.mPosition >= voice.mReleasePosition)
+							release(voice, voice.mReleaseSamples);
+						break;
+
+					case Voice::EStage::Sustain:
+						if (voice.mPosition >= voice.mReleasePosition)
+							release(voice, voice.mReleaseSamples);
+						break;
+
+					case Voice::EStage::Release:
+						voice.mEnvelope -= voice.mReleaseStep;
+						if (voice.mEnvelope <= 0.f)
+						{
+							freeVoice(voice);
+							return;
+						}
+						break;
+
+					default:
+						break;
+				}
+
+				// Linear interpolation in between buffer samples
+				auto index = size_t(voice.mPosition);
+				auto fraction = float(voice.mPosition - index);
+				auto sample = lerp<float>(samples[index], samples[index + 1], fraction) * voice.mEnvelope;
+				left[i] += sample * voice.mLeftGain;
+				right[i] += sample * voice.mRightGain;
+				voice.mPosition += voice.mSpeed;
+			}
+		}
+
+
+		void VoicePoolNode::freeVoice(Voice& voice)
+		{
+			voice.mStage = Voice::EStage::Idle;
+			voice.mHandle = 0;
+			voice.mBuffer = nullptr;
+		}
+
+	}
+}
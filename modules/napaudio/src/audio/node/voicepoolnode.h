@@ -0,0 +1,207 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Std includes
+#include <atomic>
+#include <vector>
+
+// Nap includes
+#include <concurrentqueue.h>
+
+// Audio includes
+#include <audio/core/audionode.h>
+#include <audio/utility/safeptr.h>
+
+namespace nap
+{
+	namespace audio
+	{
+
+		/**
+		 * Identifies a voice that was started by a @VoicePoolNode, 0 means no voice.
+		 */
+		using VoiceHandle = uint64_t;
+
+
+		/**
+		 * Settings of a single voice played by a @VoicePoolNode.
+		 */
+		struct NAPAPI VoiceSettings
+		{
+			int mChannel = 0; ///< Channel of the buffer to play
+			ControllerValue mGain = 1.f; ///< Gain factor
+			ControllerValue mPanning = 0.5f; ///< Panning in the stereo field: 0 means far left, 0.5 center and 1 far right
+			ControllerValue mSpeed = 1.f; ///< Playback speed as a fraction of the original, has to be larger than 0
+			TimeValue mStartPosition = 0.f; ///< Start position in the buffer in milliseconds
+			TimeValue mDuration = 0.f; ///< Duration in milliseconds of buffer material to play, 0 plays until the end of the buffer
+			TimeValue mAttack = 0.f; ///< Fade in time in milliseconds
+			TimeValue mRelease = 5.f; ///< Fade out time in milliseconds at the end of the voice or when it is stopped
+		};
+
+
+		/**
+		 * Plays buffers using a fixed number of preallocated voices, for polyphonic playback of many short samples.
+		 * Every voice is a buffer player with a linear attack and release envelope and an equal power panner,
+		 * rendered within this node instead of a chain of nodes per voice.
+		 * Voices are started and stopped from any thread through a lock free command queue of fixed size,
+		 * so triggering voices does not allocate and does not use the task queue of the node manager.
+		 * When all voices are busy a voice is stolen according to the steal policy. A stolen voice is faded out
+		 * over the steal fade time while the new voice starts in the same slot. A slot that is still fading out a stolen voice
+		 * is not stolen from again, when all slots are fading out the new voice is dropped.
+		 */
+		class NAPAPI VoicePoolNode : public Node
+		{
+			RTTI_ENABLE(Node)
+		public:
+			/**
+			 * Determines the voice to steal when all voices are busy.
+			 */
+			enum class EStealPolicy
+			{
+				None,           ///< Don't steal, the new voice is dropped
+				Oldest,         ///< Steal the voice that was started first
+				Quietest        ///< Steal the voice with the lowest envelope and gain
+			};
+
+			/**
+			 * @param nodeManager: the node manager this node is processed by
+			 * @param voiceCount: number of voices that can play at the same time
+			 * @param stealPolicy: determines the voice to steal when all voices are busy
+			 * @param commandQueueSize: maximum number of commands queued in between two audio callbacks
+			 * @param stealFadeTime: fade out time in milliseconds of a stolen voice
+			 */
+			VoicePoolNode(NodeManager& nodeManager, int voiceCount = 32, EStealPolicy stealPolicy = EStealPolicy::Oldest, int commandQueueSize = 1024, TimeValue stealFadeTime = 5.f);
+
+			OutputPin leftOutput = {this}; ///< Left channel of the mix of all voices
+			OutputPin rightOutput = {this}; ///< Right channel of the mix of all voices
+
+			/**
+			 * Starts a voice. Can be called from any thread.
+			 * @param buffer: the buffer to play
+			 * @param bufferSampleRate: sample rate of the buffer, playback speed is corrected for the sample rate of the node manager
+			 * @param settings: settings of the voice
+			 * @return handle to the voice, 0 when the command queue is full
+			 */
+			VoiceHandle play(SafePtr<MultiSampleBuffer> buffer, float bufferSampleRate, const VoiceSettings& settings);
+
+			/**
+			 * Releases a voice. Can be called from any thread.
+			 * @param voice: handle to the voice, voices that already finished are ignored
+			 * @param releaseTime: fade out time in milliseconds, a negative value uses the release time of the voice
+			 * @return false when the command queue is full
+			 */
+			bool stop(VoiceHandle voice, TimeValue releaseTime = -1.f);
+
+			/**
+			 * Releases all voices. Can be called from any thread.
+			 * @param releaseTime: fade out time in milliseconds, a negative value uses the release time of every voice
+			 * @return false when the command queue is full
+			 */
+			bool stopAll(TimeValue releaseTime = -1.f);
+
+			/**
+			 * @return number of voices playing at the end of the last audio callback.
+			 */
+			int getActiveVoiceCount() const { return mActiveVoiceCount.load(); }
+
+			/**
+			 * @return number of voices that could play at the same time.
+			 */
+			int getVoiceCount() const { return mVoices.size(); }
+
+			/**
+			 * @return total number of voices stolen.
+			 */
+			uint64_t getStolenVoiceCount() const { return mStolenVoiceCount.load(); }
+
+			/**
+			 * @return total number of voices dropped because all voices were busy and could not be stolen, or the command queue was full.
+			 */
+			uint64_t getDroppedVoiceCount() const { return mDroppedVoiceCount.load(); }
+
+		private:
+			/*
+			 * Command sent to the audio thread
+			 */
+			struct Command
+			{
+				enum class EType { Play, Stop, StopAll };
+
+				EType mType = EType::Play;
+				VoiceHandle mHandle = 0;
+				SafePtr<MultiSampleBuffer> mBuffer = nullptr;
+				VoiceSettings mSettings;
+				double mSpeed = 1.0; // Buffer samples per output sample
+				double mStart = 0.0; // Start position in buffer samples
+				double mEnd = 0.0; // End position in buffer samples, 0 plays until the end
+			};
+
+			/*
+			 * State of a single voice
+			 */
+			struct Voice
+			{
+				enum class EStage { Idle, Attack, Sustain, Release };
+
+				VoiceHandle mHandle = 0;
+				SafePtr<MultiSampleBuffer> mBuffer = nullptr;
+				int mChannel = 0;
+				double mPosition = 0.0; // Read position in buffer samples
+				double mSpeed = 1.0;
+				double mEnd = 0.0; // Read position at which the voice ends
+				double mReleasePosition = 0.0; // Read position at which the release starts
+				float mLeftGain = 0.f;
+				float mRightGain = 0.f;
+				float mEnvelope = 0.f;
+				float mAttackStep = 1.f; // Envelope increment per sample during the attack
+				float mReleaseStep = 1.f; // Envelope decrement per sample during the release
+				int mReleaseSamples = 0; // Release time in samples
+				EStage mStage = EStage::Idle;
+
+				bool isActive() const { return mStage != EStage::Idle; }
+			};
+
+			/*
+			 * A voice and the tail of the voice that was stolen from its slot
+			 */
+			struct Slot
+			{
+				Voice mVoice;
+				Voice mTail;
+			};
+
+			// Inherited from Node
+			void process() override;
+
+			// Handles a command on the audio thread
+			void handleCommand(Command& command);
+
+			// Starts a voice in a free or stolen slot
+			void startVoice(Command& command);
+
+			// Starts the release of a voice
+			void release(Voice& voice, int releaseSamples);
+
+			// Mixes one voice into the output buffers
+			void renderVoice(Voice& voice, SampleBuffer& left, SampleBuffer& right);
+
+			// Frees a voice and its buffer
+			void freeVoice(Voice& voice);
+
+			std::vector<Slot> mVoices; // All voices, allocated on construction
+			EStealPolicy mStealPolicy = EStealPolicy::Oldest;
+			int mStealFadeSamples = 0;
+
+			moodycamel::ConcurrentQueue<Command> mCommands; // Commands from other threads, with a fixed capacity
+			std::atomic<VoiceHandle> mNextHandle = { 1 };
+
+			std::atomic<int> mActiveVoiceCount = { 0 };
+			std::atomic<uint64_t> mStolenVoiceCount = { 0 };
+			std::atomic<uint64_t> mDroppedVoiceCount = { 0 };
+		};
+
+	}
+}
@@ -6,7 +6,9 @@
 
 // audio includes
 #include <audio/service/audioservice.h>
-#include <audio/utility/audiofileutils.h>
+
+// Std includes
+#include <algorithm>
 
 // RTTI
 RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::AudioFileResource)
@@ -27,7 +29,7 @@ namespace nap
 		bool AudioFileResource::init(utility::ErrorState& errorState)
 		{
 			float sampleRate;
-			if (readAudioFile(mAudioFilePath, *getBuffer(), sampleRate, errorState))
+			if (mService.loadAudioFile(mAudioFilePath, *getBuffer(), sampleRate, errorState))
 			{
 				setSampleRate(sampleRate);
 				return true;
@@ -38,29 +40,37 @@ namespace nap
 		
 		bool MultiAudioFileResource::init(utility::ErrorState& errorState)
 		{
-			float sampleRate = 0;
-			
 			if (mAudioFilePaths.empty())
 			{
 				errorState.fail("MultiAudioFileResource: need at least one audio file path");
 				return false;
 			}
 			
-			for (auto i = 0; i < mAudioFilePaths.size(); ++i)
+			std::vector<MultiSampleBuffer> buffers;
+			std::vector<float> sampleRates;
+			if (!mService.loadAudioFiles(mAudioFilePaths, buffers, sampleRates, errorState))
+				return false;
+			
+			for (auto i = 1; i < sampleRates.size(); ++i)
 			{
-				if (readAudioFile(mAudioFilePaths[i], *getBuffer(), sampleRate, errorState))
-				{
-					if (i == 0)
-						setSampleRate(sampleRate);
-					else {
-						if (sampleRate != getSampleRate()) {
-							errorState.fail("MultiAudioFileResource: files have different sample rates.");
-							return false;
-						}
-					}
-				} else
+				if (sampleRates[i] != sampleRates[0]) {
+					errorState.fail("MultiAudioFileResource: files have different sample rates.");
 					return false;
+				}
+			}
+			setSampleRate(sampleRates[0]);
+			
+			// Append the channels in the order of the paths, shorter files are padded with silence
+			auto& output = *getBuffer();
+			size_t frameCount = 0;
+			for (auto& buffer : buffers)
+			{
+				frameCount = std::max<size_t>(frameCount, buffer.getSize());
+				for (auto& channel : buffer.channels)
+					output.channels.emplace_back(std::move(channel));
 			}
+			for (auto& channel : output.channels)
+				channel.resize(frameCount, 0.f);
 			
 			return true;
 		}
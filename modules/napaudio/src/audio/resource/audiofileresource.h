@@ -26,32 +26,39 @@ namespace nap
 		{
 			RTTI_ENABLE(AudioBufferResource)
 		public:
-			AudioFileResource(AudioService& service) : AudioBufferResource(service) { }
+			AudioFileResource(AudioService& service) : AudioBufferResource(service), mService(service) { }
 			
 			// Inherited from AudioBufferResource
 			bool init(utility::ErrorState& errorState) override;
 		
 		public:
 			std::string mAudioFilePath = ""; ///< property: 'AudioFilePath' The path to the audio file on disk
+		
+		private:
+			AudioService& mService;
 		};
 		
 		
 		/**
 		 * An audio buffer resource whose content is made up out of the content of multiple audio files on disk.
 		 * Each file adds it's channels as new channels to the resource. So two stereo files will make a quadro resource.
+		 * The files are loaded in parallel.
 		 */
 		class NAPAPI MultiAudioFileResource : public AudioBufferResource
 		{
 			RTTI_ENABLE(AudioBufferResource)
 		
 		public:
-			MultiAudioFileResource(AudioService& service) : AudioBufferResource(service) { }
+			MultiAudioFileResource(AudioService& service) : AudioBufferResource(service), mService(service) { }
 			
 			// Inherited from AudioBufferResource
 			bool init(utility::ErrorState& errorState) override;
 		
 		public:
 			std::vector<std::string> mAudioFilePaths; ///< property: 'AudioFilePaths' The paths to the audio files on disk
+		
+		private:
+			AudioService& mService;
 		};
 		
 		
@@ -0,0 +1,50 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "voicepool.h"
+
+// Audio includes
+#include <audio/service/audioservice.h>
+
+RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::VoicePool)
+	RTTI_CONSTRUCTOR(nap::audio::AudioService &)
+	RTTI_PROPERTY("VoiceCount", &nap::audio::VoicePool::mVoiceCount, nap::rtti::EPropertyMetaData::Default)
+	RTTI_PROPERTY("StealPolicy", &nap::audio::VoicePool::mStealPolicy, nap::rtti::EPropertyMetaData::Default)
+	RTTI_PROPERTY("StealFadeTime", &nap::audio::VoicePool::mStealFadeTime, nap::rtti::EPropertyMetaData::Default)
+	RTTI_PROPERTY("CommandQueueSize", &nap::audio::VoicePool::mCommandQueueSize, nap::rtti::EPropertyMetaData::Default)
+	RTTI_FUNCTION("stop", &nap::audio::VoicePool::stop)
+	RTTI_FUNCTION("stopAll", &nap::audio::VoicePool::stopAll)
+RTTI_END_CLASS
+
+namespace nap
+{
+	namespace audio
+	{
+
+		VoicePool::VoicePool(AudioService& service) : mService(service)
+		{
+		}
+
+
+		bool VoicePool::init(utility::ErrorState& errorState)
+		{
+			if (!errorState.check(mVoiceCount > 0, "%s: VoiceCount has to be larger than 0", mID.c_str()))
+				return false;
+
+			if (!errorState.check(mCommandQueueSize > 0, "%s: CommandQueueSize has to be larger than 0", mID.c_str()))
+				return false;
+
+			auto& nodeManager = mService.getNodeManager();
+			mNode = nodeManager.makeSafe<VoicePoolNode>(nodeManager, mVoiceCount, mStealPolicy, mCommandQueueSize, mStealFadeTime);
+			return true;
+		}
+
+
+		VoiceHandle VoicePool::play(AudioBufferResource& buffer, const VoiceSettings& settings)
+		{
+			return mNode->play(buffer.getBuffer(), buffer.getSampleRate(), settings);
+		}
+
+	}
+}
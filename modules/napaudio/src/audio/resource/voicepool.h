@@ -0,0 +1,83 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Nap includes
+#include <nap/resource.h>
+#include <audio/utility/safeptr.h>
+#include <rtti/factory.h>
+
+// Audio includes
+#include <audio/node/voicepoolnode.h>
+#include <audio/resource/audiobufferresource.h>
+
+namespace nap
+{
+	namespace audio
+	{
+
+		// Forward declarations
+		class AudioService;
+
+		/**
+		 * Pool of preallocated voices to play many short buffers at the same time, for example one-shot samples.
+		 * Starting a voice does not create nodes, does not allocate and does not use the task queue of the node manager.
+		 * Use a @VoicePoolComponent to route the stereo output of the pool.
+		 */
+		class NAPAPI VoicePool : public Resource
+		{
+			RTTI_ENABLE(Resource)
+		public:
+			VoicePool(AudioService& service);
+
+			/**
+			 * Allocates all voices.
+			 * @param errorState contains the error if initialization fails
+			 * @return if initialization succeeded
+			 */
+			bool init(utility::ErrorState& errorState) override;
+
+			/**
+			 * Starts a voice. Can be called from any thread.
+			 * @param buffer: the buffer to play
+			 * @param settings: settings of the voice
+			 * @return handle to the voice, 0 when the command queue is full
+			 */
+			VoiceHandle play(AudioBufferResource& buffer, const VoiceSettings& settings = {});
+
+			/**
+			 * Releases a voice. Can be called from any thread.
+			 * @param voice: handle to the voice
+			 * @param releaseTime: fade out time in milliseconds, a negative value uses the release time of the voice
+			 * @return false when the command queue is full
+			 */
+			bool stop(VoiceHandle voice, TimeValue releaseTime = -1.f) { return mNode->stop(voice, releaseTime); }
+
+			/**
+			 * Releases all voices. Can be called from any thread.
+			 * @param releaseTime: fade out time in milliseconds, a negative value uses the release time of every voice
+			 * @return false when the command queue is full
+			 */
+			bool stopAll(TimeValue releaseTime = -1.f) { return mNode->stopAll(releaseTime); }
+
+			/**
+			 * @return the node that renders all voices.
+			 */
+			VoicePoolNode& getNode() { return *mNode; }
+
+			int mVoiceCount = 32; ///< property: 'VoiceCount' Number of voices that can play at the same time
+			VoicePoolNode::EStealPolicy mStealPolicy = VoicePoolNode::EStealPolicy::Oldest; ///< property: 'StealPolicy' Voice to steal when all voices are busy
+			TimeValue mStealFadeTime = 5.f; ///< property: 'StealFadeTime' Fade out time in milliseconds of a stolen voice
+			int mCommandQueueSize = 1024; ///< property: 'CommandQueueSize' Maximum number of commands queued in between two audio callbacks
+
+		private:
+			AudioService& mService;
+			SafeOwner<VoicePoolNode> mNode = nullptr;
+		};
+
+		using VoicePoolObjectCreator = rtti::ObjectCreator<VoicePool, AudioService>;
+
+	}
+}
@@ -7,12 +7,14 @@
 
 // Nap includes
 #include <nap/logger.h>
+#include <nap/profiler.h>
 #include <utility/stringutils.h>
 
 // Audio includes
 #include "audioservice.h"
 #include <audio/resource/audiobufferresource.h>
 #include <audio/resource/audiofileresource.h>
+#include <audio/resource/voicepool.h>
 
 //#include <audio/core/graph.h>
 //#include <audio/core/voice.h>
@@ -44,6 +46,12 @@ RTTI_BEGIN_CLASS(nap::audio::AudioServiceConfiguration)
 		              nap::rtti::EPropertyMetaData::Default)
 	RTTI_PROPERTY("InternalBufferSize", &nap::audio::AudioServiceConfiguration::mInternalBufferSize,
 		              nap::rtti::EPropertyMetaData::Default)
+	RTTI_PROPERTY("ResampleAudioFiles", &nap::audio::AudioServiceConfiguration::mResampleAudioFiles,
+		              nap::rtti::EPropertyMetaData::Default)
+	RTTI_PROPERTY("AudioFileCacheDirectory", &nap::audio::AudioServiceConfiguration::mAudioFileCacheDirectory,
+		              nap::rtti::EPropertyMetaData::Default)
+	RTTI_PROPERTY("AudioFileLoaderThreadCount", &nap::audio::AudioServiceConfiguration::mAudioFileLoaderThreadCount,
+		              nap::rtti::EPropertyMetaData::Default)
 RTTI_END_CLASS
 
 RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::AudioService)
@@ -86,6 +94,7 @@ namespace nap
 			factory.addObjectCreator(std::make_unique<AudioBufferResourceObjectCreator>(*this));
 			factory.addObjectCreator(std::make_unique<AudioFileResourceObjectCreator>(*this));
 			factory.addObjectCreator(std::make_unique<MultiAudioFileResourceObjectCreator>(*this));
+			factory.addObjectCreator(std::make_unique<VoicePoolObjectCreator>(*this));
 		}
 		
 		
@@ -222,12 +231,44 @@ namespace nap
 		}
 
 
+		void AudioService::postResourcesLoaded()
+		{
+			if (mAudioFileLoader == nullptr)
+				return;
+			mAudioFileLoader->logStatistics();
+			mAudioFileLoader->resetStatistics();
+		}
+
+
 		NodeManager& AudioService::getNodeManager()
 		{
 			return mNodeManager;
 		}
 
 
+		bool AudioService::loadAudioFile(const std::string& fileName, MultiSampleBuffer& output, float& outSampleRate, utility::ErrorState& errorState)
+		{
+			return getAudioFileLoader().load(fileName, getAudioFileSampleRate(), output, outSampleRate, errorState);
+		}
+
+
+		bool AudioService::loadAudioFiles(const std::vector<std::string>& fileNames, std::vector<MultiSampleBuffer>& outputs, std::vector<float>& outSampleRates, utility::ErrorState& errorState)
+		{
+			return getAudioFileLoader().load(fileNames, getAudioFileSampleRate(), outputs, outSampleRates, errorState);
+		}
+
+
+		AudioFileLoader& AudioService::getAudioFileLoader()
+		{
+			if (mAudioFileLoader == nullptr)
+			{
+				auto configuration = getConfiguration<AudioServiceConfiguration>();
+				mAudioFileLoader = std::make_unique<AudioFileLoader>(configuration->mAudioFileCacheDirectory, configuration->mAudioFileLoaderThreadCount);
+			}
+			return *mAudioFileLoader;
+		}
+
+
 		bool AudioService::openStream(int inputDeviceIndex, int outputDeviceIndex, int inputChannelCount,
 		                              int outputChannelCount, float sampleRate, int bufferSize, int internalBufferSize,
 		                              utility::ErrorState& errorState)
@@ -443,6 +484,8 @@ namespace nap
 		
 		void AudioService::onAudioCallback(float** inputBuffer, float** outputBuffer, unsigned long framesPerBuffer)
 		{
+			NAP_PROFILE_SCOPE("AudioService::onAudioCallback")
+
 			// process the node manager
 			mNodeManager.process(inputBuffer, outputBuffer, framesPerBuffer);
 			
@@ -590,6 +633,17 @@ namespace nap
 		}
 		
 		
+		float AudioService::getAudioFileSampleRate()
+		{
+			auto configuration = getConfiguration<AudioServiceConfiguration>();
+			if (!configuration->mResampleAudioFiles)
+				return 0.f;
+			
+			// Without an opened stream the node manager has no sample rate yet
+			return mNodeManager.getSampleRate() > 0.f ? mNodeManager.getSampleRate() : configuration->mSampleRate;
+		}
+		
+		
 		int AudioService::getDeviceIndex(int hostApiIndex, int hostApiDeviceIndex)
 		{
 			return Pa_HostApiDeviceIndexToDeviceIndex(hostApiIndex, hostApiDeviceIndex);
@@ -6,6 +6,7 @@
 
 // Audio includes
 #include <audio/core/audionodemanager.h>
+#include <audio/utility/audiofileloader.h>
 #include <audio/utility/safeptr.h>
 
 // Nap includes
@@ -96,6 +97,21 @@ namespace nap
 			 * Lowering this can improve timing precision in the case that the node manager performs internal event scheduling, however will increase performance load.
 			 */
 			int mInternalBufferSize = 1024;
+			
+			/**
+			 * If set to true, audio files are converted to the sample rate of the audio stream when they are loaded.
+			 */
+			bool mResampleAudioFiles = true;
+			
+			/**
+			 * Directory to cache decoded and converted audio files in, speeds up loading the next time. If left empty no cache is used.
+			 */
+			std::string mAudioFileCacheDirectory = "";
+			
+			/**
+			 * Maximum number of threads used to load multiple audio files in parallel, 0 uses the number of hardware threads.
+			 */
+			int mAudioFileLoaderThreadCount = 0;
 		};
 		
 		/**
@@ -126,6 +142,11 @@ namespace nap
 			 */
 			 void shutdown() override;
 
+			/**
+			 * Logs and resets the statistics of the audio files loaded with the resources.
+			 */
+			void postResourcesLoaded() override;
+
 			/**
 			 * @return the audio node manager owned by the audio service. The @NodeManager contains a node system that performs all the DSP.
 			 */
@@ -283,6 +304,31 @@ namespace nap
 			 * Enqueue a task to be executed within the process() method for thread safety
 			 */
 			void enqueueTask(TaskQueue::Task task) { mNodeManager.enqueueTask(task); }
+			
+			/**
+			 * Loads an audio file, converted to the sample rate of the audio stream unless resampling is disabled in the configuration.
+			 * @param fileName: the audio file to load
+			 * @param output: the loaded channels are appended to this buffer
+			 * @param outSampleRate: the sample rate of the loaded channels
+			 * @param errorState: contains the error when loading fails
+			 * @return true on success
+			 */
+			bool loadAudioFile(const std::string& fileName, MultiSampleBuffer& output, float& outSampleRate, utility::ErrorState& errorState);
+			
+			/**
+			 * Loads multiple audio files in parallel, converted to the sample rate of the audio stream unless resampling is disabled in the configuration.
+			 * @param fileNames: the audio files to load
+			 * @param outputs: a buffer for every file
+			 * @param outSampleRates: the sample rate of every loaded file
+			 * @param errorState: contains the errors of all files that failed to load
+			 * @return true if all files loaded
+			 */
+			bool loadAudioFiles(const std::vector<std::string>& fileNames, std::vector<MultiSampleBuffer>& outputs, std::vector<float>& outSampleRates, utility::ErrorState& errorState);
+			
+			/**
+			 * @return the loader used to load audio files, creates it on first use.
+			 */
+			AudioFileLoader& getAudioFileLoader();
 		
 		private:
 			/*
@@ -300,6 +346,11 @@ namespace nap
 			 * Copies the current settings to the configuration object.
 			 */
 			void saveConfiguration();
+			
+			/*
+			 * Returns the sample rate audio files are converted to, 0 if they are not converted.
+			 */
+			float getAudioFileSampleRate();
 		
 		private:
 			NodeManager mNodeManager; // The node manager that performs the audio processing.
@@ -314,6 +365,8 @@ namespace nap
 			// DeletionQueue with nodes that are no longer used and that can be cleared and destructed safely on the next audio callback.
 			// Clearing is performed on the audio callback to make sure the node can not be destructed while it is being processed.
 			DeletionQueue mDeletionQueue;
+			
+			std::unique_ptr<AudioFileLoader> mAudioFileLoader = nullptr; // Loads and converts audio files for the file resources
 		};
 	}
 }
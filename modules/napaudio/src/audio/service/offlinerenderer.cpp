@@ -0,0 +1,173 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "offlinerenderer.h"
+
+// Std includes
+#include <algorithm>
+#include <cmath>
+
+// Nap includes
+#include <nap/logger.h>
+#include <nap/datetime.h>
+
+// Audio includes
+#include <audio/service/audioservice.h>
+#include <audio/core/audionode.h>
+#include <audio/utility/audiofileutils.h>
+
+namespace nap
+{
+	namespace audio
+	{
+
+		OfflineRenderer::OfflineRenderer(AudioService& service, int outputChannelCount, float sampleRate, int bufferSize) :
+			mService(service), mOutputChannelCount(outputChannelCount), mSampleRate(sampleRate), mBufferSize(bufferSize)
+		{
+		}
+
+
+		bool OfflineRenderer::render(double duration, MultiSampleBuffer& output, utility::ErrorState& errorState)
+		{
+			// Reserve up front, to keep allocations out of the render statistics
+			output.resize(mOutputChannelCount, 0);
+			output.reserve(mOutputChannelCount, static_cast<size_t>(std::ceil(duration * mSampleRate)));
+			return renderToSink(duration, [&](const float* const* block, unsigned long frameCount, utility::ErrorState&)
+			{
+				for (auto channel = 0; channel < mOutputChannelCount; ++channel)
+					output[channel].insert(output[channel].end(), block[channel], block[channel] + frameCount);
+				return true;
+			}, errorState);
+		}
+
+
+		bool OfflineRenderer::render(double duration, const std::string& fileName, utility::ErrorState& errorState)
+		{
+			AudioFileWriter writer;
+			if (!writer.open(fileName, mOutputChannelCount, mSampleRate, errorState))
+				return false;
+
+			return renderToSink(duration, [&](const float* const* block, unsigned long frameCount, utility::ErrorState& error)
+			{
+				return writer.write(block, frameCount, error);
+			}, errorState);
+		}
+
+
+		void OfflineRenderer::logStatistics(int nodeCount) const
+		{
+			Logger::info("Offline render: %.2f seconds of audio in %.3f seconds, real-time factor %.1f",
+			             mStatistics.mRenderedTime, mStatistics.mWallTime, mStatistics.mRealTimeFactor);
+			if (mStatistics.mAllocationCount >= 0)
+				Logger::info("Offline render: %lld allocations", static_cast<long long>(mStatistics.mAllocationCount));
+
+			auto count = std::min<int>(nodeCount, mStatistics.mNodeTimes.size());
+			for (auto i = 0; i < count; ++i)
+			{
+				const auto& node_time = mStatistics.mNodeTimes[i];
+				Logger::info("Offline render: %s: %.3f ms, %.2f%% of real-time", node_time.mType.c_str(), node_time.mCPUTime * 1000.0,
+				             mStatistics.mRenderedTime > 0.0 ? 100.0 * node_time.mCPUTime / mStatistics.mRenderedTime : 0.0);
+			}
+		}
+
+
+		bool OfflineRenderer::renderToSink(double duration, const Sink& sink, utility::ErrorState& errorState)
+		{
+			NodeManager& node_manager = mService.getNodeManager();
+			if (!errorState.check(mOutputChannelCount > 0 && mSampleRate > 0 && mBufferSize > 0,
+			                      "OfflineRenderer: invalid channel count, sample rate or buffer size"))
+				return false;
+
+			if (!errorState.check(mBufferSize % node_manager.getInternalBufferSize() == 0,
+			                      "OfflineRenderer: Internal buffer size does not fit buffer size"))
+				return false;
+
+			// The node system can't be processed by the audio device and the renderer at the same time
+			bool restart = mService.isOpened() && mService.isActive();
+			if (restart && !mService.stop(errorState))
+				return false;
+
+			// Apply render settings, the original settings are restored afterwards
+			int previous_channel_count = node_manager.getOutputChannelCount();
+			float previous_sample_rate = node_manager.getSampleRate();
+			if (mOutputChannelCount != previous_channel_count)
+				node_manager.setOutputChannelCount(mOutputChannelCount);
+			if (mSampleRate != previous_sample_rate)
+				node_manager.setSampleRate(mSampleRate);
+
+			// Silent input and output buffers, allocated up front
+			int input_channel_count = node_manager.getInputChannelCount();
+			MultiSampleBuffer input_buffer(input_channel_count, mBufferSize);
+			MultiSampleBuffer output_buffer(mOutputChannelCount, mBufferSize);
+			std::vector<float*> input_channels;
+			std::vector<float*> output_channels;
+			for (auto& channel : input_buffer.channels)
+				input_channels.emplace_back(channel.data());
+			for (auto& channel : output_buffer.channels)
+				output_channels.emplace_back(channel.data());
+
+			if (mProfilingEnabled)
+			{
+				for (auto node : node_manager.getNodes())
+					node->resetCPUTime();
+				node_manager.setProfilingEnabled(true);
+			}
+
+			// Render as fast as possible
+			auto total_frames = static_cast<uint64_t>(std::ceil(duration * mSampleRate));
+			uint64_t rendered_frames = 0;
+			uint64_t start_allocations = mAllocationCounter ? mAllocationCounter() : 0;
+			auto start_time = HighResolutionClock::now();
+			bool success = true;
+			while (rendered_frames < total_frames)
+			{
+				mService.onAudioCallback(input_channels.data(), output_channels.data(), mBufferSize);
+
+				auto frame_count = static_cast<unsigned long>(std::min<uint64_t>(mBufferSize, total_frames - rendered_frames));
+				if (!sink(output_channels.data(), frame_count, errorState))
+				{
+					success = false;
+					break;
+				}
+				rendered_frames += frame_count;
+			}
+			auto wall_time = std::chrono::duration<double>(HighResolutionClock::now() - start_time).count();
+
+			// Gather statistics
+			mStatistics = OfflineRenderStatistics();
+			mStatistics.mRenderedTime = rendered_frames / static_cast<double>(mSampleRate);
+			mStatistics.mWallTime = wall_time;
+			mStatistics.mRealTimeFactor = wall_time > 0.0 ? mStatistics.mRenderedTime / wall_time : 0.0;
+			if (mAllocationCounter)
+				mStatistics.mAllocationCount = static_cast<int64_t>(mAllocationCounter() - start_allocations);
+
+			if (mProfilingEnabled)
+			{
+				node_manager.setProfilingEnabled(false);
+				for (auto node : node_manager.getNodes())
+					mStatistics.mNodeTimes.push_back({ node, node->get_type().get_name().to_string(), node->getCPUTime() });
+				std::sort(mStatistics.mNodeTimes.begin(), mStatistics.mNodeTimes.end(), [](const auto& a, const auto& b)
+				{
+					return a.mCPUTime > b.mCPUTime;
+				});
+			}
+
+			// Restore settings and device processing
+			if (mOutputChannelCount != previous_channel_count)
+				node_manager.setOutputChannelCount(previous_channel_count);
+			if (mSampleRate != previous_sample_rate && previous_sample_rate > 0)
+				node_manager.setSampleRate(previous_sample_rate);
+
+			if (restart)
+			{
+				utility::ErrorState start_error;
+				if (!mService.start(start_error))
+					Logger::warn("OfflineRenderer: %s", start_error.toString().c_str());
+			}
+
+			return success;
+		}
+
+	}
+}
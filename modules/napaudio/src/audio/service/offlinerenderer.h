@@ -0,0 +1,140 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Std includes
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Nap includes
+#include <utility/errorstate.h>
+
+// Audio includes
+#include <audio/utility/audiotypes.h>
+
+namespace nap
+{
+	namespace audio
+	{
+
+		// Forward declarations
+		class AudioService;
+		class Node;
+
+		/**
+		 * Statistics of the last render of an @OfflineRenderer
+		 */
+		struct NAPAPI OfflineRenderStatistics
+		{
+			/**
+			 * CPU time spent by a single node
+			 */
+			struct NodeTime
+			{
+				const Node* mNode = nullptr; // The node, only valid as long as the node exists
+				std::string mType; // Type name of the node
+				double mCPUTime = 0.0; // Seconds spent processing the node, excluding the time spent on its inputs
+			};
+
+			double mRenderedTime = 0.0; // Seconds of audio rendered
+			double mWallTime = 0.0; // Seconds it took to render the audio
+			double mRealTimeFactor = 0.0; // Rendered time divided by wall time, higher is faster
+			int64_t mAllocationCount = -1; // Number of allocations on the render thread, -1 when no allocation counter is set
+			std::vector<NodeTime> mNodeTimes; // CPU time of every node, from most to least expensive. Empty when profiling is disabled.
+		};
+
+
+		/**
+		 * Drives the node system of the @AudioService without an audio device, as fast as the CPU allows.
+		 * The output of the node system is written to a wav file or a memory buffer, silence is fed to the inputs.
+		 * The audio stream of the service is stopped while rendering and restarted afterwards when it was running.
+		 * Because no device is needed this can be used to render audio on machines without an audio device,
+		 * and as a benchmark of a node graph: the statistics of every render contain the real-time factor,
+		 * the CPU time of every node and optionally the number of allocations on the render thread.
+		 * Rendering happens on the calling thread, which acts as the audio thread for the duration of the render.
+		 */
+		class NAPAPI OfflineRenderer final
+		{
+		public:
+			/**
+			 * Function that returns the total number of allocations made by the calling thread.
+			 * Counting allocations requires replacing the global operator new, which is up to the application.
+			 */
+			using AllocationCounter = std::function<uint64_t()>;
+
+			/**
+			 * Constructor
+			 * @param service: the audio service of which the node system is rendered
+			 * @param outputChannelCount: number of output channels to render
+			 * @param sampleRate: sample rate to render at
+			 * @param bufferSize: number of samples per channel processed per callback, has to be a multiple of the internal buffer size of the node manager
+			 */
+			OfflineRenderer(AudioService& service, int outputChannelCount, float sampleRate, int bufferSize);
+
+			/**
+			 * Renders the output of the node system into a memory buffer.
+			 * @param duration: the time to render in seconds
+			 * @param output: the buffer to render into, resized to the output channel count and the rendered number of samples
+			 * @param errorState: contains the error when rendering fails
+			 * @return: true on success
+			 */
+			bool render(double duration, MultiSampleBuffer& output, utility::ErrorState& errorState);
+
+			/**
+			 * Renders the output of the node system into a wav file, block by block.
+			 * @param duration: the time to render in seconds
+			 * @param fileName: the wav file to render into, an existing file is overwritten
+			 * @param errorState: contains the error when rendering fails
+			 * @return: true on success
+			 */
+			bool render(double duration, const std::string& fileName, utility::ErrorState& errorState);
+
+			/**
+			 * Enables measuring the CPU time of every node during a render.
+			 * @param enable: if the CPU time of every node is measured
+			 */
+			void setProfilingEnabled(bool enable) { mProfilingEnabled = enable; }
+
+			/**
+			 * Sets the function used to count allocations on the render thread.
+			 * @param counter: returns the total number of allocations made by the calling thread
+			 */
+			void setAllocationCounter(AllocationCounter counter) { mAllocationCounter = std::move(counter); }
+
+			/**
+			 * @return: statistics of the last render
+			 */
+			const OfflineRenderStatistics& getStatistics() const { return mStatistics; }
+
+			/**
+			 * Logs the statistics of the last render.
+			 * @param nodeCount: maximum number of nodes to log, starting with the most expensive node
+			 */
+			void logStatistics(int nodeCount = 10) const;
+
+		private:
+			/*
+			 * Function that receives every rendered block of audio
+			 */
+			using Sink = std::function<bool(const float* const* output, unsigned long frameCount, utility::ErrorState& errorState)>;
+
+			/*
+			 * Renders the node system and passes every rendered block to the sink.
+			 */
+			bool renderToSink(double duration, const Sink& sink, utility::ErrorState& errorState);
+
+			AudioService& mService; // The service of which the node system is rendered
+			int mOutputChannelCount = 0; // Number of output channels to render
+			float mSampleRate = 0; // Sample rate to render at
+			int mBufferSize = 0; // Number of samples per channel per callback
+			bool mProfilingEnabled = true; // If the CPU time of every node is measured
+			AllocationCounter mAllocationCounter; // Counts allocations on the render thread, optional
+			OfflineRenderStatistics mStatistics; // Statistics of the last render
+		};
+
+	}
+}
@@ -0,0 +1,278 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "audiofileloader.h"
+
+// Std includes
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <thread>
+
+// Nap includes
+#include <nap/datetime.h>
+#include <nap/logger.h>
+#include <utility/fileutils.h>
+#include <utility/threading.h>
+
+// Audio includes
+#include <audio/utility/audiofileutils.h>
+
+namespace nap
+{
+
+	namespace audio
+	{
+
+		// Identifies a cache file and its version
+		static const char cacheMagic[8] = { 'N', 'A', 'P', 'P', 'C', 'M', '0', '1' };
+
+
+		/**
+		 * Header of a cache file, followed by the source path and the samples of every channel.
+		 */
+		struct CacheHeader
+		{
+			char mMagic[8];
+			uint64_t mModificationTime = 0; // Modification time of the source file when it was cached
+			uint32_t mPathLength = 0; // Length of the source path that follows the header
+			uint32_t mChannelCount = 0;
+			uint64_t mFrameCount = 0;
+			float mSampleRate = 0.f;
+		};
+
+
+		static uint64_t getByteCount(const MultiSampleBuffer& buffer)
+		{
+			return buffer.getChannelCount() * buffer.getSize() * sizeof(SampleValue);
+		}
+
+
+		AudioFileLoader::AudioFileLoader(const std::string& cacheDirectory, int threadCount) :
+			mCacheDirectory(cacheDirectory), mThreadCount(threadCount)
+		{
+			if (mThreadCount <= 0)
+				mThreadCount = std::max(1u, std::thread::hardware_concurrency());
+
+			if (!mCacheDirectory.empty() && !utility::dirExists(mCacheDirectory) && !utility::makeDirs(mCacheDirectory))
+			{
+				Logger::warn("AudioFileLoader: failed to create cache directory %s, caching disabled", mCacheDirectory.c_str());
+				mCacheDirectory.clear();
+			}
+		}
+
+
+		bool AudioFileLoader::load(const std::string& fileName, float sampleRate, MultiSampleBuffer& output, float& outSampleRate, utility::ErrorState& errorState)
+		{
+			auto start = HighResolutionClock::now();
+			bool success = loadFile(fileName, sampleRate, output, outSampleRate, errorState);
+
+			std::lock_guard<std::mutex> lock(mStatisticsMutex);
+			mStatistics.mLoadTime += std::chrono::duration<double>(HighResolutionClock::now() - start).count();
+			return success;
+		}
+
+
+		bool AudioFileLoader::load(const std::vector<std::string>& fileNames, float sampleRate, std::vector<MultiSampleBuffer>& outputs, std::vector<float>& outSampleRates, utility::ErrorState& errorState)
+		{
+			auto start = HighResolutionClock::now();
+			auto count = fileNames.size();
+			outputs.clear();
+			outputs.resize(count);
+			outSampleRates.assign(count, 0.f);
+
+			if (count == 0)
+				return true;
+
+			std::vector<utility::ErrorState> errors(count);
+			std::vector<char> results(count, 0);
+			{
+				// Every file is a range, the calling thread loads files together with the pool
+				int file_count = static_cast<int>(count);
+				ThreadPool pool(std::max<int>(std::min<int>(mThreadCount, file_count) - 1, 0), file_count);
+				parallelFor(file_count, file_count, &pool, [&](int, int begin, int end)
+				{
+					for (auto i = begin; i < end; ++i)
+						results[i] = loadFile(fileNames[i], sampleRate, outputs[i], outSampleRates[i], errors[i]);
+				});
+			}
+
+			bool success = true;
+			for (auto i = 0; i < count; ++i)
+			{
+				if (!results[i])
+				{
+					errorState.fail(errors[i].toString());
+					success = false;
+				}
+			}
+
+			std::lock_guard<std::mutex> lock(mStatisticsMutex);
+			mStatistics.mLoadTime += std::chrono::duration<double>(HighResolutionClock::now() - start).count();
+			return success;
+		}
+
+
+		AudioFileLoadStatistics AudioFileLoader::getStatistics() const
+		{
+			std::lock_guard<std::mutex> lock(mStatisticsMutex);
+			auto statistics = mStatistics;
+			statistics.mPeakBytes = mPeakBytes.load();
+			return statistics;
+		}
+
+
+		void AudioFileLoader::resetStatistics()
+		{
+			std::lock_guard<std::mutex> lock(mStatisticsMutex);
+			mStatistics = AudioFileLoadStatistics();
+			mCurrentBytes = 0;
+			mPeakBytes = 0;
+		}
+
+
+		void AudioFileLoader::logStatistics() const
+		{
+			auto statistics = getStatistics();
+			if (statistics.mFileCount == 0)
+				return;
+
+			Logger::info("Loaded %d audio files (%d from cache) in %.3f seconds, %.1f MB of sample data, peak %.1f MB",
+			             statistics.mFileCount, statistics.mCacheHitCount, statistics.mLoadTime,
+			             statistics.mSampleDataBytes / (1024.0 * 1024.0), statistics.mPeakBytes / (1024.0 * 1024.0));
+		}
+
+
+		bool AudioFileLoader::loadFile(const std::string& fileName, float sampleRate, MultiSampleBuffer& output, float& outSampleRate, utility::ErrorState& errorState)
+		{
+			uint64_t modificationTime = 0;
+			bool cacheEnabled = !mCacheDirectory.empty() && utility::getFileModificationTime(fileName, modificationTime);
+			std::string cachePath = cacheEnabled ? getCachePath(fileName, sampleRate) : "";
+
+			// Decode into a separate buffer, the channels are appended to the output afterwards
+			MultiSampleBuffer buffer;
+			float bufferSampleRate = 0.f;
+			bool fromCache = cacheEnabled && readCache(cachePath, fileName, modificationTime, buffer, bufferSampleRate);
+			trackBytes(getByteCount(buffer));
+
+			if (!fromCache)
+			{
+				if (!readAudioFile(fileName, buffer, bufferSampleRate, errorState))
+					return false;
+				trackBytes(getByteCount(buffer));
+
+				if (sampleRate > 0.f && bufferSampleRate != sampleRate)
+				{
+					// The original and the converted channel exist at the same time during conversion
+					SampleBuffer converted;
+					for (auto& channel : buffer.channels)
+					{
+						mResampler.process(channel, bufferSampleRate, sampleRate, converted);
+						trackBytes(converted.size() * sizeof(SampleValue));
+						trackBytes(-int64_t(channel.size() * sizeof(SampleValue)));
+						channel.swap(converted);
+					}
+					bufferSampleRate = sampleRate;
+				}
+
+				if (cacheEnabled && !writeCache(cachePath, fileName, modificationTime, buffer, bufferSampleRate))
+					Logger::warn("AudioFileLoader: failed to cache %s", fileName.c_str());
+			}
+
+			// Move the channels into the output
+			auto byteCount = getByteCount(buffer);
+			for (auto& channel : buffer.channels)
+				output.channels.emplace_back(std::move(channel));
+			outSampleRate = bufferSampleRate;
+
+			std::lock_guard<std::mutex> lock(mStatisticsMutex);
+			mStatistics.mFileCount++;
+			mStatistics.mCacheHitCount += fromCache ? 1 : 0;
+			mStatistics.mSampleDataBytes += byteCount;
+			return true;
+		}
+
+
+		std::string AudioFileLoader::getCachePath(const std::string& fileName, float sampleRate) const
+		{
+			auto key = utility::getAbsolutePath(fileName) + "@" + std::to_string(int(sampleRate));
+			return mCacheDirectory + "/" + std::to_string(std::hash<std::string>()(key)) + ".pcm";
+		}
+
+
+		bool AudioFileLoader::readCache(const std::string& cachePath, const std::string& fileName, uint64_t modificationTime, MultiSampleBuffer& output, float& outSampleRate)
+		{
+			std::ifstream stream(cachePath, std::ios::binary);
+			if (!stream)
+				return false;
+
+			stream.seekg(0, std::ios::end);
+			uint64_t file_size = static_cast<uint64_t>(stream.tellg());
+			stream.seekg(0, std::ios::beg);
+
+			CacheHeader header;
+			if (!stream.read(reinterpret_cast<char*>(&header), sizeof(header)))
+				return false;
+			if (std::memcmp(header.mMagic, cacheMagic, sizeof(cacheMagic)) != 0 || header.mModificationTime != modificationTime)
+				return false;
+
+			// The counts in the header have to match the size of the file before anything is allocated
+			uint64_t data_size = file_size - sizeof(header);
+			if (header.mPathLength > data_size || header.mChannelCount == 0 || header.mFrameCount == 0)
+				return false;
+			uint64_t sample_count = (data_size - header.mPathLength) / sizeof(SampleValue);
+			if ((data_size - header.mPathLength) % sizeof(SampleValue) != 0 || sample_count % header.mChannelCount != 0 || sample_count / header.mChannelCount != header.mFrameCount)
+				return false;
+
+			// Different paths can have the same hash
+			std::string path(header.mPathLength, '\0');
+			if (!stream.read(&path[0], header.mPathLength) || path != utility::getAbsolutePath(fileName))
+				return false;
+
+			output.resize(header.mChannelCount, header.mFrameCount);
+			for (auto& channel : output.channels)
+				if (!stream.read(reinterpret_cast<char*>(channel.data()), channel.size() * sizeof(SampleValue)))
+				{
+					output.channels.clear();
+					return false;
+				}
+
+			outSampleRate = header.mSampleRate;
+			return true;
+		}
+
+
+		bool AudioFileLoader::writeCache(const std::string& cachePath, const std::string& fileName, uint64_t modificationTime, const MultiSampleBuffer& buffer, float sampleRate)
+		{
+			std::ofstream stream(cachePath, std::ios::binary | std::ios::trunc);
+			if (!stream)
+				return false;
+
+			auto path = utility::getAbsolutePath(fileName);
+			CacheHeader header;
+			std::memcpy(header.mMagic, cacheMagic, sizeof(cacheMagic));
+			header.mModificationTime = modificationTime;
+			header.mPathLength = path.size();
+			header.mChannelCount = buffer.getChannelCount();
+			header.mFrameCount = buffer.getSize();
+			header.mSampleRate = sampleRate;
+
+			stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			stream.write(path.data(), path.size());
+			for (const auto& channel : buffer.channels)
+				stream.write(reinterpret_cast<const char*>(channel.data()), channel.size() * sizeof(SampleValue));
+			return stream.good();
+		}
+
+
+		void AudioFileLoader::trackBytes(int64_t bytes)
+		{
+			auto current = mCurrentBytes += bytes;
+			auto peak = mPeakBytes.load();
+			while (current > peak && !mPeakBytes.compare_exchange_weak(peak, current));
+		}
+
+	}
+
+}
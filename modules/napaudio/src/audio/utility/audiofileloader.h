@@ -0,0 +1,120 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Std includes
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Nap includes
+#include <utility/errorstate.h>
+
+// Audio includes
+#include <audio/utility/audiotypes.h>
+#include <audio/utility/resampler.h>
+
+namespace nap
+{
+
+	namespace audio
+	{
+
+		/**
+		 * Statistics of all files loaded by an @AudioFileLoader since the last reset.
+		 */
+		struct NAPAPI AudioFileLoadStatistics
+		{
+			int mFileCount = 0; ///< Number of files loaded
+			int mCacheHitCount = 0; ///< Number of files read from the cache instead of decoded
+			double mLoadTime = 0.0; ///< Seconds spent loading
+			uint64_t mSampleDataBytes = 0; ///< Bytes of sample data loaded
+			uint64_t mPeakBytes = 0; ///< Highest number of bytes of sample data and conversion buffers in memory at the same time
+		};
+
+
+		/**
+		 * Loads audio files into memory, converted to the requested sample rate.
+		 * Sample rate conversion uses a high quality @Resampler, so playback doesn't need to compensate for the sample rate of the file.
+		 * Decoded and converted files are optionally stored in a cache directory as raw float samples.
+		 * The cache is used when the source file hasn't been modified since, which skips decoding and conversion.
+		 * Multiple files can be loaded in parallel on a pool of worker threads.
+		 */
+		class NAPAPI AudioFileLoader final
+		{
+		public:
+			/**
+			 * @param cacheDirectory: directory to cache decoded and converted files in, empty disables the cache
+			 * @param threadCount: maximum number of threads to load multiple files with, 0 uses the number of hardware threads
+			 */
+			AudioFileLoader(const std::string& cacheDirectory = "", int threadCount = 0);
+
+			/**
+			 * Loads a single file on the calling thread.
+			 * @param fileName: the audio file to load
+			 * @param sampleRate: sample rate to convert to, 0 keeps the sample rate of the file
+			 * @param output: the loaded channels are appended to this buffer
+			 * @param outSampleRate: the sample rate of the loaded channels
+			 * @param errorState: contains the error when loading fails
+			 * @return true on success
+			 */
+			bool load(const std::string& fileName, float sampleRate, MultiSampleBuffer& output, float& outSampleRate, utility::ErrorState& errorState);
+
+			/**
+			 * Loads multiple files in parallel.
+			 * @param fileNames: the audio files to load
+			 * @param sampleRate: sample rate to convert to, 0 keeps the sample rate of the files
+			 * @param outputs: a buffer for every file
+			 * @param outSampleRates: the sample rate of every loaded file
+			 * @param errorState: contains the errors of all files that failed to load
+			 * @return true if all files loaded
+			 */
+			bool load(const std::vector<std::string>& fileNames, float sampleRate, std::vector<MultiSampleBuffer>& outputs, std::vector<float>& outSampleRates, utility::ErrorState& errorState);
+
+			/**
+			 * @return statistics of all files loaded since the last reset.
+			 */
+			AudioFileLoadStatistics getStatistics() const;
+
+			/**
+			 * Resets the statistics.
+			 */
+			void resetStatistics();
+
+			/**
+			 * Logs the statistics of all files loaded since the last reset.
+			 */
+			void logStatistics() const;
+
+		private:
+			// Loads a file from the cache or decodes and converts it, called from worker threads
+			bool loadFile(const std::string& fileName, float sampleRate, MultiSampleBuffer& output, float& outSampleRate, utility::ErrorState& errorState);
+
+			// Returns the path of the cached version of a file at a sample rate
+			std::string getCachePath(const std::string& fileName, float sampleRate) const;
+
+			// Reads a cached file, fails when the cache is missing or older than the source
+			bool readCache(const std::string& cachePath, const std::string& fileName, uint64_t modificationTime, MultiSampleBuffer& output, float& outSampleRate);
+
+			// Writes a file to the cache
+			bool writeCache(const std::string& cachePath, const std::string& fileName, uint64_t modificationTime, const MultiSampleBuffer& buffer, float sampleRate);
+
+			// Tracks bytes of sample data in memory and updates the peak
+			void trackBytes(int64_t bytes);
+
+			Resampler mResampler;
+			std::string mCacheDirectory;
+			int mThreadCount = 0;
+
+			mutable std::mutex mStatisticsMutex;
+			AudioFileLoadStatistics mStatistics;
+			std::atomic<int64_t> mCurrentBytes = { 0 };
+			std::atomic<int64_t> mPeakBytes = { 0 };
+		};
+
+	}
+
+}
@@ -7,6 +7,7 @@
 // Std Includes
 #include <stdint.h>
 #include <iostream>
+#include <cassert>
 
 // Third party includes
 #include <sndfile.h>
@@ -175,5 +176,81 @@ namespace nap
 		}
 		
 		
+		bool writeAudioFile(const std::string& fileName, const MultiSampleBuffer& input, float sampleRate, nap::utility::ErrorState& errorState)
+		{
+			AudioFileWriter writer;
+			if (!writer.open(fileName, input.getChannelCount(), sampleRate, errorState))
+				return false;
+			
+			std::vector<const float*> channels;
+			for (const auto& channel : input.channels)
+				channels.emplace_back(channel.data());
+			
+			if (!writer.write(channels.data(), input.getSize(), errorState))
+				return false;
+			
+			writer.close();
+			return true;
+		}
+		
+		
+		AudioFileWriter::~AudioFileWriter()
+		{
+			close();
+		}
+		
+		
+		bool AudioFileWriter::open(const std::string& fileName, int channelCount, float sampleRate, nap::utility::ErrorState& errorState)
+		{
+			close();
+			
+			SF_INFO info;
+			info.samplerate = static_cast<int>(sampleRate);
+			info.channels = channelCount;
+			info.format = SF_FORMAT_WAV | SF_FORMAT_FLOAT;
+			info.frames = 0;
+			info.sections = 0;
+			info.seekable = 0;
+			
+			// try to create the sound file
+			mFile = sf_open(fileName.c_str(), SFM_WRITE, &info);
+			if (!errorState.check(mFile != nullptr, "Failed to create audio file %s: %s", fileName.c_str(), sf_strerror(nullptr)))
+				return false;
+			
+			mChannelCount = channelCount;
+			return true;
+		}
+		
+		
+		bool AudioFileWriter::write(const float* const* input, unsigned long frameCount, nap::utility::ErrorState& errorState)
+		{
+			assert(mFile != nullptr);
+			
+			// interleave the channels, libsndfile expects interleaved data
+			mInterleaved.resize(frameCount * mChannelCount);
+			auto i = 0;
+			for (auto frame = 0; frame < frameCount; ++frame)
+				for (auto channel = 0; channel < mChannelCount; ++channel)
+				{
+					mInterleaved[i] = input[channel][frame];
+					i++;
+				}
+			
+			sf_writef_float(mFile, mInterleaved.data(), frameCount);
+			return errorState.check(sf_error(mFile) == SF_ERR_NO_ERROR, "Failed to write audio file: %s", sf_strerror(mFile));
+		}
+		
+		
+		void AudioFileWriter::close()
+		{
+			if (mFile == nullptr)
+				return;
+			
+			sf_close(mFile);
+			mFile = nullptr;
+			mChannelCount = 0;
+		}
+		
+		
 	}
 }
\ No newline at end of file
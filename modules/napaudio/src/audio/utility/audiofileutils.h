@@ -11,6 +11,9 @@
 #include <audio/utility/audiotypes.h>
 #include <utility/errorstate.h>
 
+// Forward declare libsndfile handle
+struct SNDFILE_tag;
+
 namespace nap
 {
 	
@@ -27,6 +30,68 @@ namespace nap
 		bool NAPAPI readAudioFile(const std::string& fileName, MultiSampleBuffer& output, float& outSampleRate,
 		                          nap::utility::ErrorState& errorState);
 		
+		
+		/**
+		 * Utility to write an audio buffer to disk as a wav file in 32 bit float format.
+		 * @param fileName: the path to the file, an existing file is overwritten
+		 * @param input: the buffer to write, one channel in the file for every channel in the buffer
+		 * @param sampleRate: the sample rate of the audio in the buffer
+		 * @return: true on success
+		 */
+		bool NAPAPI writeAudioFile(const std::string& fileName, const MultiSampleBuffer& input, float sampleRate,
+		                           nap::utility::ErrorState& errorState);
+		
+		
+		/**
+		 * Writes audio to a wav file in 32 bit float format, block by block.
+		 * Use this to write audio that is too long to be kept in memory as a whole.
+		 */
+		class NAPAPI AudioFileWriter final
+		{
+		public:
+			AudioFileWriter() = default;
+			
+			/**
+			 * Closes the file if it is still open.
+			 */
+			~AudioFileWriter();
+			
+			AudioFileWriter(const AudioFileWriter&) = delete;
+			AudioFileWriter& operator=(const AudioFileWriter&) = delete;
+			
+			/**
+			 * Creates the file, an existing file is overwritten.
+			 * @param fileName: the path to the file
+			 * @param channelCount: number of channels in the file
+			 * @param sampleRate: sample rate of the audio
+			 * @return: true on success
+			 */
+			bool open(const std::string& fileName, int channelCount, float sampleRate, nap::utility::ErrorState& errorState);
+			
+			/**
+			 * Appends a block of audio to the file.
+			 * @param input: an array of float arrays, one sample buffer for every channel in the file
+			 * @param frameCount: number of samples per channel to write
+			 * @return: true on success
+			 */
+			bool write(const float* const* input, unsigned long frameCount, nap::utility::ErrorState& errorState);
+			
+			/**
+			 * Closes the file, called automatically on destruction.
+			 */
+			void close();
+			
+			/**
+			 * @return: if a file is open for writing
+			 */
+			bool isOpen() const { return mFile != nullptr; }
+		
+		private:
+			SNDFILE_tag* mFile = nullptr; // The libsndfile handle of the open file
+			int mChannelCount = 0; // Number of channels in the file
+			std::vector<SampleValue> mInterleaved; // Interleaved block that is written to the file
+		};
+		
 	}
 	
 }
@@ -0,0 +1,45 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "convolutionkernel.h"
+
+// Std includes
+#include <algorithm>
+
+// Audio includes
+#include <audio/utility/fft.h>
+
+namespace nap
+{
+
+	namespace audio
+	{
+
+		ConvolutionKernel::ConvolutionKernel(const MultiSampleBuffer& impulseResponse, int partitionSize, float gain) :
+			mPartitionSize(partitionSize), mChannelCount(impulseResponse.getChannelCount())
+		{
+			auto length = impulseResponse.getSize();
+			mPartitionCount = std::max<int>(1, (length + partitionSize - 1) / partitionSize);
+			mSpectra.resize(mChannelCount * mPartitionCount * getBinCount());
+
+			RealFFT fft(partitionSize * 2);
+			std::vector<float> block(partitionSize * 2, 0.f);
+			for (auto channel = 0; channel < mChannelCount; ++channel)
+			{
+				const auto& samples = impulseResponse.channels[channel];
+				for (auto partition = 0; partition < mPartitionCount; ++partition)
+				{
+					// The second half of the block stays zero
+					size_t start = partition * partitionSize;
+					for (auto i = 0; i < partitionSize; ++i)
+						block[i] = start + i < length ? samples[start + i] * gain : 0.f;
+
+					fft.transform(block.data(), &mSpectra[(channel * mPartitionCount + partition) * getBinCount()]);
+				}
+			}
+		}
+
+	}
+
+}
@@ -0,0 +1,71 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Std includes
+#include <complex>
+#include <vector>
+
+// Audio includes
+#include <audio/utility/audiotypes.h>
+
+namespace nap
+{
+
+	namespace audio
+	{
+
+		/**
+		 * Impulse response prepared for uniformly partitioned convolution.
+		 * Every channel of the impulse response is cut into partitions of equal size. Every partition is zero padded
+		 * to twice the partition size and transformed into the frequency domain once, on construction.
+		 * A kernel is immutable after construction and can be shared by any number of @ConvolutionNode objects.
+		 * Construct it on the main thread: transforming a long impulse response takes time and allocates.
+		 */
+		class NAPAPI ConvolutionKernel final
+		{
+		public:
+			/**
+			 * @param impulseResponse: the impulse response, one buffer per channel
+			 * @param partitionSize: number of samples per partition, a power of two. Has to match the partition size of the nodes using the kernel.
+			 * @param gain: gain factor applied to the impulse response
+			 */
+			ConvolutionKernel(const MultiSampleBuffer& impulseResponse, int partitionSize, float gain = 1.f);
+
+			/**
+			 * @return number of samples per partition.
+			 */
+			int getPartitionSize() const { return mPartitionSize; }
+
+			/**
+			 * @return number of partitions per channel.
+			 */
+			int getPartitionCount() const { return mPartitionCount; }
+
+			/**
+			 * @return number of channels.
+			 */
+			int getChannelCount() const { return mChannelCount; }
+
+			/**
+			 * @return number of bins of the spectrum of a single partition.
+			 */
+			int getBinCount() const { return mPartitionSize + 1; }
+
+			/**
+			 * @return the spectrum of a partition of a channel, @getBinCount() bins.
+			 */
+			const std::complex<float>* getPartition(int channel, int partition) const { return &mSpectra[(channel * mPartitionCount + partition) * getBinCount()]; }
+
+		private:
+			int mPartitionSize = 0;
+			int mPartitionCount = 0;
+			int mChannelCount = 0;
+			std::vector<std::complex<float>> mSpectra; // Spectra of all partitions of all channels, channel after channel
+		};
+
+	}
+
+}
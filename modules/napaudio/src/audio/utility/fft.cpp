@@ -0,0 +1,121 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "fft.h"
+
+// Std includes
+#include <cassert>
+#include <cmath>
+
+namespace nap
+{
+
+	namespace audio
+	{
+
+		RealFFT::RealFFT(int size) : mSize(size)
+		{
+			assert(isValidSize(size));
+
+			const double pi = 3.14159265358979323846;
+			int half = size / 2;
+			mWork.resize(half);
+
+			mTwiddles.resize(half / 2);
+			for (auto i = 0; i < half / 2; ++i)
+				mTwiddles[i] = std::polar(1.0, -2.0 * pi * i / half);
+
+			mUnpackTwiddles.resize(half + 1);
+			for (auto i = 0; i <= half; ++i)
+				mUnpackTwiddles[i] = std::polar(1.0, -2.0 * pi * i / size);
+
+			int bits = 0;
+			while ((1 << bits) < half)
+				bits++;
+			mBitReversal.resize(half);
+			for (auto i = 0; i < half; ++i)
+			{
+				int reversed = 0;
+				for (auto bit = 0; bit < bits; ++bit)
+					if (i & (1 << bit))
+						reversed |= 1 << (bits - 1 - bit);
+				mBitReversal[i] = reversed;
+			}
+		}
+
+
+		void RealFFT::transform(const float* input, std::complex<float>* output)
+		{
+			int half = mSize / 2;
+
+			// Pack even samples into the real and odd samples into the imaginary part, in bit reversed order
+			for (auto i = 0; i < half; ++i)
+				mWork[mBitReversal[i]] = { input[2 * i], input[2 * i + 1] };
+
+			butterflies();
+
+			// Unpack the spectrum of the even and odd samples into the spectrum of the real signal
+			const std::complex<float> minusHalfI(0.f, -0.5f);
+			for (auto k = 0; k <= half; ++k)
+			{
+				auto z = mWork[k == half ? 0 : k];
+				auto zMirror = std::conj(mWork[k == 0 ? 0 : half - k]);
+				auto even = 0.5f * (z + zMirror);
+				auto odd = minusHalfI * (z - zMirror);
+				output[k] = even + mUnpackTwiddles[k] * odd;
+			}
+		}
+
+
+		void RealFFT::inverse(const std::complex<float>* input, float* output)
+		{
+			int half = mSize / 2;
+
+			// Pack the real spectrum into the spectrum of the even and odd samples, conjugated to transform backwards
+			const std::complex<float> i(0.f, 1.f);
+			for (auto k = 0; k < half; ++k)
+			{
+				auto x = input[k];
+				auto xMirror = std::conj(input[half - k]);
+				auto even = 0.5f * (x + xMirror);
+				auto odd = 0.5f * (x - xMirror) * std::conj(mUnpackTwiddles[k]);
+				mWork[mBitReversal[k]] = std::conj(even + i * odd);
+			}
+
+			butterflies();
+
+			// Conjugate and scale back, the real part holds the even and the imaginary part the odd samples
+			float scale = 1.f / half;
+			for (auto n = 0; n < half; ++n)
+			{
+				output[2 * n] = mWork[n].real() * scale;
+				output[2 * n + 1] = -mWork[n].imag() * scale;
+			}
+		}
+
+
+		void RealFFT::butterflies()
+		{
+			int half = mSize / 2;
+			for (auto length = 2; length <= half; length <<= 1)
+			{
+				int span = length / 2;
+				int step = half / length;
+				for (auto start = 0; start < half; start += length)
+				{
+					for (auto i = 0; i < span; ++i)
+					{
+						auto& a = mWork[start + i];
+						auto& b = mWork[start + i + span];
+						auto t = b * mTwiddles[i * step];
+						b = a - t;
+						a += t;
+					}
+				}
+			}
+		}
+
+	}
+
+}
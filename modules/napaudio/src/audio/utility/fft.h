@@ -0,0 +1,76 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Std includes
+#include <complex>
+#include <vector>
+
+// Nap includes
+#include <utility/dllexport.h>
+
+namespace nap
+{
+
+	namespace audio
+	{
+
+		/**
+		 * Fast fourier transform of a real signal with a power of two size, and its inverse.
+		 * The real input is packed into a complex signal of half the size, transformed with an iterative radix-2 FFT
+		 * and unpacked into the spectrum of the real signal. Twiddle factors and the bit reversal table are calculated
+		 * up front, so @transform() and @inverse() do not allocate and can be called on the audio thread.
+		 */
+		class NAPAPI RealFFT
+		{
+		public:
+			/**
+			 * @param size: number of real input samples, a power of two of at least 4.
+			 */
+			RealFFT(int size);
+
+			/**
+			 * Transforms a block of real samples.
+			 * @param input: @getSize() real samples
+			 * @param output: @getBinCount() complex bins, from DC up to and including the Nyquist frequency
+			 */
+			void transform(const float* input, std::complex<float>* output);
+
+			/**
+			 * Inverse transform, from a spectrum back to real samples. inverse(transform(x)) equals x.
+			 * @param input: @getBinCount() complex bins, from DC up to and including the Nyquist frequency
+			 * @param output: @getSize() real samples
+			 */
+			void inverse(const std::complex<float>* input, float* output);
+
+			/**
+			 * @return the number of real input samples.
+			 */
+			int getSize() const { return mSize; }
+
+			/**
+			 * @return the number of output bins: half the size plus one.
+			 */
+			int getBinCount() const { return mSize / 2 + 1; }
+
+			/**
+			 * @return true if size is a power of two that can be transformed.
+			 */
+			static bool isValidSize(int size) { return size >= 4 && (size & (size - 1)) == 0; }
+
+		private:
+			// Iterative radix-2 butterflies on the bit reversed work buffer
+			void butterflies();
+
+			int mSize = 0;
+			std::vector<std::complex<float>> mWork; // Packed complex signal of half the size
+			std::vector<std::complex<float>> mTwiddles; // Twiddle factors of the half size complex FFT
+			std::vector<std::complex<float>> mUnpackTwiddles; // Twiddle factors to unpack the real spectrum
+			std::vector<int> mBitReversal; // Bit reversed index for every index of the half size complex FFT
+		};
+
+	}
+
+}
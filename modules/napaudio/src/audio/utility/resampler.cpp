@@ -0,0 +1,101 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "resampler.h"
+
+// Std includes
+#include <algorithm>
+#include <cmath>
+
+namespace nap
+{
+
+	namespace audio
+	{
+
+		// Zeroth order modified bessel function of the first kind, used by the Kaiser window
+		static double bessel(double x)
+		{
+			double sum = 1.0;
+			double term = 1.0;
+			for (auto k = 1; k < 32; ++k)
+			{
+				term *= (x / (2.0 * k)) * (x / (2.0 * k));
+				sum += term;
+			}
+			return sum;
+		}
+
+
+		Resampler::Resampler(int zeroCrossings, int phaseCount) : mZeroCrossings(zeroCrossings), mPhaseCount(phaseCount)
+		{
+			// A beta of 8.6 attenuates the side lobes by about 90dB
+			const double pi = 3.14159265358979323846;
+			const double beta = 8.6;
+			auto size = zeroCrossings * phaseCount;
+			mTable.resize(size + 2, 0.f);
+			for (auto i = 0; i <= size; ++i)
+			{
+				double x = double(i) / phaseCount;
+				double sinc = i == 0 ? 1.0 : std::sin(pi * x) / (pi * x);
+				double position = x / zeroCrossings;
+				double window = bessel(beta * std::sqrt(std::max(0.0, 1.0 - position * position))) / bessel(beta);
+				mTable[i] = float(sinc * window);
+			}
+		}
+
+
+		void Resampler::process(const SampleBuffer& input, float inputSampleRate, float outputSampleRate, SampleBuffer& output) const
+		{
+			if (inputSampleRate == outputSampleRate || inputSampleRate <= 0.f || outputSampleRate <= 0.f)
+			{
+				output = input;
+				return;
+			}
+
+			// Input samples per output sample, and the cutoff relative to the input Nyquist frequency, just below the lowest Nyquist frequency
+			double step = double(inputSampleRate) / outputSampleRate;
+			double cutoff = std::min(1.0, 1.0 / step) * 0.95;
+			double radius = mZeroCrossings / cutoff;
+
+			auto inputSize = long(input.size());
+			auto outputSize = long(std::ceil(inputSize / step));
+			output.resize(outputSize);
+			for (long i = 0; i < outputSize; ++i)
+			{
+				double position = i * step;
+				long first = std::max(0l, long(std::ceil(position - radius)));
+				long last = std::min(inputSize - 1, long(std::floor(position + radius)));
+				double sum = 0.0;
+				for (long j = first; j <= last; ++j)
+					sum += input[j] * getKernel(std::abs(position - j) * cutoff);
+				output[i] = float(sum * cutoff);
+			}
+		}
+
+
+		void Resampler::process(MultiSampleBuffer& buffer, float inputSampleRate, float outputSampleRate) const
+		{
+			SampleBuffer output;
+			for (auto& channel : buffer.channels)
+			{
+				process(channel, inputSampleRate, outputSampleRate, output);
+				channel.swap(output);
+			}
+		}
+
+
+		float Resampler::getKernel(double distance) const
+		{
+			double index = distance * mPhaseCount;
+			auto entry = size_t(index);
+			if (entry >= mTable.size() - 1)
+				return 0.f;
+			float fraction = float(index - entry);
+			return mTable[entry] + fraction * (mTable[entry + 1] - mTable[entry]);
+		}
+
+	}
+
+}
@@ -0,0 +1,63 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Std includes
+#include <vector>
+
+// Audio includes
+#include <audio/utility/audiotypes.h>
+
+namespace nap
+{
+
+	namespace audio
+	{
+
+		/**
+		 * Converts the sample rate of audio material offline, using band limited windowed sinc interpolation.
+		 * The Kaiser windowed sinc kernel is tabulated on construction. When converting to a lower sample rate the kernel is stretched,
+		 * so frequencies above the new Nyquist frequency are filtered out instead of folding back.
+		 * Meant to be used at load time: the quality is much higher than the linear interpolation used during playback, but so is the cost.
+		 * A resampler is immutable after construction and can be used from multiple threads at the same time.
+		 */
+		class NAPAPI Resampler final
+		{
+		public:
+			/**
+			 * @param zeroCrossings: number of zero crossings of the kernel on each side, higher means a steeper filter but more CPU
+			 * @param phaseCount: number of table entries per zero crossing
+			 */
+			Resampler(int zeroCrossings = 16, int phaseCount = 512);
+
+			/**
+			 * Converts a single channel.
+			 * @param input: the samples to convert
+			 * @param inputSampleRate: sample rate of the input
+			 * @param outputSampleRate: sample rate to convert to
+			 * @param output: the converted samples
+			 */
+			void process(const SampleBuffer& input, float inputSampleRate, float outputSampleRate, SampleBuffer& output) const;
+
+			/**
+			 * Converts all channels of a buffer in place.
+			 * @param buffer: the buffer to convert
+			 * @param inputSampleRate: sample rate of the buffer
+			 * @param outputSampleRate: sample rate to convert to
+			 */
+			void process(MultiSampleBuffer& buffer, float inputSampleRate, float outputSampleRate) const;
+
+		private:
+			// Kernel value at a distance in zero crossings, linearly interpolated in between table entries
+			float getKernel(double distance) const;
+
+			int mZeroCrossings = 0;
+			int mPhaseCount = 0;
+			std::vector<float> mTable; // One side of the windowed sinc, phaseCount entries per zero crossing
+		};
+
+	}
+
+}
@@ -6,6 +6,7 @@
 #include "sqlite3.h"
 
 #include <nap/logger.h>
+#include <algorithm>
 
 namespace nap
 {
@@ -17,6 +18,12 @@ namespace nap
 
 	Database::~Database()
 	{
+		// Write all pending rows before the tables are destroyed
+		stopWriter();
+		utility::ErrorState error;
+		if (!flush(error))
+			nap::Logger::error("Unable to write pending rows: %s", error.toString().c_str());
+
 		// Need to destroy the tables first to ensure the database isn't 'busy' (the tables hold on to sqlite3_stmt objects which are destroyed in their destructors)
 		mTables.clear();
 
@@ -74,15 +81,105 @@ namespace nap
 
 	DatabaseTable* Database::getOrCreateTable(const std::string& tableID, const rtti::TypeInfo& objectType, const DatabaseTable::DatabasePropertyPathList& propertiesToIgnore, utility::ErrorState& errorState)
 	{
+		std::lock_guard<std::mutex> lock(mMutex);
  		DatabaseTableMap::iterator pos = mTables.find(tableID);
  		if (pos != mTables.end())
  			return pos->second.get();
 
- 		std::unique_ptr<DatabaseTable> table = std::make_unique<DatabaseTable>(*mDatabase, *mFactory, tableID, objectType);
+ 		std::unique_ptr<DatabaseTable> table = std::make_unique<DatabaseTable>(*this, *mFactory, tableID, objectType);
  		if (!table->init(propertiesToIgnore, errorState))
  			return nullptr;
 
 		auto inserted = mTables.emplace(std::make_pair(tableID, std::move(table)));
 		return inserted.first->second.get();
 	}
-}
\ No newline at end of file
+
+
+	void Database::startWriter(int flushInterval, int batchSize)
+	{
+		assert(!mWriterThread.joinable());
+		mFlushInterval = std::chrono::milliseconds(std::max(flushInterval, 1));
+		mBatchSize = std::max(batchSize, 1);
+		mWriterRunning = true;
+		mWriterThread = std::thread(&Database::writerLoop, this);
+	}
+
+
+	void Database::stopWriter()
+	{
+		if (!mWriterThread.joinable())
+			return;
+
+		{
+			std::lock_guard<std::mutex> lock(mWriterMutex);
+			mWriterRunning = false;
+		}
+		mWriterCondition.notify_one();
+		mWriterThread.join();
+	}
+
+
+	bool Database::flush(utility::ErrorState& errorState)
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		if (mPendingRowCount == 0)
+			return true;
+
+		// Group all inserts in a single transaction, this avoids a journal update for every row
+		char* errorMessage = nullptr;
+		if (!errorState.check(sqlite3_exec(mDatabase, "BEGIN TRANSACTION", nullptr, nullptr, &errorMessage) == SQLITE_OK, "Failed to begin transaction: %s", errorMessage != nullptr ? errorMessage : "Unknown error"))
+		{
+			sqlite3_free(errorMessage);
+			return false;
+		}
+
+		// Rows that fail are skipped by the tables, all other rows are committed
+		bool success = true;
+		for (auto& table : mTables)
+		{
+			int written = 0;
+			if (!table.second->writePendingRows(written, errorState))
+				success = false;
+			mPendingRowCount -= written;
+		}
+
+		if (!errorState.check(sqlite3_exec(mDatabase, "COMMIT", nullptr, nullptr, &errorMessage) == SQLITE_OK, "Failed to commit transaction: %s", errorMessage != nullptr ? errorMessage : "Unknown error"))
+		{
+			sqlite3_free(errorMessage);
+			sqlite3_exec(mDatabase, "ROLLBACK", nullptr, nullptr, nullptr);
+			return false;
+		}
+		return success;
+	}
+
+
+	void Database::rowAdded()
+	{
+		// Only the row that completes a batch wakes up the writer, the flush interval covers rows that race with a flush
+		if (++mPendingRowCount == mBatchSize)
+			mWriterCondition.notify_one();
+	}
+
+
+	void Database::writerLoop()
+	{
+		std::unique_lock<std::mutex> lock(mWriterMutex);
+		bool running = true;
+		while (running)
+		{
+			// Wait until the interval expires, a batch is pending or the writer is stopped
+			mWriterCondition.wait_for(lock, mFlushInterval, [this]()
+			{
+				return !mWriterRunning || mPendingRowCount >= mBatchSize;
+			});
+			running = mWriterRunning;
+
+			// Write outside of the writer lock, rows are always written once more when stopped
+			lock.unlock();
+			utility::ErrorState error;
+			if (!flush(error))
+				nap::Logger::error("Unable to write pending rows: %s", error.toString().c_str());
+			lock.lock();
+		}
+	}
+}
@@ -8,6 +8,12 @@
 #include "utility/errorstate.h"
 #include "databasetable.h"
 
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <condition_variable>
+#include <chrono>
+
 namespace nap
 {
 
@@ -17,6 +23,8 @@ namespace nap
 	 */
 	class NAPAPI Database final
 	{
+		friend class DatabaseTable;
+		friend class DatabaseCursor;
 	public:
 		Database(rtti::Factory& factory);
 		~Database();
@@ -41,11 +49,62 @@ namespace nap
 		 */
 		DatabaseTable* getOrCreateTable(const std::string& tableID, const rtti::TypeInfo& objectType, const DatabaseTable::DatabasePropertyPathList& propertiesToIgnore, utility::ErrorState& errorState);
 
+		/**
+		 * Starts a background thread that writes the rows added using DatabaseTable::addAsync().
+		 * Pending rows of all tables are written in a single transaction, every flushInterval or as soon as batchSize rows are pending.
+		 * Failures are logged, rows that fail to be written are discarded and all other rows are committed.
+		 * @param flushInterval max time in milliseconds a row stays pending.
+		 * @param batchSize number of pending rows that triggers a write before the interval expires.
+		 */
+		void startWriter(int flushInterval = 100, int batchSize = 1000);
+
+		/**
+		 * Stops the background writer thread, all pending rows are written before the thread stops.
+		 */
+		void stopWriter();
+
+		/**
+		 * @return if the background writer thread is running
+		 */
+		bool isWriterRunning() const										{ return mWriterThread.joinable(); }
+
+		/**
+		 * Writes all rows added using DatabaseTable::addAsync() in a single transaction on the calling thread.
+		 * Rows that fail to be written are discarded, all other rows are committed.
+		 * @param errorState if the function returns false, contains error information.
+		 * @return if all pending rows were written.
+		 */
+		bool flush(utility::ErrorState& errorState);
+
+		/**
+		 * @return number of rows added using DatabaseTable::addAsync() that have not been written yet.
+		 */
+		int getPendingRowCount() const										{ return mPendingRowCount.load(); }
+
 	private:
 		using DatabaseTableMap = std::unordered_map<std::string, std::unique_ptr<DatabaseTable>>;
 
+		/**
+		 * Called by a table when a row is added asynchronously, wakes up the writer when a batch is pending.
+		 */
+		void rowAdded();
+
+		/**
+		 * Runs on the writer thread until stopped.
+		 */
+		void writerLoop();
+
 		rtti::Factory*		mFactory = nullptr;			///< Factory used to create objects when querying data
 		sqlite3*			mDatabase = nullptr;		///< Sqlite object
 		DatabaseTableMap	mTables;					///< Map from table ID to DatabaseTable
+		std::mutex			mMutex;						///< Serializes access to the sqlite object and tables
+
+		std::thread					mWriterThread;				///< Writes pending rows in the background
+		std::mutex					mWriterMutex;				///< Guards the writer state
+		std::condition_variable		mWriterCondition;			///< Wakes up the writer
+		bool						mWriterRunning = false;		///< If the writer should keep running
+		std::chrono::milliseconds	mFlushInterval;				///< Max time a row stays pending
+		int							mBatchSize = 1000;			///< Number of pending rows that triggers a write
+		std::atomic<int>			mPendingRowCount = { 0 };	///< Number of rows waiting to be written
 	};
 }
@@ -136,11 +136,8 @@ namespace nap
 	}
 
 
-	static bool setColumnValue(rtti::Object& object, const rtti::Path& path, sqlite3_stmt& statement, int columnIndex)
+	static bool setColumnValue(rtti::ResolvedPath& resolvedPath, sqlite3_stmt& statement, int columnIndex)
 	{
-		rtti::ResolvedPath resolvedPath;
-		bool was_resolved = path.resolve(&object, resolvedPath);
-		assert(was_resolved);
 		rtti::TypeInfo type = resolvedPath.getType();
 
 		if (type.is_arithmetic())
@@ -179,6 +176,15 @@ namespace nap
 		return false;
 	}
 
+
+	static bool setColumnValue(rtti::Object& object, const rtti::Path& path, sqlite3_stmt& statement, int columnIndex)
+	{
+		rtti::ResolvedPath resolvedPath;
+		bool was_resolved = path.resolve(&object, resolvedPath);
+		assert(was_resolved);
+		return setColumnValue(resolvedPath, statement, columnIndex);
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 
 	DatabasePropertyPath::DatabasePropertyPath(const rtti::Path& rttiPath) :
@@ -221,10 +227,90 @@ namespace nap
 	//////////////////////////////////////////////////////////////////////////
 
 
-	DatabaseTable::DatabaseTable(sqlite3& database, rtti::Factory& factory, const std::string& tableID, const rtti::TypeInfo& objectType) :
+	DatabaseCursor::DatabaseCursor(DatabaseTable& table, sqlite3_stmt& statement) :
+		mTable(&table),
+		mStatement(&statement)
+	{
+	}
+
+
+	DatabaseCursor::~DatabaseCursor()
+	{
+		std::lock_guard<std::mutex> lock(mTable->mOwner->mMutex);
+		sqlite3_finalize(mStatement);
+	}
+
+
+	bool DatabaseCursor::next()
+	{
+		std::lock_guard<std::mutex> lock(mTable->mOwner->mMutex);
+		return sqlite3_step(mStatement) == SQLITE_ROW;
+	}
+
+
+	void DatabaseCursor::read(rtti::Object& object)
+	{
+		// Types need to match exactly, see DatabaseTable::add()
+		assert(object.get_type() == mTable->mObjectType);
+
+		// Resolve the paths once for every object that is read into
+		const DatabaseTable::ColumnList& columns = mTable->mColumns;
+		if (&object != mResolvedObject)
+		{
+			mResolvedPaths.resize(columns.size());
+			for (int column_index = 0; column_index < columns.size(); ++column_index)
+			{
+				bool was_resolved = columns[column_index].mPath->getRTTIPath().resolve(&object, mResolvedPaths[column_index]);
+				assert(was_resolved);
+			}
+			mResolvedObject = &object;
+		}
+
+		std::lock_guard<std::mutex> lock(mTable->mOwner->mMutex);
+		for (int column_index = 0; column_index < columns.size(); ++column_index)
+			setColumnValue(mResolvedPaths[column_index], *mStatement, column_index);
+	}
+
+
+	int DatabaseCursor::getColumnCount() const
+	{
+		return static_cast<int>(mTable->mColumns.size());
+	}
+
+
+	int64_t DatabaseCursor::getInteger(int column)
+	{
+		assert(column >= 0 && column < getColumnCount());
+		std::lock_guard<std::mutex> lock(mTable->mOwner->mMutex);
+		return sqlite3_column_int64(mStatement, column);
+	}
+
+
+	double DatabaseCursor::getReal(int column)
+	{
+		assert(column >= 0 && column < getColumnCount());
+		std::lock_guard<std::mutex> lock(mTable->mOwner->mMutex);
+		return sqlite3_column_double(mStatement, column);
+	}
+
+
+	const char* DatabaseCursor::getText(int column)
+	{
+		assert(column >= 0 && column < getColumnCount());
+		std::lock_guard<std::mutex> lock(mTable->mOwner->mMutex);
+		const unsigned char* text = sqlite3_column_text(mStatement, column);
+		return text != nullptr ? reinterpret_cast<const char*>(text) : "";
+	}
+
+
+	//////////////////////////////////////////////////////////////////////////
+
+
+	DatabaseTable::DatabaseTable(Database& database, rtti::Factory& factory, const std::string& tableID, const rtti::TypeInfo& objectType) :
+		mOwner(&database),
+		mDatabase(database.mDatabase),
 		mFactory(&factory),
-		mObjectType(objectType),
-		mDatabase(&database)
+		mObjectType(objectType)
 	{
 		mTableID = cppToDatabaseName(tableID);
 	}
@@ -268,7 +354,7 @@ namespace nap
 			if (ignored_property_pos == propertiesToIgnore.end())
 			{
 				std::string column_name = generateUniqueColumnName(path);
-				mColumns.push_back({ std::move(database_path), std::move(column_name), getSQLTypeString(property.get_type()) });
+				mColumns.push_back({ std::move(database_path), std::move(column_name), getSQLTypeString(property.get_type()), property.get_type() });
 			}			
 		}, errorState);
 
@@ -311,22 +397,81 @@ namespace nap
 
 
 	bool DatabaseTable::add(const rtti::Object& object, utility::ErrorState& errorState)
+	{
+		Row row = createRow(object);
+		std::lock_guard<std::mutex> lock(mOwner->mMutex);
+		if (insertRow(row, errorState))
+			return true;
+
+		sqlite3_reset(mInsertStatement);
+		return false;
+	}
+
+
+	void DatabaseTable::addAsync(const rtti::Object& object)
+	{
+		// Copy the values now, the object can change before the row is written
+		Row row = createRow(object);
+		{
+			std::lock_guard<std::mutex> lock(mPendingMutex);
+			mPendingRows.emplace_back(std::move(row));
+		}
+		mOwner->rowAdded();
+	}
+
+
+	DatabaseTable::Row DatabaseTable::createRow(const rtti::Object& object) const
 	{
 		// Types need to match exactly: even if the type is derived, it could mean that additional properties were added, making it incompatible with the table
 		assert(object.get_type() == mObjectType);
 
-		// Go through the columns structure. We already prepared the query so all we need to do is bind the values from this object to the query
-		std::string columns;
-		std::string values;
-		for (int index = 0; index < mColumns.size(); ++index)
+		Row row;
+		row.reserve(mColumns.size());
+		for (const Column& column : mColumns)
 		{
-			Column& column = mColumns[index];
-
 			rtti::ResolvedPath resolvedPath;
 			bool resolved = column.mPath->getRTTIPath().resolve(&object, resolvedPath);
 			assert(resolved);
+			row.emplace_back(resolvedPath.getValue());
+		}
+		return row;
+	}
+
+
+	bool DatabaseTable::writePendingRows(int& outCount, utility::ErrorState& errorState)
+	{
+		// Swap so rows can be added while writing, the swapped buffer is reused
+		{
+			std::lock_guard<std::mutex> lock(mPendingMutex);
+			mWriteRows.swap(mPendingRows);
+		}
+		outCount = static_cast<int>(mWriteRows.size());
+
+		// A row that fails is skipped, only the failing insert is undone and the other rows are still written
+		int failed = 0;
+		std::string first_error;
+		for (const Row& row : mWriteRows)
+		{
+			utility::ErrorState row_error;
+			if (insertRow(row, row_error))
+				continue;
+
+			sqlite3_reset(mInsertStatement);
+			if (failed++ == 0)
+				first_error = row_error.toString();
+		}
+		mWriteRows.clear();
+
+		return errorState.check(failed == 0, "Failed to write %d of %d rows to table %s: %s", failed, outCount, mTableID.c_str(), first_error.c_str());
+	}
 
-			if (!errorState.check(bindColumnValue(resolvedPath.getType(), resolvedPath.getValue(), *mInsertStatement, index+1), "Failed to set value for column %d", index))
+
+	bool DatabaseTable::insertRow(const Row& values, utility::ErrorState& errorState)
+	{
+		assert(values.size() == mColumns.size());
+		for (int index = 0; index < mColumns.size(); ++index)
+		{
+			if (!errorState.check(bindColumnValue(mColumns[index].mType, values[index], *mInsertStatement, index + 1), "Failed to set value for column %d", index))
 				return false;
 		}
 
@@ -335,15 +480,14 @@ namespace nap
 			return false;
 
 		// SQL statement needs to be reset after the step returned SQLITE_DONE
-		if (!errorState.check(sqlite3_reset(mInsertStatement) == SQLITE_OK, "Failed to reset insert statement"))
-			return false;
-
-		return true;
+		return errorState.check(sqlite3_reset(mInsertStatement) == SQLITE_OK, "Failed to reset insert statement");
 	}
 
 
 	bool DatabaseTable::query(const std::string& whereClause, std::vector<std::unique_ptr<rtti::Object>>& objects, utility::ErrorState& errorState)
 	{
+		std::lock_guard<std::mutex> lock(mOwner->mMutex);
+
 		// Execute the query
 		std::string sql = utility::stringFormat("SELECT * FROM %s %s %s", mTableID.c_str(), whereClause.empty() ? "" : "WHERE", whereClause.c_str());
 		sqlite3_stmt* statement = nullptr;
@@ -371,12 +515,27 @@ namespace nap
 	}
 
 
+	std::unique_ptr<DatabaseCursor> DatabaseTable::createCursor(const std::string& whereClause, utility::ErrorState& errorState)
+	{
+		std::lock_guard<std::mutex> lock(mOwner->mMutex);
+
+		// Prepare the query, rows are stepped through by the cursor
+		std::string sql = utility::stringFormat("SELECT * FROM %s %s %s", mTableID.c_str(), whereClause.empty() ? "" : "WHERE", whereClause.c_str());
+		sqlite3_stmt* statement = nullptr;
+		if (!errorState.check(sqlite3_prepare_v2(mDatabase, sql.c_str(), sql.size(), &statement, nullptr) == SQLITE_OK, "Failed to create query %s", sql.c_str()))
+			return nullptr;
+
+		return std::unique_ptr<DatabaseCursor>(new DatabaseCursor(*this, *statement));
+	}
+
+
 	bool DatabaseTable::getOrCreateIndex(const DatabasePropertyPath& propertyPath, utility::ErrorState& errorState)
 	{
 		std::string column_name = getColumnName(propertyPath, errorState);
 		if (column_name.empty())
 			return false;
 
+		std::lock_guard<std::mutex> lock(mOwner->mMutex);
 		std::string sql = utility::stringFormat("CREATE INDEX IF NOT EXISTS \"%s_%s\" ON %s (\"%s\")", mTableID.c_str(), column_name.c_str(), mTableID.c_str(), column_name.c_str());
 
 		char* errorMessage = nullptr;
@@ -392,6 +551,16 @@ namespace nap
 
 	bool DatabaseTable::clear(utility::ErrorState& errorState)
 	{
+		// Discard pending rows, they would otherwise be written after clearing the table
+		int discarded = 0;
+		{
+			std::lock_guard<std::mutex> lock(mPendingMutex);
+			discarded = static_cast<int>(mPendingRows.size());
+			mPendingRows.clear();
+		}
+		mOwner->mPendingRowCount -= discarded;
+
+		std::lock_guard<std::mutex> lock(mOwner->mMutex);
 		std::string sql = utility::stringFormat("DELETE FROM %s", mTableID.c_str());
 
 		char* errorMessage = nullptr;
@@ -415,6 +584,16 @@ namespace nap
 	}
 
 
+	int DatabaseTable::getColumnIndex(const DatabasePropertyPath& path, utility::ErrorState& errorState) const
+	{
+		ColumnList::const_iterator pos = std::find_if(mColumns.begin(), mColumns.end(), [&path](const Column& column){ return column.mPath->getRTTIPath() == path.getRTTIPath(); });
+		if (!errorState.check(pos != mColumns.end(), "Unable to retrieve column index for the specified property: the property is not in the database"))
+			return -1;
+
+		return static_cast<int>(pos - mColumns.begin());
+	}
+
+
 	std::string DatabaseTable::generateUniqueColumnName(const rtti::Path& path) const
 	{
 		std::string base_name = cppToDatabaseName(path.toString());
@@ -11,6 +11,8 @@
 #include "rtti/path.h"
 #include "sqlite3.h"
 
+#include <mutex>
+
 namespace nap
 {
 	namespace rtti
@@ -18,6 +20,9 @@ namespace nap
 		class Factory;
 	}
 
+	class Database;
+	class DatabaseTable;
+
 	/**
 	 * Identification of an path to an RTTI property that can be serialized to a DatabaseTable.
 	 * Upon creation, it is verified that this is a property that can be serialized to a table, otherwise the creation will fail.
@@ -50,6 +55,81 @@ namespace nap
 		rtti::Path	mRTTIPath;		///< RTTI path to the property
 	};
 
+	/**
+	 * Streams the result of a query on a DatabaseTable row by row, without creating an object per row.
+	 * Call next() to advance to the next row, then either read() the row into an object that is reused for every row,
+	 * or access the column values directly using getInteger(), getReal() and getText().
+	 * The property paths of the columns are resolved once for the object passed to read(), not for every row.
+	 * Column indices match the column order of the table, use DatabaseTable::getColumnIndex() to find the column of a property.
+	 * The cursor must be destroyed before the table it was created from.
+	 *
+	 *		std::unique_ptr<DatabaseCursor> cursor = table->createCursor("", errorState);
+	 *		MyRow row;
+	 *		while (cursor->next())
+	 *		{
+	 *			cursor->read(row);
+	 *			...
+	 *		}
+	 */
+	class NAPAPI DatabaseCursor final
+	{
+		friend class DatabaseTable;
+	public:
+		/**
+		 * Destructor, finalizes the query.
+		 */
+		~DatabaseCursor();
+
+		DatabaseCursor(const DatabaseCursor& rhs) = delete;
+		DatabaseCursor& operator=(const DatabaseCursor& rhs) = delete;
+
+		/**
+		 * Advances the cursor to the next row.
+		 * @return if the cursor points to a row, false when all rows have been visited.
+		 */
+		bool next();
+
+		/**
+		 * Sets all properties of the object from the current row. Only valid after next() returned true.
+		 * Object should be of the type that the table was bound to, reuse the same object for every row.
+		 * @param object the object to fill
+		 */
+		void read(rtti::Object& object);
+
+		/**
+		 * @return number of columns in a row
+		 */
+		int getColumnCount() const;
+
+		/**
+		 * @param column the column index
+		 * @return integer value of the column in the current row
+		 */
+		int64_t getInteger(int column);
+
+		/**
+		 * @param column the column index
+		 * @return floating point value of the column in the current row
+		 */
+		double getReal(int column);
+
+		/**
+		 * Returns the text value of a column in the current row, valid until the cursor advances.
+		 * @param column the column index
+		 * @return text value of the column in the current row, never nullptr
+		 */
+		const char* getText(int column);
+
+	private:
+		DatabaseCursor(DatabaseTable& table, sqlite3_stmt& statement);
+
+		DatabaseTable*						mTable = nullptr;			///< Table that created the cursor
+		sqlite3_stmt*						mStatement = nullptr;		///< The query
+		const rtti::Object*					mResolvedObject = nullptr;	///< Object the paths are resolved against
+		std::vector<rtti::ResolvedPath>		mResolvedPaths;				///< Resolved path of every column
+	};
+
+
 	/**
 	 * Table in a SQlite database that for serializing RTTI object to and from the database. RTTI objects can have embedded classes/structs in them,
 	 * but not arrays or pointers. So it is suitable for serializing vectors of relatively simple classes and structs to and from a database. To avoid
@@ -58,17 +138,19 @@ namespace nap
 	 */
 	class NAPAPI DatabaseTable final
 	{
+		friend class Database;
+		friend class DatabaseCursor;
 	public:
 		using DatabasePropertyPathList = std::vector<DatabasePropertyPath>;
 
 		/**
 		 * Constructor
-		 * @param database: The internal sql database object managed by Database
+		 * @param database: The database that manages this table
 		 * @param factory: A factory for creating objects when they are returned from the database.
 		 * @param tableID: A unique ID representing this table
 		 * @param objectType: The object type that will be serialized to this table.
 		 */
-		DatabaseTable(sqlite3& database, rtti::Factory& factory, const std::string& tableID, const rtti::TypeInfo& objectType);
+		DatabaseTable(Database& database, rtti::Factory& factory, const std::string& tableID, const rtti::TypeInfo& objectType);
 
 		/**
 		 * Destructor
@@ -102,6 +184,14 @@ namespace nap
 		 */
 		bool add(const rtti::Object& object, utility::ErrorState& errorState);
 
+		/**
+		 * Adds an object to the database without waiting for it to be written. Object should be of the type that this table was bound to in the constructor.
+		 * The property values are copied, the row is written in a transaction together with other pending rows by the writer thread 
+		 * of the database, see Database::startWriter(), or on Database::flush(). Rows added to the same table are written in order.
+		 * @param object: Object to serialize to the table.
+		 */
+		void addAsync(const rtti::Object& object);
+
 		/**
 		 * Query the table for objects. The query will deserialize the objects through the factory that was passed onto the 
 		 * constructor and fill it with the values from the database. The whereClause is a condition that can be filled in 
@@ -117,6 +207,15 @@ namespace nap
 		 */
 		bool query(const std::string& whereClause, std::vector<std::unique_ptr<rtti::Object>>& objects, utility::ErrorState& errorState);
 
+		/**
+		 * Query the table for rows, without creating an object for every row. See query() for the format of the whereClause.
+		 * Use the cursor to read the rows one by one, either into a single object or by column.
+		 * @param whereClause: The part of the SQL query that comes after the WHERE statement. Keep empty to visit all rows.
+		 * @param errorState if the function returns nullptr, contains error information.
+		 * @return the cursor, nullptr if the query failed.
+		 */
+		std::unique_ptr<DatabaseCursor> createCursor(const std::string& whereClause, utility::ErrorState& errorState);
+
 		/**
 		 * Clears all rows from the table.
 		 * @param errorState: if the function returns false, contains error information.
@@ -132,6 +231,15 @@ namespace nap
 		 */
 		std::string getColumnName(const DatabasePropertyPath& path, utility::ErrorState& errorState) const;
 
+		/**
+		 * Get the index of the column for the specified database path, used to access a column using a nap::DatabaseCursor.
+		 *
+		 * @param path The path to get the column index for
+		 * @param errorState: if the function returns -1, contains error information.
+		 * @return The column index for the specified path, or -1 if the path could not be found
+		 */
+		int getColumnIndex(const DatabasePropertyPath& path, utility::ErrorState& errorState) const;
+
 	private:
 		/**
 		 * Generate a column name for the specified RTTI path. The generated name is unique with respect to other columns in the table.
@@ -141,6 +249,25 @@ namespace nap
 		 */
 		std::string generateUniqueColumnName(const rtti::Path& path) const;
 
+		/**
+		 * Inserts all rows added using addAsync(). Must be called by the database with the database lock held.
+		 * Rows that fail to be written are skipped, the other rows are still inserted.
+		 * @param outCount number of rows taken from the list of pending rows, including rows that failed to be written
+		 * @param errorState if the function returns false, contains error information.
+		 * @return if all rows were written
+		 */
+		bool writePendingRows(int& outCount, utility::ErrorState& errorState);
+
+		/**
+		 * Copies the values of all columns from an object.
+		 */
+		std::vector<rtti::Variant> createRow(const rtti::Object& object) const;
+
+		/**
+		 * Binds the values of a row to the insert statement and executes it. Must be called with the database lock held.
+		 */
+		bool insertRow(const std::vector<rtti::Variant>& values, utility::ErrorState& errorState);
+
 	private:
 		/**
 		 * Metadata for a column in the database
@@ -150,15 +277,22 @@ namespace nap
 			std::unique_ptr<DatabasePropertyPath>	mPath;			///< Path to the property
 			std::string								mName;			///< Name of the column in the database
 			std::string								mSqlType;		///< SQL typename for a column (INTEGER/REAL/TEXT)
+			rtti::TypeInfo							mType;			///< Type of the property
 		};
 
 		using ColumnList = std::vector<Column>;
+		using Row = std::vector<rtti::Variant>;
 
+		Database*		mOwner = nullptr;				///< Database that manages this table
 		sqlite3*		mDatabase = nullptr;			///< Sqlite object
 		sqlite3_stmt*   mInsertStatement = nullptr;		///< Already prepared statement for quick insertion of objects
 		rtti::Factory*  mFactory = nullptr;				///< Factory used when deserializing object from the database
 		rtti::TypeInfo	mObjectType;					///< Type of object that is used to serialize/deserialize this table
 		std::string		mTableID;						///< Unique ID / name of the table
 		ColumnList		mColumns;						///< List of all properties/columns that are to be serialized/deserialized
+
+		std::mutex			mPendingMutex;				///< Guards the pending rows
+		std::vector<Row>	mPendingRows;				///< Rows added using addAsync(), not written yet
+		std::vector<Row>	mWriteRows;					///< Rows being written, swapped with the pending rows
 	};
 }
@@ -93,7 +93,6 @@ namespace nap
 		SystemTimer timer;
 		timer.start();
 
-		std::vector<EtherDreamPoint> mPointsToWrite;
 		while (!mStopWriting)
 		{
 			mStatus = getWriteStatus();
@@ -111,19 +110,17 @@ namespace nap
 				}
 				case EtherDreamInterface::EStatus::READY:
 				{
-					// Copy points over
-					mWriteMutex.lock();
-					if (mPoints.size() == 0)
+					// Swap in the latest frame when available, otherwise keep writing the current frame
+					mFrames.update();
+					std::vector<EtherDreamPoint>& points = mFrames.getReadBuffer();
+					if (points.empty())
 					{
-						mWriteMutex.unlock();
 						std::this_thread::sleep_for(std::chrono::milliseconds(100));
 						continue;
 					}
-					mPointsToWrite = mPoints;
-					mWriteMutex.unlock();
 
 					// Write data
-					if (!writeFrame(&(mPointsToWrite.front()), mPointsToWrite.size()))
+					if (!writeFrame(points.data(), points.size()))
 					{
 						nap::Logger::warn("Unable to write frame to Etherdream DAC: %s", mDacName.c_str());
 					}
@@ -167,11 +164,11 @@ namespace nap
 	}
 
 
-	void EtherDreamDac::setPoints(std::vector<EtherDreamPoint>& points)
+	void EtherDreamDac::setPoints(const std::vector<EtherDreamPoint>& points)
 	{
-		mWriteMutex.lock();
-		mPoints = points;
-		mWriteMutex.unlock();
+		// Fill write buffer, reuses allocated memory, and publish it as the latest frame
+		mFrames.getWriteBuffer().assign(points.begin(), points.end());
+		mFrames.publish();
 	}
 
 
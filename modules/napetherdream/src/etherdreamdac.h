@@ -7,8 +7,8 @@
 // External Includes
 #include <nap/device.h>
 #include <rtti/factory.h>
+#include <utility/triplebuffer.h>
 #include <thread>
-#include <mutex>
 #include <atomic>
 
 // Local Includes
@@ -54,9 +54,12 @@ namespace nap
 		virtual void stop() override;
 
 		/**
-		 *	Set the points for this dac to write
+		 * Set the points for this dac to write.
+		 * The points are copied into a back buffer that is handed over to the write thread without locking.
+		 * When called multiple times before the write thread picks up a frame, only the latest frame is written.
+		 * @param points the points to write
 		 */
-		void setPoints(std::vector<EtherDreamPoint>& points);
+		void setPoints(const std::vector<EtherDreamPoint>& points);
 		
 		/**
 		 * @return if the DAC is connected
@@ -80,10 +83,11 @@ namespace nap
 		int	 mIndex = -1;
 
 		// Thread used to write frames
-		std::mutex						mWriteMutex;
 		std::thread						mWriteThread;
 		std::atomic<bool>				mStopWriting = { false };
-		std::vector<EtherDreamPoint>	mPoints;
+
+		// Frames handed from setPoints() to the write thread
+		utility::TripleBuffer<std::vector<EtherDreamPoint>> mFrames;
 
 		// Thread that writes frame to laser when available
 		void							writeThread();
@@ -0,0 +1,295 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "laserpath.h"
+
+// External Includes
+#include <mathutils.h>
+#include <cmath>
+#include <limits>
+
+RTTI_BEGIN_STRUCT(nap::LaserPathSettings)
+	RTTI_PROPERTY("MaxStep",			&nap::LaserPathSettings::mMaxStep,			nap::rtti::EPropertyMetaData::Default)
+	RTTI_PROPERTY("MaxTravelStep",		&nap::LaserPathSettings::mMaxTravelStep,	nap::rtti::EPropertyMetaData::Default)
+	RTTI_PROPERTY("CornerAngle",		&nap::LaserPathSettings::mCornerAngle,		nap::rtti::EPropertyMetaData::Default)
+	RTTI_PROPERTY("CornerDwell",		&nap::LaserPathSettings::mCornerDwell,		nap::rtti::EPropertyMetaData::Default)
+	RTTI_PROPERTY("BlankDwell",			&nap::LaserPathSettings::mBlankDwell,		nap::rtti::EPropertyMetaData::Default)
+	RTTI_PROPERTY("OptimizeOrder",		&nap::LaserPathSettings::mOptimizeOrder,	nap::rtti::EPropertyMetaData::Default)
+RTTI_END_STRUCT
+
+//////////////////////////////////////////////////////////////////////////
+
+// bi-cubic ease in / out, moves travel points toward the begin and end of a travel move
+static float travelEaseInOut(float p)
+{
+	if (p < 0.5f)
+		return 4.0f * p * p * p;
+	float f = (2.0f * p) - 2.0f;
+	return 0.5f * f * f * f + 1.0f;
+}
+
+
+// Returns direction change in degrees in between two segments
+static float cornerAngle(const glm::vec2& a, const glm::vec2& b, const glm::vec2& c)
+{
+	glm::vec2 ab = b - a;
+	glm::vec2 bc = c - b;
+	float len = glm::length(ab) * glm::length(bc);
+	if (len <= std::numeric_limits<float>::epsilon())
+		return 0.0f;
+	float cos_angle = nap::math::clamp<float>(glm::dot(ab, bc) / len, -1.0f, 1.0f);
+	return glm::degrees(std::acos(cos_angle));
+}
+
+
+// Converts a normalized value to an etherdream coordinate
+static int16_t toEtherPosition(float value)
+{
+	return static_cast<int16_t>(nap::math::clamp<float>(value, -1.0f, 1.0f) * static_cast<float>(nap::EtherDreamInterface::etherMax()));
+}
+
+
+// Converts a normalized color channel to an etherdream color value
+static int16_t toEtherColor(float value)
+{
+	return static_cast<int16_t>(nap::math::clamp<float>(value, 0.0f, 1.0f) * static_cast<float>(nap::EtherDreamInterface::etherMax()));
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+
+namespace nap
+{
+	void LaserPathBuilder::clear()
+	{
+		mPositions.clear();
+		mColors.clear();
+		mPaths.clear();
+	}
+
+
+	void LaserPathBuilder::addPath(const glm::vec3* positions, const glm::vec4* colors, int count, bool closed, const glm::mat4& transform)
+	{
+		if (count < 1)
+			return;
+
+		Path path;
+		path.mOffset = static_cast<int>(mPositions.size());
+		path.mCount = count;
+		path.mClosed = closed && count > 2;
+		mPositions.resize(mPositions.size() + count);
+		mColors.insert(mColors.end(), colors, colors + count);
+
+		// Only the x and y rows of the transform contribute to laser space,
+		// evaluate those directly instead of a full matrix * vector multiply per vertex.
+		const float m00 = transform[0][0], m10 = transform[1][0], m20 = transform[2][0], m30 = transform[3][0];
+		const float m01 = transform[0][1], m11 = transform[1][1], m21 = transform[2][1], m31 = transform[3][1];
+		glm::vec2* out = mPositions.data() + path.mOffset;
+		for (int i = 0; i < count; i++)
+		{
+			const glm::vec3& p = positions[i];
+			out[i].x = m00 * p.x + m10 * p.y + m20 * p.z + m30;
+			out[i].y = m01 * p.x + m11 * p.y + m21 * p.z + m31;
+		}
+
+		// Compute length in laser space
+		for (int i = 1; i < count; i++)
+			path.mLength += glm::distance(out[i - 1], out[i]);
+		if (path.mClosed)
+			path.mLength += glm::distance(out[count - 1], out[0]);
+
+		mPaths.emplace_back(path);
+	}
+
+
+	int LaserPathBuilder::getVertex(const Path& path, int index) const
+	{
+		int local = path.mReversed ? path.mStart - index : path.mStart + index;
+		local = ((local % path.mCount) + path.mCount) % path.mCount;
+		return path.mOffset + local;
+	}
+
+
+	void LaserPathBuilder::orderPaths(bool optimize)
+	{
+		mOrder.clear();
+		if (!optimize)
+		{
+			for (int i = 0; i < mPaths.size(); i++)
+			{
+				mPaths[i].mStart = 0;
+				mPaths[i].mReversed = false;
+				mOrder.emplace_back(i);
+			}
+			return;
+		}
+
+		// Greedy nearest neighbour, starting at the center of the output.
+		// Open paths can be entered at either end, closed paths at any vertex.
+		mVisited.assign(mPaths.size(), false);
+		glm::vec2 beam(0.0f, 0.0f);
+		for (int n = 0; n < mPaths.size(); n++)
+		{
+			int best_path = -1;
+			int best_vertex = 0;
+			float best_dist = std::numeric_limits<float>::max();
+			for (int i = 0; i < mPaths.size(); i++)
+			{
+				if (mVisited[i])
+					continue;
+
+				const Path& path = mPaths[i];
+				if (path.mClosed)
+				{
+					for (int v = 0; v < path.mCount; v++)
+					{
+						glm::vec2 delta = mPositions[path.mOffset + v] - beam;
+						float dist = glm::dot(delta, delta);
+						if (dist < best_dist)
+						{
+							best_dist = dist; best_path = i; best_vertex = v;
+						}
+					}
+				}
+				else
+				{
+					int ends[2] = { 0, path.mCount - 1 };
+					for (int v : ends)
+					{
+						glm::vec2 delta = mPositions[path.mOffset + v] - beam;
+						float dist = glm::dot(delta, delta);
+						if (dist < best_dist)
+						{
+							best_dist = dist; best_path = i; best_vertex = v;
+						}
+					}
+				}
+			}
+
+			Path& path = mPaths[best_path];
+			path.mStart = best_vertex;
+			path.mReversed = !path.mClosed && best_vertex != 0;
+			mVisited[best_path] = true;
+			mOrder.emplace_back(best_path);
+
+			// Beam ends at start of closed path, other end of open path
+			beam = mPositions[getVertex(path, path.mClosed ? 0 : path.mCount - 1)];
+		}
+	}
+
+
+	void LaserPathBuilder::emit(const glm::vec2& position, const glm::vec4& color, std::vector<EtherDreamPoint>& outPoints) const
+	{
+		outPoints.emplace_back();
+		EtherDreamPoint& point = outPoints.back();
+		point.X = toEtherPosition(mFlipHorizontal ? -position.x : position.x);
+		point.Y = toEtherPosition(mFlipVertical ? -position.y : position.y);
+		point.R = toEtherColor(color.r * color.a);
+		point.G = toEtherColor(color.g * color.a);
+		point.B = toEtherColor(color.b * color.a);
+		point.I = toEtherColor(color.a);
+	}
+
+
+	void LaserPathBuilder::build(const LaserPathSettings& settings, int pointBudget, bool flipHorizontal, bool flipVertical, std::vector<EtherDreamPoint>& outPoints)
+	{
+		outPoints.clear();
+		mFlipHorizontal = flipHorizontal;
+		mFlipVertical = flipVertical;
+		if (mPaths.empty())
+			return;
+
+		orderPaths(settings.mOptimizeOrder);
+
+		// Gather draw and travel distance, travel includes the move back to the first path.
+		// A path that ends where the next path starts needs no travel move.
+		float draw_length = 0.0f;
+		float travel_length = 0.0f;
+		int travel_count = 0;
+		for (int n = 0; n < mOrder.size(); n++)
+		{
+			const Path& path = mPaths[mOrder[n]];
+			const Path& next = mPaths[mOrder[(n + 1) % mOrder.size()]];
+			draw_length += path.mLength;
+			float gap = glm::distance(mPositions[getVertex(path, path.mClosed ? 0 : path.mCount - 1)], mPositions[getVertex(next, 0)]);
+			travel_length += gap;
+			travel_count += gap > 0.0f ? 1 : 0;
+		}
+
+		// Scale steps to match the point budget, dwell points are not scaled
+		float max_step = math::max<float>(settings.mMaxStep, 0.0001f);
+		float travel_step = math::max<float>(settings.mMaxTravelStep, 0.0001f);
+		if (pointBudget > 0)
+		{
+			int fixed_points = static_cast<int>(mOrder.size()) + travel_count * settings.mBlankDwell * 2;
+			float available = static_cast<float>(math::max<int>(pointBudget - fixed_points, static_cast<int>(mOrder.size()) * 2));
+			float estimate = draw_length / max_step + travel_length / travel_step;
+			float scale = estimate / available;
+			if (scale > 0.0f)
+			{
+				max_step *= scale;
+				travel_step *= scale;
+			}
+		}
+
+		if (pointBudget > 0)
+			outPoints.reserve(pointBudget);
+		const glm::vec4 blank(0.0f, 0.0f, 0.0f, 0.0f);
+		for (int n = 0; n < mOrder.size(); n++)
+		{
+			const Path& path = mPaths[mOrder[n]];
+			int vertex_count = path.mClosed ? path.mCount + 1 : path.mCount;
+
+			// Draw path, limit distance in between points and dwell on sharp corners
+			emit(mPositions[getVertex(path, 0)], mColors[getVertex(path, 0)], outPoints);
+			for (int v = 1; v < vertex_count; v++)
+			{
+				int ia = getVertex(path, v - 1);
+				int ib = getVertex(path, v);
+				const glm::vec2& a = mPositions[ia];
+				const glm::vec2& b = mPositions[ib];
+				int steps = math::max<int>(static_cast<int>(std::ceil(glm::distance(a, b) / max_step)), 1);
+				float inc = 1.0f / static_cast<float>(steps);
+				for (int s = 1; s <= steps; s++)
+				{
+					float t = inc * static_cast<float>(s);
+					emit(glm::mix(a, b, t), glm::mix(mColors[ia], mColors[ib], t), outPoints);
+				}
+
+				// Dwell on corner, proportional to the change in direction
+				bool has_next = v + 1 < vertex_count || path.mClosed;
+				if (!has_next || settings.mCornerDwell <= 0)
+					continue;
+				const glm::vec2& c = mPositions[getVertex(path, v + 1)];
+				float angle = cornerAngle(a, b, c);
+				if (angle <= settings.mCornerAngle)
+					continue;
+				int dwell = math::max<int>(static_cast<int>(std::round(static_cast<float>(settings.mCornerDwell) * angle / 180.0f)), 1);
+				for (int d = 0; d < dwell; d++)
+					emit(b, mColors[ib], outPoints);
+			}
+
+			// Travel to the start of the next path with the beam off, unless the next path starts here
+			const Path& next = mPaths[mOrder[(n + 1) % mOrder.size()]];
+			const glm::vec2& exit = mPositions[getVertex(path, path.mClosed ? 0 : path.mCount - 1)];
+			const glm::vec2& entry = mPositions[getVertex(next, 0)];
+			if (exit == entry)
+				continue;
+
+			for (int d = 0; d < settings.mBlankDwell; d++)
+				emit(exit, blank, outPoints);
+
+			int travel_steps = static_cast<int>(std::ceil(glm::distance(exit, entry) / travel_step));
+			for (int s = 1; s < travel_steps; s++)
+			{
+				float t = travelEaseInOut(static_cast<float>(s) / static_cast<float>(travel_steps));
+				emit(glm::mix(exit, entry, t), blank, outPoints);
+			}
+
+			for (int d = 0; d < settings.mBlankDwell; d++)
+				emit(entry, blank, outPoints);
+		}
+	}
+}
@@ -0,0 +1,118 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Local Includes
+#include "etherdreaminterface.h"
+
+// External Includes
+#include <glm/glm.hpp>
+#include <rtti/typeinfo.h>
+#include <utility/dllexport.h>
+#include <vector>
+
+namespace nap
+{
+	/**
+	 * Settings that control how laser paths are ordered, resampled and blanked.
+	 * All distances are in normalized laser space, where -1 - 1 spans the full output range of the DAC.
+	 */
+	struct NAPAPI LaserPathSettings
+	{
+		float	mMaxStep = 0.01f;				///< Property: 'MaxStep' maximum distance between two lit points, limits the scan velocity
+		float	mMaxTravelStep = 0.05f;			///< Property: 'MaxTravelStep' maximum distance between two blanked points when travelling in between paths
+		float	mCornerAngle = 30.0f;			///< Property: 'CornerAngle' direction change in degrees above which dwell points are added to a corner
+		int		mCornerDwell = 4;				///< Property: 'CornerDwell' number of dwell points added to a 180 degree corner
+		int		mBlankDwell = 3;				///< Property: 'BlankDwell' number of blanked points at the start and end of every travel move
+		bool	mOptimizeOrder = true;			///< Property: 'OptimizeOrder' if paths are reordered and reversed to minimize travel distance
+	};
+
+
+	/**
+	 * Converts a set of paths into a single stream of laser points.
+	 *
+	 * Paths are added in world space together with a transform that maps them to normalized laser space.
+	 * Only the x and y rows of the transform are evaluated, once per input vertex, in a tight loop over the vertices.
+	 * On build the paths are ordered to minimize the (blanked) travel distance in between paths, open paths can be
+	 * drawn in reverse and closed paths can start at any vertex. Every path is resampled so that the distance
+	 * in between two points never exceeds the configured step, which results in an even scan speed.
+	 * Dwell points are added to sharp corners and to the start and end of every travel move.
+	 * When a path ends where the next path starts, no travel move is added and the beam stays on.
+	 *
+	 * All buffers are reused in between builds, no memory is allocated once the builder has warmed up.
+	 */
+	class NAPAPI LaserPathBuilder final
+	{
+	public:
+		/**
+		 * Removes all paths, keeps allocated memory.
+		 */
+		void clear();
+
+		/**
+		 * Adds a path. Positions are transformed to normalized laser space using the given transform.
+		 * @param positions path vertex positions
+		 * @param colors path vertex colors, alpha is used as intensity
+		 * @param count number of vertices
+		 * @param closed if the last vertex connects to the first vertex
+		 * @param transform maps the positions to normalized laser space
+		 */
+		void addPath(const glm::vec3* positions, const glm::vec4* colors, int count, bool closed, const glm::mat4& transform);
+
+		/**
+		 * @return number of added paths
+		 */
+		int getPathCount() const											{ return static_cast<int>(mPaths.size()); }
+
+		/**
+		 * Orders, resamples and blanks all added paths into laser points.
+		 * When a point budget is given the steps are scaled so that the result approximates that number of points,
+		 * for example: the point rate of the DAC divided by the requested framerate.
+		 * @param settings ordering, resample and blanking settings
+		 * @param pointBudget approximate number of points to generate, 0 to use the steps in the settings as is.
+		 * @param flipHorizontal if the output is mirrored horizontally
+		 * @param flipVertical if the output is mirrored vertically
+		 * @param outPoints the generated points, overwritten
+		 */
+		void build(const LaserPathSettings& settings, int pointBudget, bool flipHorizontal, bool flipVertical, std::vector<EtherDreamPoint>& outPoints);
+
+	private:
+		/**
+		 * A path, stored as a range in the shared vertex buffers.
+		 */
+		struct Path
+		{
+			int		mOffset = 0;				///< First vertex in the vertex buffers
+			int		mCount = 0;					///< Number of vertices
+			bool	mClosed = false;			///< If the path is closed
+			float	mLength = 0.0f;				///< Length of the path in laser space
+			int		mStart = 0;					///< Vertex the path starts drawing from, set on build
+			bool	mReversed = false;			///< If the path is drawn in reverse, set on build
+		};
+
+		/**
+		 * Orders all paths, greedy nearest neighbour starting at the center of the output
+		 */
+		void orderPaths(bool optimize);
+
+		/**
+		 * @return index in the vertex buffer of the vertex at the given index of a path, relative to the path start and direction.
+		 */
+		int getVertex(const Path& path, int index) const;
+
+		/**
+		 * Appends a point in normalized laser space to the output
+		 */
+		void emit(const glm::vec2& position, const glm::vec4& color, std::vector<EtherDreamPoint>& outPoints) const;
+
+		std::vector<glm::vec2> mPositions;		///< All path positions in laser space
+		std::vector<glm::vec4> mColors;			///< All path colors
+		std::vector<Path> mPaths;				///< All added paths
+		std::vector<int> mOrder;				///< Draw order of paths, set on build
+		std::vector<bool> mVisited;				///< Used when ordering paths
+		bool mFlipHorizontal = false;			///< Mirror horizontally, set on build
+		bool mFlipVertical = false;				///< Mirror vertically, set on build
+	};
+}
@@ -9,6 +9,10 @@
 // External Includes
 #include <renderservice.h>
 #include <nap/core.h>
+#include <nap/profiler.h>
+#include <nap/logger.h>
+#include <utility/stringutils.h>
+#include <cstring>
 
 namespace ImGui
 {
@@ -18,4 +22,74 @@ namespace ImGui
 		nap::IMGuiService* gui_service = core.getService<nap::IMGuiService>();
 		ImGui::Image(gui_service->getTextureHandle(texture), size, uv0, uv1, tint_col, border_col);
 	}
+
+
+	void ProfilerPanel(nap::Core& core, float window /*= 1.0f*/)
+	{
+		nap::Profiler& profiler = nap::Profiler::instance();
+		bool enabled = nap::Profiler::isEnabled();
+		if (ImGui::Checkbox("Record", &enabled))
+			nap::Profiler::setEnabled(enabled);
+
+		ImGui::SameLine();
+		if (ImGui::Button("Clear"))
+			profiler.clear();
+
+		ImGui::SameLine();
+		if (ImGui::Button("Export Trace"))
+		{
+			std::string filename = nap::utility::stringFormat("profile_%s.json",
+				nap::timeFormat(nap::getCurrentTime(), "%Y-%m-%d_%H-%M-%S_%ms").c_str());
+			nap::utility::ErrorState error;
+			if (profiler.writeTrace(filename, error))
+				nap::Logger::info("Wrote profile trace to: %s", filename.c_str());
+			else
+				nap::Logger::error(error.toString());
+		}
+
+		ImGui::Text(nap::utility::stringFormat("Framerate: %.02f", core.getFramerate()).c_str());
+
+		// Gather duration of the most recent frames
+		std::vector<nap::ProfileThread> threads;
+		profiler.collect(threads);
+		std::vector<float> frame_times;
+		for (const auto& thread : threads)
+		{
+			for (const auto& zone : thread.mZones)
+			{
+				if (zone.mName != nullptr && std::strcmp(zone.mName, nap::Profiler::frameZone) == 0)
+					frame_times.emplace_back(static_cast<float>(zone.getDuration()));
+			}
+		}
+
+		constexpr int max_frames = 240;
+		int offset = std::max<int>(static_cast<int>(frame_times.size()) - max_frames, 0);
+		int count = static_cast<int>(frame_times.size()) - offset;
+		if (count > 0)
+		{
+			std::string overlay = nap::utility::stringFormat("%.02f ms", frame_times.back());
+			ImGui::PlotLines("Frame Time", frame_times.data() + offset, count, 0, overlay.c_str(), 0.0f, FLT_MAX, ImVec2(0.0f, 60.0f));
+		}
+
+		// Display time spent in zones over the requested window
+		std::vector<nap::ProfileStatistics> statistics;
+		profiler.getStatistics(window, statistics);
+
+		ImGui::Columns(5, "ProfilerZones");
+		ImGui::Text("Zone");		ImGui::NextColumn();
+		ImGui::Text("Category");	ImGui::NextColumn();
+		ImGui::Text("Count");		ImGui::NextColumn();
+		ImGui::Text("Avg (ms)");	ImGui::NextColumn();
+		ImGui::Text("Max (ms)");	ImGui::NextColumn();
+		ImGui::Separator();
+		for (const auto& stat : statistics)
+		{
+			ImGui::TextUnformatted(stat.mName.c_str());								ImGui::NextColumn();
+			ImGui::TextUnformatted(stat.mCategory.c_str());							ImGui::NextColumn();
+			ImGui::Text("%d", stat.mCount);										ImGui::NextColumn();
+			ImGui::Text("%.03f", stat.mAverage);								ImGui::NextColumn();
+			ImGui::Text("%.03f", stat.mMax);									ImGui::NextColumn();
+		}
+		ImGui::Columns(1);
+	}
 }
\ No newline at end of file
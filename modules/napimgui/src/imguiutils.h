@@ -9,6 +9,7 @@
 
 // External Includes
 #include <texture2d.h>
+#include <nap/core.h>
 #include <utility/dllexport.h>
 
 /**
@@ -28,4 +29,14 @@ namespace ImGui
 	 * @param border_col of the border of the image
 	 */
 	void IMGUI_API Image(nap::Texture2D& texture, const ImVec2& size, const ImVec2& uv0 = ImVec2(0, 1), const ImVec2& uv1 = ImVec2(1, 0), const ImVec4& tint_col = ImVec4(1, 1, 1, 1), const ImVec4& border_col = ImVec4(0, 0, 0, 0));
+
+	/**
+	 * Displays the framerate of core, a plot of the most recent frame times and the time spent in every
+	 * zone recorded by the nap::Profiler, averaged over the given time window in seconds.
+	 * Allows the profiler to be enabled, cleared and exported as a Chrome trace / Perfetto JSON file.
+	 * Call this function in between ImGui::Begin() and ImGui::End().
+	 * @param core the core instance to display the frame statistics of
+	 * @param window time window in seconds zones are aggregated over
+	 */
+	void IMGUI_API ProfilerPanel(nap::Core& core, float window = 1.0f);
 }
\ No newline at end of file
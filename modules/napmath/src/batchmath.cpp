@@ -0,0 +1,314 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "batchmath.h"
+#include "mathutils.h"
+
+// External Includes
+#include <cmath>
+
+// The instruction set is selected at compile time, SSE2 and NEON are part of every supported 64 bit target
+#if defined(__AVX__)
+	#include <immintrin.h>
+	#define NAP_BATCH_AVX
+	#define NAP_BATCH_SSE
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define NAP_BATCH_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	#include <arm_neon.h>
+	#define NAP_BATCH_NEON
+#endif
+
+RTTI_BEGIN_ENUM(nap::math::ESIMDInstructionSet)
+	RTTI_ENUM_VALUE(nap::math::ESIMDInstructionSet::None,	"None"),
+	RTTI_ENUM_VALUE(nap::math::ESIMDInstructionSet::SSE2,	"SSE2"),
+	RTTI_ENUM_VALUE(nap::math::ESIMDInstructionSet::AVX,	"AVX"),
+	RTTI_ENUM_VALUE(nap::math::ESIMDInstructionSet::NEON,	"NEON")
+RTTI_END_ENUM
+
+namespace nap
+{
+	namespace math
+	{
+		/**
+		 * Minimal wrapper around the vector type of the selected instruction set.
+		 * The batch kernels are written once against these functions, the scalar fallback processes one value at a time.
+		 */
+		namespace simd
+		{
+#if defined(NAP_BATCH_AVX)
+			using Pack = __m256;
+			static constexpr int width = 8;
+			static inline Pack load(const float* v)						{ return _mm256_loadu_ps(v); }
+			static inline void store(float* v, Pack a)					{ _mm256_storeu_ps(v, a); }
+			static inline Pack set(float v)								{ return _mm256_set1_ps(v); }
+			static inline Pack add(Pack a, Pack b)						{ return _mm256_add_ps(a, b); }
+			static inline Pack sub(Pack a, Pack b)						{ return _mm256_sub_ps(a, b); }
+			static inline Pack mul(Pack a, Pack b)						{ return _mm256_mul_ps(a, b); }
+			static inline Pack min(Pack a, Pack b)						{ return _mm256_min_ps(a, b); }
+			static inline Pack max(Pack a, Pack b)						{ return _mm256_max_ps(a, b); }
+			static inline Pack greater(Pack a, Pack b)					{ return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+			static inline Pack less(Pack a, Pack b)						{ return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+			static inline Pack equal(Pack a, Pack b)					{ return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+			static inline Pack maskOr(Pack a, Pack b)					{ return _mm256_or_ps(a, b); }
+			static inline Pack maskXor(Pack a, Pack b)					{ return _mm256_xor_ps(a, b); }
+			static inline Pack select(Pack mask, Pack a, Pack b)		{ return _mm256_blendv_ps(b, a, mask); }
+			static inline Pack abs(Pack a)								{ return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+			static inline Pack floor(Pack a)							{ return _mm256_floor_ps(a); }
+#elif defined(NAP_BATCH_SSE)
+			using Pack = __m128;
+			static constexpr int width = 4;
+			static inline Pack load(const float* v)						{ return _mm_loadu_ps(v); }
+			static inline void store(float* v, Pack a)					{ _mm_storeu_ps(v, a); }
+			static inline Pack set(float v)								{ return _mm_set1_ps(v); }
+			static inline Pack add(Pack a, Pack b)						{ return _mm_add_ps(a, b); }
+			static inline Pack sub(Pack a, Pack b)						{ return _mm_sub_ps(a, b); }
+			static inline Pack mul(Pack a, Pack b)						{ return _mm_mul_ps(a, b); }
+			static inline Pack min(Pack a, Pack b)						{ return _mm_min_ps(a, b); }
+			static inline Pack max(Pack a, Pack b)						{ return _mm_max_ps(a, b); }
+			static inline Pack greater(Pack a, Pack b)					{ return _mm_cmpgt_ps(a, b); }
+			static inline Pack less(Pack a, Pack b)						{ return _mm_cmplt_ps(a, b); }
+			static inline Pack equal(Pack a, Pack b)					{ return _mm_cmpeq_ps(a, b); }
+			static inline Pack maskOr(Pack a, Pack b)					{ return _mm_or_ps(a, b); }
+			static inline Pack maskXor(Pack a, Pack b)					{ return _mm_xor_ps(a, b); }
+			static inline Pack select(Pack mask, Pack a, Pack b)		{ return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+			static inline Pack abs(Pack a)								{ return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+
+			// SSE2 has no floor instruction: truncate and correct negative values, valid for values that fit an int
+			static inline Pack floor(Pack a)
+			{
+				Pack t = _mm_cvtepi32_ps(_mm_cvttps_epi32(a));
+				return _mm_sub_ps(t, _mm_and_ps(_mm_cmpgt_ps(t, a), _mm_set1_ps(1.0f)));
+			}
+#elif defined(NAP_BATCH_NEON)
+			using Pack = float32x4_t;
+			static constexpr int width = 4;
+			static inline Pack load(const float* v)						{ return vld1q_f32(v); }
+			static inline void store(float* v, Pack a)					{ vst1q_f32(v, a); }
+			static inline Pack set(float v)								{ return vdupq_n_f32(v); }
+			static inline Pack add(Pack a, Pack b)						{ return vaddq_f32(a, b); }
+			static inline Pack sub(Pack a, Pack b)						{ return vsubq_f32(a, b); }
+			static inline Pack mul(Pack a, Pack b)						{ return vmulq_f32(a, b); }
+			static inline Pack min(Pack a, Pack b)						{ return vminq_f32(a, b); }
+			static inline Pack max(Pack a, Pack b)						{ return vmaxq_f32(a, b); }
+			static inline Pack greater(Pack a, Pack b)					{ return vreinterpretq_f32_u32(vcgtq_f32(a, b)); }
+			static inline Pack less(Pack a, Pack b)						{ return vreinterpretq_f32_u32(vcltq_f32(a, b)); }
+			static inline Pack equal(Pack a, Pack b)					{ return vreinterpretq_f32_u32(vceqq_f32(a, b)); }
+			static inline Pack maskOr(Pack a, Pack b)					{ return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+			static inline Pack maskXor(Pack a, Pack b)					{ return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+			static inline Pack select(Pack mask, Pack a, Pack b)		{ return vbslq_f32(vreinterpretq_u32_f32(mask), a, b); }
+			static inline Pack abs(Pack a)								{ return vabsq_f32(a); }
+
+			// Truncate and correct negative values, valid for values that fit an int
+			static inline Pack floor(Pack a)
+			{
+				Pack t = vcvtq_f32_s32(vcvtq_s32_f32(a));
+				return vsubq_f32(t, vreinterpretq_f32_u32(vandq_u32(vcgtq_f32(t, a), vreinterpretq_u32_f32(vdupq_n_f32(1.0f)))));
+			}
+#else
+			using Pack = float;
+			static constexpr int width = 1;
+			static inline Pack load(const float* v)						{ return *v; }
+			static inline void store(float* v, Pack a)					{ *v = a; }
+			static inline Pack set(float v)								{ return v; }
+			static inline Pack add(Pack a, Pack b)						{ return a + b; }
+			static inline Pack sub(Pack a, Pack b)						{ return a - b; }
+			static inline Pack mul(Pack a, Pack b)						{ return a * b; }
+			static inline Pack min(Pack a, Pack b)						{ return a < b ? a : b; }
+			static inline Pack max(Pack a, Pack b)						{ return a > b ? a : b; }
+			static inline Pack greater(Pack a, Pack b)					{ return a > b ? 1.0f : 0.0f; }
+			static inline Pack less(Pack a, Pack b)						{ return a < b ? 1.0f : 0.0f; }
+			static inline Pack equal(Pack a, Pack b)					{ return a == b ? 1.0f : 0.0f; }
+			static inline Pack maskOr(Pack a, Pack b)					{ return (a != 0.0f || b != 0.0f) ? 1.0f : 0.0f; }
+			static inline Pack maskXor(Pack a, Pack b)					{ return (a != 0.0f) != (b != 0.0f) ? 1.0f : 0.0f; }
+			static inline Pack select(Pack mask, Pack a, Pack b)		{ return mask != 0.0f ? a : b; }
+			static inline Pack abs(Pack a)								{ return std::fabs(a); }
+			static inline Pack floor(Pack a)							{ return std::floor(a); }
+#endif
+			// Fractional part of every value
+			static inline Pack fraction(Pack a)							{ return sub(a, floor(a)); }
+		}
+
+
+		ESIMDInstructionSet getSIMDInstructionSet()
+		{
+#if defined(NAP_BATCH_AVX)
+			return ESIMDInstructionSet::AVX;
+#elif defined(NAP_BATCH_SSE)
+			return ESIMDInstructionSet::SSE2;
+#elif defined(NAP_BATCH_NEON)
+			return ESIMDInstructionSet::NEON;
+#else
+			return ESIMDInstructionSet::None;
+#endif
+		}
+
+
+		namespace batch
+		{
+			/**
+			 * Transforms points or directions, the w component is 1 for points and 0 for directions.
+			 * Every vertex is transformed using one 4 wide multiply add per matrix column.
+			 */
+			template<bool point>
+			static void transform(const glm::mat4& transform, const glm::vec3* input, glm::vec3* output, int count)
+			{
+#if defined(NAP_BATCH_SSE)
+				__m128 c0 = _mm_loadu_ps(&transform[0][0]);
+				__m128 c1 = _mm_loadu_ps(&transform[1][0]);
+				__m128 c2 = _mm_loadu_ps(&transform[2][0]);
+				__m128 c3 = point ? _mm_loadu_ps(&transform[3][0]) : _mm_setzero_ps();
+				for (int i = 0; i < count; i++)
+				{
+					const glm::vec3& v = input[i];
+					__m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(v.x)), _mm_mul_ps(c1, _mm_set1_ps(v.y))), _mm_add_ps(_mm_mul_ps(c2, _mm_set1_ps(v.z)), c3));
+					float result[4];
+					_mm_storeu_ps(result, r);
+					output[i] = { result[0], result[1], result[2] };
+				}
+#elif defined(NAP_BATCH_NEON)
+				float32x4_t c0 = vld1q_f32(&transform[0][0]);
+				float32x4_t c1 = vld1q_f32(&transform[1][0]);
+				float32x4_t c2 = vld1q_f32(&transform[2][0]);
+				float32x4_t c3 = point ? vld1q_f32(&transform[3][0]) : vdupq_n_f32(0.0f);
+				for (int i = 0; i < count; i++)
+				{
+					const glm::vec3& v = input[i];
+					float32x4_t r = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(c3, c0, v.x), c1, v.y), c2, v.z);
+					float result[4];
+					vst1q_f32(result, r);
+					output[i] = { result[0], result[1], result[2] };
+				}
+#else
+				float w = point ? 1.0f : 0.0f;
+				for (int i = 0; i < count; i++)
+					output[i] = glm::vec3(transform * glm::vec4(input[i], w));
+#endif
+			}
+
+
+			void transformPoints(const glm::mat4& transform, const glm::vec3* points, glm::vec3* outPoints, int count)
+			{
+				batch::transform<true>(transform, points, outPoints, count);
+			}
+
+
+			void transformDirections(const glm::mat4& transform, const glm::vec3* directions, glm::vec3* outDirections, int count)
+			{
+				batch::transform<false>(transform, directions, outDirections, count);
+			}
+
+
+			void lerp(const float* start, const float* end, float percent, float* outValues, int count)
+			{
+				int i = 0;
+				simd::Pack p = simd::set(percent);
+				for (; i + simd::width <= count; i += simd::width)
+				{
+					simd::Pack a = simd::load(start + i);
+					simd::store(outValues + i, simd::add(a, simd::mul(simd::sub(simd::load(end + i), a), p)));
+				}
+
+				for (; i < count; i++)
+					outValues[i] = math::lerp<float>(start[i], end[i], percent);
+			}
+
+
+			void smoothDamp(float* currentValues, const float* targetValues, float* velocities, int count, float deltaTime, float smoothTime, float maxSpeed)
+			{
+				// Terms that only depend on time are shared by all values
+				smoothTime = math::max<float>(0.0001f, smoothTime);
+				float num = 2.0f / smoothTime;
+				float num2 = num * deltaTime;
+				float num3 = 1.0f / (1.0f + num2 + 0.48f * num2 * num2 + 0.235f * num2 * num2 * num2);
+				float num6 = maxSpeed * smoothTime;
+
+				simd::Pack p_num = simd::set(num);
+				simd::Pack p_num3 = simd::set(num3);
+				simd::Pack p_num6 = simd::set(num6);
+				simd::Pack p_delta = simd::set(deltaTime);
+				simd::Pack p_zero = simd::set(0.0f);
+
+				int i = 0;
+				for (; i + simd::width <= count; i += simd::width)
+				{
+					simd::Pack current = simd::load(currentValues + i);
+					simd::Pack target_value = simd::load(targetValues + i);
+					simd::Pack velocity = simd::load(velocities + i);
+
+					simd::Pack num4 = simd::min(simd::max(simd::sub(current, target_value), simd::sub(p_zero, p_num6)), p_num6);
+					simd::Pack target = simd::sub(current, num4);
+					simd::Pack num7 = simd::mul(simd::add(velocity, simd::mul(p_num, num4)), p_delta);
+					velocity = simd::mul(simd::sub(velocity, simd::mul(p_num, num7)), p_num3);
+					simd::Pack num8 = simd::add(target, simd::mul(simd::add(num4, num7), p_num3));
+
+					// Prevent overshooting the target, the values are clamped to the target and stop moving
+					simd::Pack moving_up = simd::greater(simd::sub(target_value, current), p_zero);
+					simd::Pack passed = simd::greater(num8, target_value);
+					simd::Pack keep = simd::maskXor(moving_up, passed);
+					simd::store(currentValues + i, simd::select(keep, num8, target_value));
+					simd::store(velocities + i, simd::select(keep, velocity, p_zero));
+				}
+
+				for (; i < count; i++)
+					currentValues[i] = math::smoothDamp(currentValues[i], targetValues[i], velocities[i], deltaTime, smoothTime, maxSpeed);
+			}
+
+
+			void waveform(EWaveform type, const float* times, float frequency, float* outValues, int count)
+			{
+				// The sine has no vector instruction, the loop is left to the compiler
+				if (type == EWaveform::SINE)
+				{
+					for (int i = 0; i < count; i++)
+						outValues[i] = math::waveform(type, times[i], frequency);
+					return;
+				}
+
+				// All other waveforms are a function of the phase: the fractional part of the number of cycles
+				simd::Pack p_frequency = simd::set(frequency);
+				simd::Pack p_half = simd::set(0.5f);
+				simd::Pack p_one = simd::set(1.0f);
+				simd::Pack p_two = simd::set(2.0f);
+				simd::Pack p_zero = simd::set(0.0f);
+
+				int i = 0;
+				for (; i + simd::width <= count; i += simd::width)
+				{
+					simd::Pack time = simd::load(times + i);
+					simd::Pack result;
+					switch (type)
+					{
+					case EWaveform::SAW:
+					{
+						result = simd::fraction(simd::mul(simd::abs(time), p_frequency));
+						break;
+					}
+					case EWaveform::TRIANGLE:
+					{
+						simd::Pack phase = simd::fraction(simd::mul(simd::abs(time), p_frequency));
+						result = simd::abs(simd::sub(simd::mul(phase, p_two), p_one));
+						break;
+					}
+					case EWaveform::SQUARE:
+					default:
+					{
+						// High in the first half of the cycle, half way at the zero crossings of the sine
+						simd::Pack phase = simd::fraction(simd::mul(time, p_frequency));
+						simd::Pack crossing = simd::maskOr(simd::equal(phase, p_zero), simd::equal(phase, p_half));
+						result = simd::select(crossing, p_half, simd::select(simd::less(phase, p_half), p_one, p_zero));
+						break;
+					}
+					}
+					simd::store(outValues + i, result);
+				}
+
+				for (; i < count; i++)
+					outValues[i] = math::waveform(type, times[i], frequency);
+			}
+		}
+	}
+}
@@ -0,0 +1,119 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Local Includes
+#include "waveform.h"
+
+// External Includes
+#include <glm/glm.hpp>
+#include <utility/dllexport.h>
+
+namespace nap
+{
+	namespace math
+	{
+		/**
+		 * Vector instruction set used by the batch functions.
+		 */
+		enum class ESIMDInstructionSet : int
+		{
+			None	= 0,		///< Scalar fallback, no vector instructions
+			SSE2,				///< 4 floats at a time
+			AVX,				///< 8 floats at a time, 4 for transforms
+			NEON				///< 4 floats at a time
+		};
+
+		/**
+		 * @return the vector instruction set the batch functions are compiled with
+		 */
+		NAPAPI ESIMDInstructionSet getSIMDInstructionSet();
+
+		/**
+		 * Functions that apply the scalar math utilities to contiguous arrays of values.
+		 * The values are processed multiple at a time using SSE, AVX or NEON instructions, depending on the target platform.
+		 * Prefer these over a loop that calls the scalar version for every element when the number of elements is large.
+		 * All functions allow the output to be the same array as the input.
+		 */
+		namespace batch
+		{
+			/**
+			 * Transforms points by a matrix, ie: objectToWorld() for every point.
+			 * @param transform the matrix to transform the points with
+			 * @param points the points to transform
+			 * @param outPoints the transformed points
+			 * @param count number of points
+			 */
+			NAPAPI void transformPoints(const glm::mat4& transform, const glm::vec3* points, glm::vec3* outPoints, int count);
+
+			/**
+			 * Transforms directions by a matrix, the translation of the matrix is ignored.
+			 * @param transform the matrix to transform the directions with
+			 * @param directions the directions to transform
+			 * @param outDirections the transformed directions, not normalized
+			 * @param count number of directions
+			 */
+			NAPAPI void transformDirections(const glm::mat4& transform, const glm::vec3* directions, glm::vec3* outDirections, int count);
+
+			/**
+			 * Linearly interpolates every pair of values, see lerp().
+			 * @param start values to interpolate from
+			 * @param end values to interpolate to
+			 * @param percent interpolation amount, 0 returns start, 1 returns end
+			 * @param outValues the interpolated values
+			 * @param count number of values
+			 */
+			NAPAPI void lerp(const float* start, const float* end, float percent, float* outValues, int count);
+
+			/**
+			 * Moves every value towards its target, see smoothDamp(). Every value has its own velocity.
+			 * @param currentValues the values to update
+			 * @param targetValues the values to move towards
+			 * @param velocities the velocity of every value, updated in place
+			 * @param count number of values
+			 * @param deltaTime time in seconds since the last update
+			 * @param smoothTime approximately the time it will take to reach the target
+			 * @param maxSpeed the maximum speed of every value
+			 */
+			NAPAPI void smoothDamp(float* currentValues, const float* targetValues, float* velocities, int count, float deltaTime, float smoothTime, float maxSpeed = 1000.0f);
+
+			/**
+			 * Samples a waveform at every point in time, see waveform().
+			 * @param type the waveform to sample
+			 * @param times points in time to sample the waveform at
+			 * @param frequency the waveform frequency
+			 * @param outValues the normalized (0-1) waveform values
+			 * @param count number of values
+			 */
+			NAPAPI void waveform(EWaveform type, const float* times, float frequency, float* outValues, int count);
+
+			/**
+			 * Evaluates an easing function for every point in time, ie: ease(&Cubic::easeInOut<float>, ...).
+			 * The loop is compiled for the given function, polynomial easing functions are vectorized by the compiler.
+			 * @param function the easing function to evaluate
+			 * @param times points in time to evaluate the function at
+			 * @param outValues the eased values
+			 * @param count number of values
+			 * @param begin start value
+			 * @param change change in value over the duration
+			 * @param duration the duration of the ease
+			 */
+			template<typename T, typename Function>
+			void ease(Function function, const T* times, T* outValues, int count, T begin, T change, T duration);
+		}
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+// Template Definitions
+//////////////////////////////////////////////////////////////////////////
+
+template<typename T, typename Function>
+void nap::math::batch::ease(Function function, const T* times, T* outValues, int count, T begin, T change, T duration)
+{
+	for (int i = 0; i < count; i++)
+		outValues[i] = function(times[i], begin, change, duration);
+}
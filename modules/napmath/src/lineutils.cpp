@@ -9,6 +9,7 @@
 #include <assert.h>
 #include <glm/detail/func_common.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
 
 namespace nap
 {
@@ -118,4 +119,117 @@ namespace nap
 		assert(!(glm::isnan(outNormal).z));
 	}
 
-}
\ No newline at end of file
+
+	float math::getDistancesAlongLine(const std::vector<glm::vec3>& vertexPositions, std::vector<float>& outDistances, bool closed)
+	{
+		int vert_count = static_cast<int>(vertexPositions.size());
+		assert(vert_count > 1);
+		outDistances.resize(closed ? vert_count + 1 : vert_count);
+
+		float total_distance(0.0f);
+		outDistances[0] = 0.0f;
+		for (int i = 1; i < vert_count; i++)
+		{
+			total_distance += glm::length(vertexPositions[i] - vertexPositions[i - 1]);
+			outDistances[i] = total_distance;
+		}
+
+		// Add extra distance point when dealing with closed shapes
+		if (closed)
+		{
+			total_distance += glm::length(vertexPositions.back() - vertexPositions.front());
+			outDistances[vert_count] = total_distance;
+		}
+		return total_distance;
+	}
+
+
+	/**
+	 * Creates a line sample for the given upper bound entry in the distance table
+	 */
+	static math::LineSample createLineSample(const std::vector<float>& distances, int vertexCount, int upperEntry, float sampleDistance)
+	{
+		math::LineSample sample;
+		if (upperEntry == 0)
+			return sample;
+
+		// Coinciding vertices share the same distance, the lower bound is always the entry before the first match
+		float lower_distance = distances[upperEntry - 1];
+		float range = distances[upperEntry] - lower_distance;
+		sample.mMinVertex = (upperEntry - 1) % vertexCount;
+		sample.mMaxVertex = upperEntry % vertexCount;
+		sample.mLerpValue = range > 0.0f ? math::clamp<float>((sampleDistance - lower_distance) / range, 0.0f, 1.0f) : 1.0f;
+		return sample;
+	}
+
+
+	math::LineSample math::getVertexLerpValue(const std::vector<float>& distances, int vertexCount, float location)
+	{
+		assert(location <= 1.0f && location >= 0.0f);
+		assert(!distances.empty());
+
+		float sample_distance = distances.back() * location;
+		auto upper_it = std::lower_bound(distances.begin(), distances.end(), sample_distance);
+		int upper_entry = math::min<int>(static_cast<int>(upper_it - distances.begin()), static_cast<int>(distances.size()) - 1);
+		return createLineSample(distances, vertexCount, upper_entry, sample_distance);
+	}
+
+
+	void math::getVertexLerpValues(const std::vector<float>& distances, int vertexCount, const float* locations, int count, LineSample* outSamples)
+	{
+		assert(!distances.empty());
+		const float total_distance = distances.back();
+		const int last_entry = static_cast<int>(distances.size()) - 1;
+
+		int entry = 0;
+		float previous_location = 0.0f;
+		for (int i = 0; i < count; i++)
+		{
+			float location = locations[i];
+			assert(location <= 1.0f && location >= 0.0f);
+			float sample_distance = total_distance * location;
+
+			// Walk forward from the previous entry when sampling in order, otherwise search
+			if (location >= previous_location)
+			{
+				while (entry < last_entry && distances[entry] < sample_distance)
+					entry++;
+			}
+			else
+			{
+				auto upper_it = std::lower_bound(distances.begin(), distances.end(), sample_distance);
+				entry = math::min<int>(static_cast<int>(upper_it - distances.begin()), last_entry);
+			}
+			previous_location = location;
+			outSamples[i] = createLineSample(distances, vertexCount, entry, sample_distance);
+		}
+	}
+
+
+	void math::getNormalsAlongLine(const LineSample* samples, int count, const std::vector<glm::vec3>& vertexNormals, glm::vec3* outNormals)
+	{
+		const glm::vec3* data = vertexNormals.data();
+		for (int i = 0; i < count; i++)
+		{
+			const LineSample& sample = samples[i];
+
+			// Make sure the normal has some length to it, otherwise the result is NAN
+			assert(glm::length(data[sample.mMinVertex]) >= nap::math::epsilon<float>());
+			assert(glm::length(data[sample.mMaxVertex]) >= nap::math::epsilon<float>());
+			glm::vec3 n_lower_value = glm::normalize(data[sample.mMinVertex]);
+			glm::vec3 n_upper_value = glm::normalize(data[sample.mMaxVertex]);
+
+			// Rotate from the lower to the upper normal, equal to a spherical interpolation of the two.
+			// Fall back to the lower normal when both normals (nearly) coincide.
+			float angle = glm::acos(glm::clamp<float>(glm::dot(n_lower_value, n_upper_value), -1.0f, 1.0f));
+			float sin_angle = glm::sin(angle);
+			if (sin_angle <= nap::math::epsilon<float>())
+			{
+				outNormals[i] = n_lower_value;
+				continue;
+			}
+			float t = sample.mLerpValue;
+			outNormals[i] = (n_lower_value * glm::sin((1.0f - t) * angle) + n_upper_value * glm::sin(t * angle)) / sin_angle;
+		}
+	}
+}
@@ -16,6 +16,17 @@ namespace nap
 {
 	namespace math
 	{
+		/**
+		 * Sample location on a line, expressed as a blend between two vertices.
+		 * Acquired using getVertexLerpValues() and used to interpolate any vertex attribute at that location.
+		 */
+		struct LineSample
+		{
+			int		mMinVertex = 0;			///< Lower bound vertex index
+			int		mMaxVertex = 0;			///< Upper bound vertex index
+			float	mLerpValue = 0.0f;		///< Blend value in between the lower and upper bound vertex, 0-1
+		};
+
 		/**
 		* Returns an interpolated value along the line based on the given location
 		* Note that this function works best with equally distributed vertices, ie: segments of equal length. 
@@ -84,6 +95,62 @@ namespace nap
 		 */
 		void NAPAPI getNormalAlongLine(const std::map<float, int>& distanceMap, const std::vector<glm::vec3>& vertexNormals, float location, glm::vec3& outNormal);
 
+		/**
+		 * Utility function to retrieve distances along a line as a flat table.
+		 * The table holds the accumulated distance for every vertex, in order. Closed lines
+		 * have one additional entry that holds the distance back to the first vertex, 
+		 * entry i therefore always refers to vertex: i % vertex count.
+		 * Contrary to the map based getDistancesAlongLine() the table is contiguous in memory
+		 * and can be re-used without allocating, which makes it considerably faster to build and sample.
+		 * @param vertexPositions the vertex position data
+		 * @param outDistances the accumulated distance for every vertex of the line
+		 * @param closed if the line is closed or not
+		 * @return the total length of the line
+		 */
+		float NAPAPI getDistancesAlongLine(const std::vector<glm::vec3>& vertexPositions, std::vector<float>& outDistances, bool closed);
+
+		/**
+		 * Utility function that returns a normalized blend value between two line vertices based on a position along the line.
+		 * Performs a binary search in the distance table.
+		 * @param distances the distance table that can be acquired using getDistancesAlongLine()
+		 * @param vertexCount the number of line vertices
+		 * @param location parametric normalized location along the spline, this value needs to be within the 0-1 range
+		 * @return the lower and upper bound vertex and the blend value in between
+		 */
+		LineSample NAPAPI getVertexLerpValue(const std::vector<float>& distances, int vertexCount, float location);
+
+		/**
+		 * Utility function that resolves many sample locations along a line at once.
+		 * When the locations are in ascending order the table is traversed only once,
+		 * otherwise every location falls back to a binary search.
+		 * @param distances the distance table that can be acquired using getDistancesAlongLine()
+		 * @param vertexCount the number of line vertices
+		 * @param locations parametric normalized locations along the spline, every value needs to be within the 0-1 range
+		 * @param count number of locations
+		 * @param outSamples the resolved samples, must be able to hold 'count' samples
+		 */
+		void NAPAPI getVertexLerpValues(const std::vector<float>& distances, int vertexCount, const float* locations, int count, LineSample* outSamples);
+
+		/**
+		 * Utility function that interpolates a vertex attribute for a set of resolved line samples.
+		 * @param samples the line samples, acquired using getVertexLerpValues()
+		 * @param count number of samples
+		 * @param vertexData the polyline attribute to sample
+		 * @param outValues the interpolated values, must be able to hold 'count' values
+		 */
+		template<typename T>
+		void getValuesAlongLine(const LineSample* samples, int count, const std::vector<T>& vertexData, T* outValues);
+
+		/**
+		 * Utility function that interpolates (rotates) line normals for a set of resolved line samples.
+		 * Produces the same result as getNormalAlongLine(), without constructing a rotation matrix per sample.
+		 * @param samples the line samples, acquired using getVertexLerpValues()
+		 * @param count number of samples
+		 * @param vertexNormals the normal data associated with a line
+		 * @param outNormals the interpolated normals, must be able to hold 'count' values
+		 */
+		void NAPAPI getNormalsAlongLine(const LineSample* samples, int count, const std::vector<glm::vec3>& vertexNormals, glm::vec3* outNormals);
+
 
 		//////////////////////////////////////////////////////////////////////////
 		// Template definitions
@@ -186,5 +253,19 @@ namespace nap
 
 			outValue = math::lerp<T>(lower_value, upper_value, lerp_v);
 		}
+
+
+		template<typename T>
+		void getValuesAlongLine(const LineSample* samples, int count, const std::vector<T>& vertexData, T* outValues)
+		{
+			const T* data = vertexData.data();
+			for (int i = 0; i < count; i++)
+			{
+				const LineSample& sample = samples[i];
+				const T& lower_value = data[sample.mMinVertex];
+				const T& upper_value = data[sample.mMaxVertex];
+				outValues[i] = lower_value + (upper_value - lower_value) * sample.mLerpValue;
+			}
+		}
 	}
 }
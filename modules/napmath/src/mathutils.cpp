@@ -4,6 +4,7 @@
 
 // Local Includes
 #include "mathutils.h"
+#include "randomgenerator.h"
 
 // External Inlcudes
 #include <memory>
@@ -25,30 +26,15 @@ namespace nap
 		}
 
 
-		static std::mt19937& getGenerator()
-		{
-			static std::unique_ptr<std::mt19937> generator = nullptr;
-			if (generator == nullptr)
-			{
-				std::random_device r;
-				generator = std::make_unique<std::mt19937>(r());
-				generator->seed(time(0));
-			}
-			return *generator;
-		}
-
-
 		static int randomInt(int min, int max)
 		{
-			std::uniform_int_distribution<int> m_distribution(min, max);
-			return m_distribution(getGenerator());
+			return getRandomGenerator().uniform(min, max);
 		}
 
 
 		static float randomFloat(float min, float max)
 		{
-			std::uniform_real_distribution<float> m_distribution(min, max);
-			return m_distribution(getGenerator());
+			return getRandomGenerator().uniform(min, max);
 		}
 
 
@@ -366,12 +352,6 @@ namespace nap
 		}
 
 
-		void setRandomSeed(int value)
-		{
-			std::mt19937& generator = getGenerator();
-			generator.seed(value);
-		}
-
 		template<>
 		float abs(float value)
 		{
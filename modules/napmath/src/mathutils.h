@@ -152,6 +152,8 @@ namespace nap
 		/**
 		 * Returns a random number of type T in the range of the given min / max value.
 		 * Note that the random number is based on the seed set by setRandomSeed.
+		 * Uses the random generator of the calling thread, see getRandomGenerator(), and is therefore thread safe.
+		 * Use the fill functions of the generator to create many random numbers at once.
 		 * @return a random number in range min / max. 
 		 * @param min min random number
 		 * @param max max random number
@@ -162,6 +164,7 @@ namespace nap
 
 		/**
 		 * Sets the seed for all subsequent random calls.
+		 * The random generator of every thread restarts at its own sequence for this seed on its next call.
 		 * @param value the new seed value
 		 */
 		void NAPAPI setRandomSeed(int value);
@@ -0,0 +1,296 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "randomgenerator.h"
+#include "mathutils.h"
+
+// External Includes
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <ctime>
+#include <random>
+
+namespace nap
+{
+	namespace math
+	{
+		// Number of values converted at once by the fill functions
+		static constexpr int blockSize = 256;
+
+
+		/**
+		 * Advances the splitmix64 state and returns the next value, used to expand a seed into generator state
+		 */
+		static uint64 splitMix(uint64& state)
+		{
+			uint64 z = (state += 0x9e3779b97f4a7c15ull);
+			z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+			z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+			return z ^ (z >> 31);
+		}
+
+
+		static inline uint32 rotate(uint32 value, int count)
+		{
+			return (value << count) | (value >> (32 - count));
+		}
+
+
+		/**
+		 * Converts a pair of random values into a pair of normally distributed values (Box-Muller)
+		 */
+		static inline void toNormal(uint32 a, uint32 b, float& outFirst, float& outSecond)
+		{
+			// The first value is in the range 0 (exclusive) - 1 (inclusive) to avoid log(0)
+			float u1 = static_cast<float>((a >> 8) + 1) * (1.0f / 16777216.0f);
+			float u2 = static_cast<float>(b >> 8) * (1.0f / 16777216.0f);
+			float radius = std::sqrt(-2.0f * std::log(u1));
+			float angle = 2.0f * static_cast<float>(M_PI) * u2;
+			outFirst = radius * std::cos(angle);
+			outSecond = radius * std::sin(angle);
+		}
+
+
+		RandomGenerator::RandomGenerator(uint64 seed, uint64 stream)
+		{
+			this->seed(seed, stream);
+		}
+
+
+		void RandomGenerator::seed(uint64 seed, uint64 stream)
+		{
+			// Every stream starts at a different splitmix position, which is scrambled before it is used
+			uint64 state = seed + stream * 0xd1b54a32d192ed03ull;
+			for (int lane = 0; lane < laneCount; lane++)
+			{
+				uint64 first = splitMix(state);
+				uint64 second = splitMix(state);
+				mState[0][lane] = static_cast<uint32>(first);
+				mState[1][lane] = static_cast<uint32>(first >> 32);
+				mState[2][lane] = static_cast<uint32>(second);
+				mState[3][lane] = static_cast<uint32>(second >> 32);
+			}
+			mIndex = laneCount;
+			mHasSpareNormal = false;
+		}
+
+
+		void RandomGenerator::step(uint32* output)
+		{
+			// Written per word over all lanes, which the compiler turns into vector instructions
+			for (int lane = 0; lane < laneCount; lane++)
+				output[lane] = mState[0][lane] + mState[3][lane];
+
+			for (int lane = 0; lane < laneCount; lane++)
+			{
+				uint32 t = mState[1][lane] << 9;
+				mState[2][lane] ^= mState[0][lane];
+				mState[3][lane] ^= mState[1][lane];
+				mState[1][lane] ^= mState[2][lane];
+				mState[0][lane] ^= mState[3][lane];
+				mState[2][lane] ^= t;
+				mState[3][lane] = rotate(mState[3][lane], 11);
+			}
+		}
+
+
+		int RandomGenerator::uniform(int min, int max)
+		{
+			if (max <= min)
+				return min;
+
+			// Multiply and shift to map onto the range, values that would introduce a bias are rejected (Lemire)
+			uint64 range = static_cast<uint64>(static_cast<int64>(max) - min) + 1;
+			if (range > 0xffffffffull)
+				return static_cast<int>(next());
+
+			uint64 m = static_cast<uint64>(next()) * range;
+			if (static_cast<uint32>(m) < range)
+			{
+				uint32 threshold = static_cast<uint32>(0x100000000ull - range) % static_cast<uint32>(range);
+				while (static_cast<uint32>(m) < threshold)
+					m = static_cast<uint64>(next()) * range;
+			}
+			return static_cast<int>(min + static_cast<int64>(m >> 32));
+		}
+
+
+		glm::vec2 RandomGenerator::uniform(const glm::vec2& min, const glm::vec2& max)
+		{
+			return { uniform(min.x, max.x), uniform(min.y, max.y) };
+		}
+
+
+		glm::vec3 RandomGenerator::uniform(const glm::vec3& min, const glm::vec3& max)
+		{
+			return { uniform(min.x, max.x), uniform(min.y, max.y), uniform(min.z, max.z) };
+		}
+
+
+		glm::vec4 RandomGenerator::uniform(const glm::vec4& min, const glm::vec4& max)
+		{
+			return { uniform(min.x, max.x), uniform(min.y, max.y), uniform(min.z, max.z), uniform(min.w, max.w) };
+		}
+
+
+		float RandomGenerator::normal(float mean, float deviation)
+		{
+			// Values are generated in pairs, the second one is kept for the next call
+			if (mHasSpareNormal)
+			{
+				mHasSpareNormal = false;
+				return mean + deviation * mSpareNormal;
+			}
+
+			float value;
+			uint32 a = next();
+			toNormal(a, next(), value, mSpareNormal);
+			mHasSpareNormal = true;
+			return mean + deviation * value;
+		}
+
+
+		void RandomGenerator::fill(uint32* output, int count)
+		{
+			// The state is kept in local arrays for the duration of the loop, so it can live in vector registers
+			uint32 s0[laneCount], s1[laneCount], s2[laneCount], s3[laneCount];
+			std::copy(mState[0], mState[0] + laneCount, s0);
+			std::copy(mState[1], mState[1] + laneCount, s1);
+			std::copy(mState[2], mState[2] + laneCount, s2);
+			std::copy(mState[3], mState[3] + laneCount, s3);
+
+			int steps = count / laneCount;
+			for (int i = 0; i < steps; i++)
+			{
+				uint32* step_output = output + i * laneCount;
+				for (int lane = 0; lane < laneCount; lane++)
+				{
+					step_output[lane] = s0[lane] + s3[lane];
+					uint32 t = s1[lane] << 9;
+					s2[lane] ^= s0[lane];
+					s3[lane] ^= s1[lane];
+					s1[lane] ^= s2[lane];
+					s0[lane] ^= s3[lane];
+					s2[lane] ^= t;
+					s3[lane] = rotate(s3[lane], 11);
+				}
+			}
+
+			std::copy(s0, s0 + laneCount, mState[0]);
+			std::copy(s1, s1 + laneCount, mState[1]);
+			std::copy(s2, s2 + laneCount, mState[2]);
+			std::copy(s3, s3 + laneCount, mState[3]);
+
+			for (int i = steps * laneCount; i < count; i++)
+				output[i] = next();
+		}
+
+
+		void RandomGenerator::fill(float* output, int count, float min, float max)
+		{
+			uint32 block[blockSize];
+			float extent = max - min;
+			for (int i = 0; i < count; i += blockSize)
+			{
+				int block_count = std::min<int>(blockSize, count - i);
+				fill(block, block_count);
+				for (int j = 0; j < block_count; j++)
+					output[i + j] = min + extent * toFloat(block[j]);
+			}
+		}
+
+
+		void RandomGenerator::fill(glm::vec2* output, int count, const glm::vec2& min, const glm::vec2& max)
+		{
+			uint32 block[blockSize * 2];
+			glm::vec2 extent = max - min;
+			for (int i = 0; i < count; i += blockSize)
+			{
+				int block_count = std::min<int>(blockSize, count - i);
+				fill(block, block_count * 2);
+				for (int j = 0; j < block_count; j++)
+					output[i + j] = min + extent * glm::vec2(toFloat(block[j * 2]), toFloat(block[j * 2 + 1]));
+			}
+		}
+
+
+		void RandomGenerator::fill(glm::vec3* output, int count, const glm::vec3& min, const glm::vec3& max)
+		{
+			uint32 block[blockSize * 3];
+			glm::vec3 extent = max - min;
+			for (int i = 0; i < count; i += blockSize)
+			{
+				int block_count = std::min<int>(blockSize, count - i);
+				fill(block, block_count * 3);
+				for (int j = 0; j < block_count; j++)
+					output[i + j] = min + extent * glm::vec3(toFloat(block[j * 3]), toFloat(block[j * 3 + 1]), toFloat(block[j * 3 + 2]));
+			}
+		}
+
+
+		void RandomGenerator::fillNormal(float* output, int count, float mean, float deviation)
+		{
+			// Every pair of random values results in a pair of normal values
+			uint32 block[blockSize];
+			for (int i = 0; i < count; i += blockSize)
+			{
+				int block_count = std::min<int>(blockSize, count - i);
+				int pair_count = (block_count + 1) / 2;
+				fill(block, pair_count * 2);
+				for (int j = 0; j < pair_count; j++)
+				{
+					float first, second;
+					toNormal(block[j * 2], block[j * 2 + 1], first, second);
+					output[i + j * 2] = mean + deviation * first;
+					if (j * 2 + 1 < block_count)
+						output[i + j * 2 + 1] = mean + deviation * second;
+				}
+			}
+		}
+
+
+		//////////////////////////////////////////////////////////////////////////
+		// Thread generators
+		//////////////////////////////////////////////////////////////////////////
+
+		static uint64 createInitialSeed()
+		{
+			std::random_device device;
+			return (static_cast<uint64>(device()) << 32) ^ static_cast<uint64>(time(0));
+		}
+
+		// Seed of all thread generators, the version is incremented when the seed changes
+		static std::atomic<uint64> randomSeed = { createInitialSeed() };
+		static std::atomic<uint32> randomSeedVersion = { 1 };
+
+		// Stream assigned to the next thread that requests its generator
+		static std::atomic<uint64> nextThreadStream = { 0 };
+
+
+		RandomGenerator& getRandomGenerator()
+		{
+			thread_local RandomGenerator generator;
+			thread_local uint64 stream = nextThreadStream++;
+			thread_local uint32 version = 0;
+
+			// Reseed when the seed changed since the last call on this thread
+			uint32 current_version = randomSeedVersion.load(std::memory_order_acquire);
+			if (version != current_version)
+			{
+				generator.seed(randomSeed.load(std::memory_order_relaxed), stream);
+				version = current_version;
+			}
+			return generator;
+		}
+
+
+		void setRandomSeed(int value)
+		{
+			randomSeed.store(static_cast<uint64>(static_cast<uint32>(value)), std::memory_order_relaxed);
+			randomSeedVersion.fetch_add(1, std::memory_order_release);
+		}
+	}
+}
@@ -0,0 +1,162 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// External Includes
+#include <nap/numeric.h>
+#include <utility/dllexport.h>
+#include <glm/glm.hpp>
+
+namespace nap
+{
+	namespace math
+	{
+		/**
+		 * Fast, seedable pseudo random number generator.
+		 * Runs 4 independent xoshiro128+ generators (lanes) side by side. Every step produces one number per lane,
+		 * the lanes are stored interleaved so the compiler can advance all lanes using SIMD instructions.
+		 * Single numbers are handed out from the last step, the fill() functions write complete steps directly to the output.
+		 *
+		 * A generator is not thread safe: use getRandomGenerator() to get the generator of the calling thread,
+		 * or create a generator per task for results that do not depend on the thread a task runs on.
+		 * The same seed and stream always produce the same sequence, which allows for replaying random behaviour.
+		 */
+		class NAPAPI RandomGenerator final
+		{
+		public:
+			// Number of generators that run side by side
+			static constexpr int laneCount = 4;
+
+			/**
+			 * Creates and seeds the generator.
+			 * @param seed the seed
+			 * @param stream selects an independent sequence for the same seed, ie: a task or thread index
+			 */
+			RandomGenerator(uint64 seed = 0, uint64 stream = 0);
+
+			/**
+			 * Restarts the generator at the sequence of the given seed and stream.
+			 * @param seed the seed
+			 * @param stream selects an independent sequence for the same seed, ie: a task or thread index
+			 */
+			void seed(uint64 seed, uint64 stream = 0);
+
+			/**
+			 * @return the next random 32 bit value
+			 */
+			uint32 next()
+			{
+				if (mIndex == laneCount)
+				{
+					step(mBuffer);
+					mIndex = 0;
+				}
+				return mBuffer[mIndex++];
+			}
+
+			/**
+			 * @return random float in the range 0 (inclusive) - 1 (exclusive)
+			 */
+			float nextFloat()													{ return toFloat(next()); }
+
+			/**
+			 * @return random integer in the range min - max, both inclusive
+			 */
+			int uniform(int min, int max);
+
+			/**
+			 * @return random float in the range min (inclusive) - max (exclusive)
+			 */
+			float uniform(float min, float max)									{ return min + (max - min) * nextFloat(); }
+
+			/**
+			 * @return random vector, every component is in the range min (inclusive) - max (exclusive)
+			 */
+			glm::vec2 uniform(const glm::vec2& min, const glm::vec2& max);
+
+			/**
+			 * @return random vector, every component is in the range min (inclusive) - max (exclusive)
+			 */
+			glm::vec3 uniform(const glm::vec3& min, const glm::vec3& max);
+
+			/**
+			 * @return random vector, every component is in the range min (inclusive) - max (exclusive)
+			 */
+			glm::vec4 uniform(const glm::vec4& min, const glm::vec4& max);
+
+			/**
+			 * @return normally distributed random float
+			 * @param mean mean of the distribution
+			 * @param deviation standard deviation of the distribution
+			 */
+			float normal(float mean = 0.0f, float deviation = 1.0f);
+
+			/**
+			 * Fills a buffer with random 32 bit values.
+			 * @param output the buffer to fill
+			 * @param count number of values to generate
+			 */
+			void fill(uint32* output, int count);
+
+			/**
+			 * Fills a buffer with random floats in the range min (inclusive) - max (exclusive).
+			 * @param output the buffer to fill
+			 * @param count number of values to generate
+			 * @param min lower bound
+			 * @param max upper bound
+			 */
+			void fill(float* output, int count, float min = 0.0f, float max = 1.0f);
+
+			/**
+			 * Fills a buffer with random vectors, every component is in the range min (inclusive) - max (exclusive).
+			 * @param output the buffer to fill
+			 * @param count number of vectors to generate
+			 * @param min lower bound of every component
+			 * @param max upper bound of every component
+			 */
+			void fill(glm::vec2* output, int count, const glm::vec2& min, const glm::vec2& max);
+
+			/**
+			 * Fills a buffer with random vectors, every component is in the range min (inclusive) - max (exclusive).
+			 * @param output the buffer to fill
+			 * @param count number of vectors to generate
+			 * @param min lower bound of every component
+			 * @param max upper bound of every component
+			 */
+			void fill(glm::vec3* output, int count, const glm::vec3& min, const glm::vec3& max);
+
+			/**
+			 * Fills a buffer with normally distributed random floats.
+			 * @param output the buffer to fill
+			 * @param count number of values to generate
+			 * @param mean mean of the distribution
+			 * @param deviation standard deviation of the distribution
+			 */
+			void fillNormal(float* output, int count, float mean = 0.0f, float deviation = 1.0f);
+
+		private:
+			// Advances all lanes and writes one value per lane
+			void step(uint32* output);
+
+			// Converts the upper 24 bits into a float in the range 0 (inclusive) - 1 (exclusive)
+			static float toFloat(uint32 value)									{ return static_cast<float>(value >> 8) * (1.0f / 16777216.0f); }
+
+			uint32 mState[4][laneCount];		///< State words of all lanes, interleaved per word
+			uint32 mBuffer[laneCount];			///< Values of the last step
+			int mIndex = laneCount;				///< Next value in the buffer to hand out
+			float mSpareNormal = 0.0f;			///< Second value of the last normal pair
+			bool mHasSpareNormal = false;		///< If the spare normal is available
+		};
+
+
+		/**
+		 * Returns the random generator of the calling thread. Every thread has its own generator, no locking is required.
+		 * All generators derive their sequence from the seed set using setRandomSeed(). The stream of a thread is
+		 * assigned on first use, use a RandomGenerator per task when results on worker threads need to be reproducible.
+		 * @return the random generator of the calling thread
+		 */
+		NAPAPI RandomGenerator& getRandomGenerator();
+	}
+}
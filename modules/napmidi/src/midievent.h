@@ -5,6 +5,7 @@
 #pragma once
 
 #include <nap/event.h>
+#include <nap/datetime.h>
 
 namespace nap
 {
@@ -77,6 +78,13 @@ namespace nap
         MidiValue getProgramNumber() const	{ return mNumber; }		/**< If a program change event, this returns the program number */
         MidiValue getChannel() const		{ return mChannel; }    /**< The midi channel this event is emitted on */
         std::string getPort() const			{ return mPort; }       /**< the mID of the port object through which the message is received, not to be confused with the physical portname */
+        const HighResTimeStamp& getTimeStamp() const { return mTimeStamp; } /**< Time the message was received on the midi input thread */
+
+        /**
+         * Sets the time the message was received, called by the midi input port
+         * @param timeStamp the time the message was received
+         */
+        void setTimeStamp(const HighResTimeStamp& timeStamp) { mTimeStamp = timeStamp; }
         
         /**
          * Returns the contents of the event as a formatted text string for logging
@@ -94,6 +102,7 @@ namespace nap
         MidiValue mValue = MIDI_VALUE_OMNI;     /**< this is the velocity or the cc value */
         MidiValue mChannel = MIDI_CHANNEL_OMNI; /**< the midi channel through which this message is emitted */
         std::string mPort = "";                 /**< the mID of the port object through which the message is emitted */
+        HighResTimeStamp mTimeStamp;            /**< the time the message was received */
     };
     
 }
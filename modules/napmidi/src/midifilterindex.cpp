@@ -0,0 +1,121 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "midifilterindex.h"
+#include "midiinputcomponent.h"
+
+// Std includes
+#include <algorithm>
+
+namespace nap
+{
+    constexpr int MidiFilterIndex::channelCount;
+    constexpr int MidiFilterIndex::numberCount;
+
+
+    MidiFilterIndex::MidiFilterIndex()
+    {
+        // One additional channel and number for omni
+        mBuckets.resize((channelCount + 1) * (numberCount + 1));
+    }
+
+
+    void MidiFilterIndex::add(MidiInputComponentInstance& component)
+    {
+        // Re-adding a component updates its buckets
+        if (std::find(mComponents.begin(), mComponents.end(), &component) == mComponents.end())
+            mComponents.emplace_back(&component);
+        else
+            removeFromBuckets(component);
+
+        // An empty filter listens to all values
+        static const std::vector<MidiValue> omni = { MidiEvent::MIDI_VALUE_OMNI };
+        const auto& channels = component.mChannels.empty() ? omni : component.mChannels;
+        const auto& numbers = component.mNumbers.empty() ? omni : component.mNumbers;
+
+        for (auto channel : channels)
+        {
+            for (auto number : numbers)
+            {
+                // Values out of range never match an event
+                auto bucket_index = getBucket(channel, number);
+                if (bucket_index < 0)
+                    continue;
+
+                auto& bucket = mBuckets[bucket_index];
+                if (std::find(bucket.begin(), bucket.end(), &component) == bucket.end())
+                    bucket.emplace_back(&component);
+            }
+        }
+    }
+
+
+    void MidiFilterIndex::remove(MidiInputComponentInstance& component)
+    {
+        auto it = std::find(mComponents.begin(), mComponents.end(), &component);
+        if (it == mComponents.end())
+            return;
+
+        mComponents.erase(it);
+        removeFromBuckets(component);
+    }
+
+
+    void MidiFilterIndex::find(const MidiEvent& event, std::vector<MidiInputComponentInstance*>& outComponents) const
+    {
+        outComponents.clear();
+        if (mComponents.empty())
+            return;
+
+        // A component is only stored in one of these buckets for a specific channel and number
+        const int buckets[] =
+        {
+            getBucket(event.getChannel(), event.getNumber()),
+            getBucket(event.getChannel(), MidiEvent::MIDI_NUMBER_OMNI),
+            getBucket(MidiEvent::MIDI_CHANNEL_OMNI, event.getNumber()),
+            getBucket(MidiEvent::MIDI_CHANNEL_OMNI, MidiEvent::MIDI_NUMBER_OMNI)
+        };
+
+        for (auto bucket_index : buckets)
+        {
+            if (bucket_index < 0)
+                continue;
+
+            for (auto component : mBuckets[bucket_index])
+            {
+                if (!component->mPorts.empty())
+                    if (std::find(component->mPorts.begin(), component->mPorts.end(), event.getPort()) == component->mPorts.end())
+                        continue;
+                if (!component->mTypes.empty())
+                    if (std::find(component->mTypes.begin(), component->mTypes.end(), event.getType()) == component->mTypes.end())
+                        continue;
+                outComponents.emplace_back(component);
+            }
+        }
+    }
+
+
+    int MidiFilterIndex::getBucket(MidiValue channel, MidiValue number)
+    {
+        if (channel != MidiEvent::MIDI_CHANNEL_OMNI && (channel < 0 || channel >= channelCount))
+            return -1;
+        if (number != MidiEvent::MIDI_NUMBER_OMNI && (number < 0 || number >= numberCount))
+            return -1;
+
+        int channel_index = channel == MidiEvent::MIDI_CHANNEL_OMNI ? channelCount : channel;
+        int number_index = number == MidiEvent::MIDI_NUMBER_OMNI ? numberCount : number;
+        return channel_index * (numberCount + 1) + number_index;
+    }
+
+
+    void MidiFilterIndex::removeFromBuckets(MidiInputComponentInstance& component)
+    {
+        for (auto& bucket : mBuckets)
+        {
+            auto it = std::find(bucket.begin(), bucket.end(), &component);
+            if (it != bucket.end())
+                bucket.erase(it);
+        }
+    }
+}
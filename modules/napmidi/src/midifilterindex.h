@@ -0,0 +1,69 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Midi includes
+#include "midievent.h"
+
+// Std includes
+#include <vector>
+
+namespace nap
+{
+    // Forward declarations
+    class MidiInputComponentInstance;
+
+
+    /**
+     * Index of midi input components by the channels and numbers they listen to.
+     * Every component is stored in a bucket for every channel and number combination of its filter,
+     * an empty channel or number filter is stored in the omni bucket of that value.
+     * Finding the components that listen to an event only visits the four buckets that can match the event,
+     * instead of testing every component. The port and type filters are tested on the components found.
+     * The filters of a component are read when it is added, re-add the component when its filters change.
+     */
+    class NAPAPI MidiFilterIndex final
+    {
+    public:
+        MidiFilterIndex();
+
+        /**
+         * Adds a component to the index.
+         * @param component the component to add
+         */
+        void add(MidiInputComponentInstance& component);
+
+        /**
+         * Removes a component from the index.
+         * @param component the component to remove
+         */
+        void remove(MidiInputComponentInstance& component);
+
+        /**
+         * Finds all components that listen to the given event.
+         * @param event the event to find the listening components for
+         * @param outComponents all components that listen to the event, cleared first
+         */
+        void find(const MidiEvent& event, std::vector<MidiInputComponentInstance*>& outComponents) const;
+
+        /**
+         * @return if there are no components in the index
+         */
+        bool empty() const { return mComponents.empty(); }
+
+    private:
+        static constexpr int channelCount = 16;
+        static constexpr int numberCount = MidiEvent::MIDI_MAX_VALUE + 1;
+
+        // Returns the bucket for a channel and number, omni values map to the last channel and number
+        static int getBucket(MidiValue channel, MidiValue number);
+
+        // Removes a component from all buckets it is stored in
+        void removeFromBuckets(MidiInputComponentInstance& component);
+
+        std::vector<MidiInputComponentInstance*> mComponents;               // All indexed components
+        std::vector<std::vector<MidiInputComponentInstance*>> mBuckets;     // Components per channel and number combination
+    };
+}
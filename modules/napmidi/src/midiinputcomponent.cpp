@@ -17,6 +17,7 @@ RTTI_BEGIN_CLASS(nap::MidiInputComponent)
     RTTI_PROPERTY("Channels", &nap::MidiInputComponent::mChannels, nap::rtti::EPropertyMetaData::Default)
     RTTI_PROPERTY("Numbers", &nap::MidiInputComponent::mNumbers, nap::rtti::EPropertyMetaData::Default)
     RTTI_PROPERTY("Types", &nap::MidiInputComponent::mTypes, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("Realtime", &nap::MidiInputComponent::mRealtime, nap::rtti::EPropertyMetaData::Default)
 RTTI_END_CLASS
 
 RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::MidiInputComponentInstance)
@@ -29,17 +30,18 @@ namespace nap
     
     bool MidiInputComponentInstance::init(utility::ErrorState& errorState)
     {
-        // Get service and register
-        mService = getEntityInstance()->getCore()->getService<MidiService>();
-        assert(mService != nullptr);
-        mService->registerInputComponent(*this);
-     
         // copy event filter settings
         auto resource = getComponent<MidiInputComponent>();
         mPorts = resource->mPorts;
         mChannels = resource->mChannels;
         mNumbers = resource->mNumbers;
         mTypes = resource->mTypes;
+        mRealtime = resource->mRealtime;
+
+        // Get service and register, the service indexes the component by its filter settings
+        mService = getEntityInstance()->getCore()->getService<MidiService>();
+        assert(mService != nullptr);
+        mService->registerInputComponent(*this);
         
         return true;
     }
@@ -34,11 +34,13 @@ namespace nap
         std::vector<MidiValue> mChannels;			///< Property: 'Channels' Filter specifying what midi channels to listen to. Empty means all channels. */
         std::vector<MidiValue> mNumbers;			///< Property: 'Numbers' Filter specifying what number bytes (like cc numbers) to listen to. Empty means all numbers. */
         std::vector<MidiEvent::Type> mTypes;		///< Property: 'Types' Filter specifying what event types to listen to. Empty means all types. */
+        bool mRealtime = false;						///< Property: 'Realtime' Emit messages on the midi input thread as soon as they arrive, instead of on the main thread. */
     };
 
     
     /**
      * Instance of component that filters incoming midi messages and makes them available for other components by emitting a signal.
+     * The service indexes the component by its channel and number filters on init(), changing those filters afterwards has no effect.
      */
     class NAPAPI MidiInputComponentInstance : public nap::ComponentInstance
     {
@@ -54,7 +56,10 @@ namespace nap
         virtual ~MidiInputComponentInstance();
         
         /**
-         * Signal emitted when a midi message is received that passes the filter settings
+         * Signal emitted when a midi message is received that passes the filter settings.
+         * When 'Realtime' is enabled the signal is emitted on the midi input thread, as soon as the message arrives.
+         * Use the time stamp of the event to schedule it on another thread, for example using
+         * audio::NodeManager::enqueueTask(), which applies the event at the matching position in the audio stream.
          */
         nap::Signal<const MidiEvent&> messageReceived;
         
@@ -65,6 +70,11 @@ namespace nap
         
         nap::Signal<const MidiEvent&>* getMessageReceived() { return &messageReceived; }
 
+        /**
+         * @return if messages are emitted on the midi input thread
+         */
+        bool isRealtime() const { return mRealtime; }
+
     protected:
         /**
          * This is triggered by the service when a new midi message is received
@@ -73,6 +83,7 @@ namespace nap
         
     private:
         MidiService* mService = nullptr;
+        bool mRealtime = false;
     };
     
 }
@@ -19,12 +19,13 @@ namespace nap
 {
     void midiCallback(double deltatime, std::vector<unsigned char> *message, void *userData)
     {
+        // Stamp the event on arrival, the time is used to schedule the event on other threads
         auto inputPort = static_cast<MidiInputPort*>(userData);
-        auto portNames = inputPort->getPortNames();
-        auto event = std::make_unique<MidiEvent>(*message, inputPort->mID);
+        MidiEvent event(*message, inputPort->mID);
+        event.setTimeStamp(HighResolutionClock::now());
 		if (inputPort->mDebugOutput)
 		{
-			nap::Logger::info("midi input on " + portNames + ": " + event->toString());
+			nap::Logger::info("midi input on " + inputPort->getPortNames() + ": " + event.toString());
 		}
         inputPort->receiveEvent(std::move(event));
     }
@@ -47,7 +47,7 @@ namespace nap
         /**
          * Called internally by the midi callback.
          */
-        void receiveEvent(std::unique_ptr<MidiEvent> event) { mService->enqueueEvent(std::move(event)); }
+        void receiveEvent(MidiEvent&& event) { mService->enqueueEvent(std::move(event)); }
         
         /**
          * @return: The midi port number thas this object is listening to
@@ -16,9 +16,14 @@ RTTI_END_CLASS
 
 namespace nap
 {
+	// Number of events the queue and update buffer can hold without allocating
+	static constexpr size_t eventQueueCapacity = 1024;
+
+
 	MidiService::MidiService(ServiceConfiguration* configuration) :
-		Service(configuration)
+		Service(configuration), mEventQueue(eventQueueCapacity)
 	{
+		mEvents.resize(eventQueueCapacity);
 	}
 
     bool MidiService::init(nap::utility::ErrorState& errorState)
@@ -100,25 +105,53 @@ namespace nap
     
     void MidiService::update(double deltaTime)
     {
-        std::unique_ptr<MidiEvent> event = nullptr;
-        while (mEventQueue.try_dequeue(event))
-            for (auto component : mInputComponents)
+        // Dequeue in bulk, events are moved into preallocated slots
+        size_t count = 0;
+        while ((count = mEventQueue.try_dequeue_bulk(mEvents.begin(), mEvents.size())) > 0)
+        {
+            for (size_t i = 0; i < count; ++i)
             {
-                if (!component->mPorts.empty())
-                    if (std::find(component->mPorts.begin(), component->mPorts.end(), event->getPort()) == component->mPorts.end())
-                        continue;
-                if (!component->mTypes.empty())
-                    if (std::find(component->mTypes.begin(), component->mTypes.end(), event->getType()) == component->mTypes.end())
-                        continue;
-                if (!component->mChannels.empty())
-                    if (std::find(component->mChannels.begin(), component->mChannels.end(), event->getChannel()) == component->mChannels.end())
-                        continue;
-                if (!component->mNumbers.empty())
-                    if (std::find(component->mNumbers.begin(), component->mNumbers.end(), event->getNumber()) == component->mNumbers.end())
-                        continue;
-                component->trigger(*event);
+                mInputIndex.find(mEvents[i], mComponents);
+                for (auto component : mComponents)
+                    component->trigger(mEvents[i]);
             }
+        }
     }
 
-    
+
+    void MidiService::registerInputComponent(MidiInputComponentInstance& component)
+    {
+        if (component.isRealtime())
+        {
+            std::lock_guard<std::mutex> lock(mRealtimeMutex);
+            mRealtimeIndex.add(component);
+            return;
+        }
+        mInputIndex.add(component);
+    }
+
+
+    void MidiService::unregisterInputComponent(MidiInputComponentInstance& component)
+    {
+        if (component.isRealtime())
+        {
+            std::lock_guard<std::mutex> lock(mRealtimeMutex);
+            mRealtimeIndex.remove(component);
+            return;
+        }
+        mInputIndex.remove(component);
+    }
+
+
+    void MidiService::enqueueEvent(MidiEvent&& event)
+    {
+        // Forward to realtime components on the input thread
+        {
+            std::lock_guard<std::mutex> lock(mRealtimeMutex);
+            mRealtimeIndex.find(event, mRealtimeComponents);
+            for (auto component : mRealtimeComponents)
+                component->trigger(event);
+        }
+        mEventQueue.enqueue(std::move(event));
+    }
 }
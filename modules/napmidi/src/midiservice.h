@@ -6,6 +6,7 @@
 
 // Std includes
 #include <set>
+#include <mutex>
 
 // Third party includes
 #include <RtMidi.h>
@@ -16,6 +17,7 @@
 
 // Midi includes
 #include "midievent.h"
+#include "midifilterindex.h"
 
 namespace nap {
     
@@ -93,24 +95,31 @@ namespace nap {
         void unregisterInputPort(MidiInputPort& port) { mInputPorts.erase(&port); }
         
          // Used by input component to register itself to receive incoming midi events
-        void registerInputComponent(MidiInputComponentInstance& component) { mInputComponents.emplace(&component); }
+        void registerInputComponent(MidiInputComponentInstance& component);
         
          // Used by input component to unregister itself.
-        void unregisterInputComponent(MidiInputComponentInstance& component) { mInputComponents.erase(&component); }
+        void unregisterInputComponent(MidiInputComponentInstance& component);
         
          // Used by midi input port to enqueue a freshly received midi event from the input thread.
-        void enqueueEvent(std::unique_ptr<MidiEvent> event) { mEventQueue.enqueue(std::move(event)); }
+         // Realtime components receive the event immediately, on the input thread.
+        void enqueueEvent(MidiEvent&& event);
         
         std::unique_ptr<RtMidiIn> mMidiIn = nullptr; // used to poll for available input ports
         std::unique_ptr<RtMidiOut> mMidiOut = nullptr; // used to poll available output ports.
         
         std::set<MidiInputPort*> mInputPorts; // all registered midi input ports
-        std::set<MidiInputComponentInstance*> mInputComponents; // all registered midi input components
+        MidiFilterIndex mInputIndex; // all registered midi input components that receive events on update()
+        MidiFilterIndex mRealtimeIndex; // all registered midi input components that receive events on the input thread
+        std::mutex mRealtimeMutex; // guards the realtime index, locked by the input thread for the duration of an event
+        std::vector<MidiInputComponentInstance*> mRealtimeComponents; // components found for an event on the input thread
+        std::vector<MidiInputComponentInstance*> mComponents; // components found for an event on update()
+        std::vector<MidiEvent> mEvents; // events dequeued on update()
         
         /**
          * lock-free concurrent queue to store incoming midi events before processing them on the main thread.
+         * Events are stored by value in blocks that are allocated up front, the queue only allocates when it grows beyond its initial capacity.
          */
-        moodycamel::ConcurrentQueue<std::unique_ptr<MidiEvent>> mEventQueue;
+        moodycamel::ConcurrentQueue<MidiEvent> mEventQueue;
     };
         
 }
@@ -0,0 +1,312 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "cvpipeline.h"
+
+// External Includes
+#include <mathutils.h>
+#include <cassert>
+
+// nap::cvpipeline run time class definition
+RTTI_BEGIN_CLASS(nap::CVPipeline)
+	RTTI_PROPERTY("Device",			&nap::CVPipeline::mDevice,			nap::rtti::EPropertyMetaData::Default)
+	RTTI_PROPERTY("Adapter",		&nap::CVPipeline::mAdapter,			nap::rtti::EPropertyMetaData::Default)
+	RTTI_PROPERTY("MatrixIndex",	&nap::CVPipeline::mMatrixIndex,		nap::rtti::EPropertyMetaData::Default)
+	RTTI_PROPERTY("Stages",			&nap::CVPipeline::mStages,			nap::rtti::EPropertyMetaData::Required)
+	RTTI_PROPERTY("QueueSize",		&nap::CVPipeline::mQueueSize,		nap::rtti::EPropertyMetaData::Default)
+	RTTI_PROPERTY("ThreadCount",	&nap::CVPipeline::mThreadCount,		nap::rtti::EPropertyMetaData::Default)
+RTTI_END_CLASS
+
+//////////////////////////////////////////////////////////////////////////
+
+
+namespace nap
+{
+	// Weight of a new measurement in the averaged latency
+	static constexpr float latencyWeight = 0.1f;
+
+	// Returns the time in milliseconds since the given time point
+	static float getMillisSince(const std::chrono::high_resolution_clock::time_point& time)
+	{
+		return std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - time).count();
+	}
+
+
+	bool CVPipeline::init(utility::ErrorState& errorState)
+	{
+		if (!errorState.check(!mStages.empty(), "%s: no stages", mID.c_str()))
+			return false;
+
+		if (!errorState.check(mQueueSize > 0, "%s: queue size must be at least 1", mID.c_str()))
+			return false;
+
+		// Frames are pushed manually when there is no device
+		if (mDevice == nullptr)
+			return true;
+
+		// Ensure adapter is part of capture device
+		if (!errorState.check(mAdapter != nullptr, "%s: no adapter specified", mID.c_str()))
+			return false;
+
+		if (!errorState.check(mDevice->manages(*mAdapter), "%s: adapter: %s not part of %s",
+			mID.c_str(), mAdapter->mID.c_str(), mDevice->mID.c_str()))
+			return false;
+
+		// Now ensure matrix capture is in range
+		if (!errorState.check(mMatrixIndex < mAdapter->getMatrixCount(),
+			"%s: matrix index out of range, adapter: %s has only %d matrices available", mID.c_str(),
+			mAdapter->mID.c_str(), mAdapter->getMatrixCount()))
+			return false;
+
+		return true;
+	}
+
+
+	bool CVPipeline::start(utility::ErrorState& errorState)
+	{
+		// Every stage holds at most 'QueueSize' waiting frames and 1 frame in process.
+		// One additional frame holds the result and one is filled by push(), the pool therefore never runs out.
+		int stage_count = getStageCount();
+		int frame_count = stage_count * (mQueueSize + 1) + 2;
+		mFrames.clear();
+		mFreeFrames.clear();
+		for (int i = 0; i < frame_count; i++)
+		{
+			mFrames.emplace_back(std::make_unique<CVPipelineFrame>());
+			mFreeFrames.emplace_back(mFrames.back().get());
+		}
+
+		mStageStates.clear();
+		for (int i = 0; i < stage_count; i++)
+			mStageStates.emplace_back(std::make_unique<StageState>());
+
+		mResult = nullptr;
+		mNewResult = false;
+		mFrameNumber = 0;
+		mLatency = 0.0f;
+		mProcessedCount = 0;
+		mDroppedCount = 0;
+
+		// Create thread pool, at most one task per stage is queued
+		int thread_count = mThreadCount > 0 ? mThreadCount : stage_count;
+		mThreadPool = std::make_unique<ThreadPool>(thread_count, stage_count + 1);
+		mRunning = true;
+
+		// Start receiving frames
+		if (mDevice != nullptr)
+			mDevice->frameCaptured.connect(mCaptureSlot);
+		return true;
+	}
+
+
+	void CVPipeline::stop()
+	{
+		// Stop receiving frames
+		if (mDevice != nullptr)
+			mDevice->frameCaptured.disconnect(mCaptureSlot);
+
+		// Wait for all stages to finish
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			mRunning = false;
+			mIdleCondition.wait(lock, [this]()
+			{
+				return mScheduledCount == 0;
+			});
+
+			// Return all waiting frames to the pool
+			for (auto& state : mStageStates)
+			{
+				for (CVPipelineFrame* frame : state->mQueue)
+					releaseFrame(frame);
+				state->mQueue.clear();
+			}
+		}
+
+		if (mThreadPool != nullptr)
+		{
+			mThreadPool->shutDown();
+			mThreadPool.reset();
+		}
+	}
+
+
+	void CVPipeline::push(const cv::UMat& matrix)
+	{
+		// Take a frame from the pool
+		CVPipelineFrame* frame = nullptr;
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			if (!mRunning)
+				return;
+
+			frame = acquireFrame();
+			if (frame == nullptr)
+			{
+				mDroppedCount++;
+				return;
+			}
+			frame->mNumber = mFrameNumber++;
+		}
+
+		// Copy content outside of lock, the matrix allocation of the frame is reused
+		matrix.copyTo(frame->getOutput());
+		frame->swap();
+		frame->mScale = 1.0f;
+		frame->mObjects.clear();
+		frame->mContours.clear();
+		frame->mTime = std::chrono::high_resolution_clock::now();
+
+		std::lock_guard<std::mutex> lock(mMutex);
+		if (!mRunning)
+		{
+			releaseFrame(frame);
+			return;
+		}
+		enqueue(0, frame);
+	}
+
+
+	std::vector<math::Rect> CVPipeline::getObjects() const
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mResult != nullptr ? mResult->mObjects : std::vector<math::Rect>();
+	}
+
+
+	bool CVPipeline::getFrame(cv::UMat& outMatrix)
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		if (!mNewResult || mResult == nullptr)
+			return false;
+
+		mResult->getInput().copyTo(outMatrix);
+		mNewResult = false;
+		return true;
+	}
+
+
+	float CVPipeline::getStageLatency(int index) const
+	{
+		assert(index < getStageCount());
+		return mStageStates[index]->mLatency.load();
+	}
+
+
+	void CVPipeline::onFrameCaptured(const CVFrameEvent& frameEvent)
+	{
+		const CVFrame* frame = frameEvent.findFrame(*mAdapter);
+		if (frame == nullptr)
+			return;
+		push((*frame)[mMatrixIndex]);
+	}
+
+
+	CVPipelineFrame* CVPipeline::acquireFrame()
+	{
+		if (mFreeFrames.empty())
+			return nullptr;
+
+		CVPipelineFrame* frame = mFreeFrames.back();
+		mFreeFrames.pop_back();
+		return frame;
+	}
+
+
+	void CVPipeline::releaseFrame(CVPipelineFrame* frame)
+	{
+		mFreeFrames.emplace_back(frame);
+	}
+
+
+	void CVPipeline::enqueue(int stage, CVPipelineFrame* frame)
+	{
+		// Drop the oldest frame when the queue is full
+		StageState& state = *mStageStates[stage];
+		if (state.mQueue.size() >= static_cast<size_t>(mQueueSize))
+		{
+			releaseFrame(state.mQueue.front());
+			state.mQueue.pop_front();
+			mDroppedCount++;
+		}
+		state.mQueue.emplace_back(frame);
+
+		// Schedule stage if not running already
+		if (!state.mScheduled)
+		{
+			state.mScheduled = true;
+			mScheduledCount++;
+			mThreadPool->execute([this, stage]()
+			{
+				processStage(stage);
+			});
+		}
+	}
+
+
+	void CVPipeline::processStage(int stage)
+	{
+		StageState& state = *mStageStates[stage];
+		CVPipelineStage& pipeline_stage = *mStages[stage];
+		bool last = stage == getStageCount() - 1;
+
+		while (true)
+		{
+			// Fetch next frame, stop when there are no more frames to process
+			CVPipelineFrame* frame = nullptr;
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+				if (!mRunning || state.mQueue.empty())
+				{
+					state.mScheduled = false;
+					mScheduledCount--;
+					mIdleCondition.notify_all();
+					return;
+				}
+				frame = state.mQueue.front();
+				state.mQueue.pop_front();
+			}
+
+			// Process and measure, the stage might be shared with another pipeline or occur more than once
+			auto start = std::chrono::high_resolution_clock::now();
+			bool forward = false;
+			{
+				std::lock_guard<std::mutex> stage_lock(pipeline_stage.mProcessMutex);
+				forward = pipeline_stage.process(*frame);
+			}
+			state.mLatency = math::lerp<float>(state.mLatency.load(), getMillisSince(start), latencyWeight);
+
+			// Notify listeners of last stage before the frame can be recycled
+			if (forward && last)
+			{
+				mLatency = math::lerp<float>(mLatency.load(), getMillisSince(frame->mTime), latencyWeight);
+				frameProcessed(*frame);
+			}
+
+			// Forward to next stage, or store as result
+			std::lock_guard<std::mutex> lock(mMutex);
+			if (!mRunning)
+			{
+				releaseFrame(frame);
+			}
+			else if (!forward)
+			{
+				releaseFrame(frame);
+				mDroppedCount++;
+			}
+			else if (!last)
+			{
+				enqueue(stage + 1, frame);
+			}
+			else
+			{
+				if (mResult != nullptr)
+					releaseFrame(mResult);
+				mResult = frame;
+				mNewResult = true;
+				mProcessedCount++;
+			}
+		}
+	}
+}
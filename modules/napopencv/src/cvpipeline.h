@@ -0,0 +1,161 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Local Includes
+#include "cvpipelinestage.h"
+#include "cvcapturedevice.h"
+
+// External Includes
+#include <nap/device.h>
+#include <nap/resourceptr.h>
+#include <nap/signalslot.h>
+#include <utility/threading.h>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+
+namespace nap
+{
+	/**
+	 * Runs a chain of nap::CVPipelineStage resources on every frame captured by a nap::CVCaptureDevice.
+	 *
+	 * Stages run concurrently on a thread pool: while one stage processes frame N, the previous stage processes frame N+1.
+	 * A single stage never runs on more than one thread at the same time, also not when it is shared by multiple pipelines. Frames are taken from a fixed pool of
+	 * nap::CVPipelineFrame objects that keep their matrix allocations, captured frames are copied into a pooled frame
+	 * before processing starts. In front of every stage is a bounded queue, when the queue is full the oldest frame is dropped.
+	 * This keeps the latency of the pipeline bounded when the stages can't keep up with the capture rate.
+	 *
+	 * Frames are received on the capture thread of the 'Device', the result is available through getObjects() and getFrame()
+	 * on any thread, or through the 'frameProcessed' signal on the pipeline thread that completed the frame.
+	 * Frames can also be pushed manually when no 'Device' is set, for example to process a file using a nap::CVVideo adapter
+	 * without a window or render loop.
+	 */
+	class NAPAPI CVPipeline : public Device
+	{
+		RTTI_ENABLE(Device)
+	public:
+		/**
+		 * Initializes the pipeline.
+		 * @param errorState contains the error if initialization fails
+		 * @return if initialization succeeded
+		 */
+		virtual bool init(utility::ErrorState& errorState) override;
+
+		/**
+		 * Creates the thread pool and frame pool, and starts listening to the capture device.
+		 * @param errorState contains the error if the pipeline can't be started
+		 * @return if the pipeline started
+		 */
+		virtual bool start(utility::ErrorState& errorState) override;
+
+		/**
+		 * Stops listening to the capture device and waits for all stages to finish.
+		 */
+		virtual void stop() override;
+
+		/**
+		 * Pushes a frame into the pipeline, thread safe. The content of the matrix is copied into a pooled frame.
+		 * @param matrix the frame to process
+		 */
+		void push(const cv::UMat& matrix);
+
+		/**
+		 * Returns all objects detected in the last processed frame, thread safe.
+		 * @return all objects detected in the last processed frame.
+		 */
+		std::vector<math::Rect> getObjects() const;
+
+		/**
+		 * Copies the output of the last stage into the given matrix if a new frame has been processed, thread safe.
+		 * @param outMatrix holds the processed frame
+		 * @return if a new frame was copied
+		 */
+		bool getFrame(cv::UMat& outMatrix);
+
+		/**
+		 * @return number of stages
+		 */
+		int getStageCount() const										{ return static_cast<int>(mStages.size()); }
+
+		/**
+		 * @param index the stage index
+		 * @return averaged processing time of a stage in milliseconds
+		 */
+		float getStageLatency(int index) const;
+
+		/**
+		 * @return averaged time in milliseconds from entering the pipeline until the frame is processed by the last stage
+		 */
+		float getLatency() const										{ return mLatency.load(); }
+
+		/**
+		 * @return total number of frames processed by the last stage
+		 */
+		uint64 getProcessedCount() const								{ return mProcessedCount.load(); }
+
+		/**
+		 * @return total number of frames dropped because a queue was full, the frame pool was exhausted or a stage rejected the frame.
+		 */
+		uint64 getDroppedCount() const									{ return mDroppedCount.load(); }
+
+		/**
+		 * Occurs when a frame is processed by the last stage, called from a pipeline thread.
+		 * The frame is only valid for the duration of the call.
+		 */
+		nap::Signal<const CVPipelineFrame&> frameProcessed;
+
+		ResourcePtr<CVCaptureDevice> mDevice = nullptr;					///< Property: 'Device' optional capture device to receive frames from
+		ResourcePtr<CVAdapter> mAdapter = nullptr;						///< Property: 'Adapter' the adapter to process frames from, required when a device is set
+		int mMatrixIndex = 0;											///< Property: 'MatrixIndex' the OpenCV matrix index of the adapter frame
+		std::vector<ResourcePtr<CVPipelineStage>> mStages;				///< Property: 'Stages' all stages, in order of execution
+		int mQueueSize = 1;												///< Property: 'QueueSize' max number of frames waiting in front of a stage
+		int mThreadCount = 0;											///< Property: 'ThreadCount' number of pipeline threads, 0 uses one thread per stage
+
+	private:
+		/**
+		 * Processing state of a stage
+		 */
+		struct StageState
+		{
+			std::deque<CVPipelineFrame*> mQueue;						///< Frames waiting to be processed
+			bool mScheduled = false;									///< If the stage is scheduled or running on the thread pool
+			std::atomic<float> mLatency = { 0.0f };						///< Averaged processing time in milliseconds
+		};
+
+		void onFrameCaptured(const CVFrameEvent& frameEvent);
+		nap::Slot<const CVFrameEvent&> mCaptureSlot = { this, &CVPipeline::onFrameCaptured };
+
+		// Takes a frame from the pool, nullptr when exhausted. Must be called with the lock held.
+		CVPipelineFrame* acquireFrame();
+
+		// Returns a frame to the pool. Must be called with the lock held.
+		void releaseFrame(CVPipelineFrame* frame);
+
+		// Queues a frame for processing by the given stage, schedules the stage when idle. Must be called with the lock held.
+		void enqueue(int stage, CVPipelineFrame* frame);
+
+		// Processes all queued frames of a stage, runs on the thread pool
+		void processStage(int stage);
+
+		std::vector<std::unique_ptr<CVPipelineFrame>> mFrames;			///< All frames, owned by the pipeline
+		std::vector<CVPipelineFrame*> mFreeFrames;						///< Frames that are available for processing
+		std::vector<std::unique_ptr<StageState>> mStageStates;			///< Processing state of every stage
+		CVPipelineFrame* mResult = nullptr;								///< Last processed frame
+		bool mNewResult = false;										///< If the result has not been read yet
+		uint64 mFrameNumber = 0;										///< Number of frames that entered the pipeline
+
+		std::unique_ptr<ThreadPool> mThreadPool;						///< Runs the stages
+		mutable std::mutex mMutex;										///< Guards queues, the frame pool and the result
+		std::condition_variable mIdleCondition;							///< Notified when a stage stops running
+		int mScheduledCount = 0;										///< Number of stages scheduled or running
+		bool mRunning = false;											///< If frames are accepted
+
+		std::atomic<float> mLatency = { 0.0f };							///< Averaged total latency in milliseconds
+		std::atomic<uint64> mProcessedCount = { 0 };					///< Number of processed frames
+		std::atomic<uint64> mDroppedCount = { 0 };						///< Number of dropped frames
+	};
+}
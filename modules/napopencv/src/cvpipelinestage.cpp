@@ -0,0 +1,158 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "cvpipelinestage.h"
+
+RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::CVPipelineStage)
+RTTI_END_CLASS
+
+RTTI_BEGIN_ENUM(nap::ECVColorConversion)
+	RTTI_ENUM_VALUE(nap::ECVColorConversion::BGRToGray,		"BGRToGray"),
+	RTTI_ENUM_VALUE(nap::ECVColorConversion::BGRToRGB,		"BGRToRGB"),
+	RTTI_ENUM_VALUE(nap::ECVColorConversion::BGRToHSV,		"BGRToHSV"),
+	RTTI_ENUM_VALUE(nap::ECVColorConversion::GrayToBGR,		"GrayToBGR")
+RTTI_END_ENUM
+
+RTTI_BEGIN_CLASS(nap::CVConvertStage)
+	RTTI_PROPERTY("Conversion",		&nap::CVConvertStage::mConversion,		nap::rtti::EPropertyMetaData::Default)
+	RTTI_PROPERTY("Equalize",		&nap::CVConvertStage::mEqualize,		nap::rtti::EPropertyMetaData::Default)
+RTTI_END_CLASS
+
+RTTI_BEGIN_CLASS(nap::CVResizeStage)
+	RTTI_PROPERTY("Scale",			&nap::CVResizeStage::mScale,			nap::rtti::EPropertyMetaData::Default)
+RTTI_END_CLASS
+
+RTTI_BEGIN_CLASS(nap::CVBlurStage)
+	RTTI_PROPERTY("KernelSize",		&nap::CVBlurStage::mKernelSize,			nap::rtti::EPropertyMetaData::Default)
+	RTTI_PROPERTY("Gaussian",		&nap::CVBlurStage::mGaussian,			nap::rtti::EPropertyMetaData::Default)
+RTTI_END_CLASS
+
+RTTI_BEGIN_CLASS(nap::CVThresholdStage)
+	RTTI_PROPERTY("Threshold",		&nap::CVThresholdStage::mThreshold,		nap::rtti::EPropertyMetaData::Default)
+	RTTI_PROPERTY("MaxValue",		&nap::CVThresholdStage::mMaxValue,		nap::rtti::EPropertyMetaData::Default)
+	RTTI_PROPERTY("Invert",			&nap::CVThresholdStage::mInvert,		nap::rtti::EPropertyMetaData::Default)
+RTTI_END_CLASS
+
+RTTI_BEGIN_CLASS(nap::CVContourStage)
+	RTTI_PROPERTY("MinArea",		&nap::CVContourStage::mMinArea,			nap::rtti::EPropertyMetaData::Default)
+RTTI_END_CLASS
+
+RTTI_BEGIN_CLASS(nap::CVClassifyStage)
+	RTTI_PROPERTY("Path",			&nap::CVClassifyStage::mPath,			nap::rtti::EPropertyMetaData::Required | nap::rtti::EPropertyMetaData::FileLink)
+	RTTI_PROPERTY("ScaleFactor",	&nap::CVClassifyStage::mScaleFactor,	nap::rtti::EPropertyMetaData::Default)
+	RTTI_PROPERTY("MinNeighbors",	&nap::CVClassifyStage::mMinNeighbors,	nap::rtti::EPropertyMetaData::Default)
+RTTI_END_CLASS
+
+//////////////////////////////////////////////////////////////////////////
+
+
+namespace nap
+{
+	bool CVConvertStage::process(CVPipelineFrame& frame)
+	{
+		cv::cvtColor(frame.getInput(), frame.getOutput(), static_cast<int>(mConversion));
+		frame.swap();
+
+		// Equalize in place, only valid for a single channel
+		if (mEqualize && frame.getInput().channels() == 1)
+		{
+			cv::equalizeHist(frame.getInput(), frame.getOutput());
+			frame.swap();
+		}
+		return true;
+	}
+
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool CVResizeStage::init(utility::ErrorState& errorState)
+	{
+		return errorState.check(mScale > 0.0f, "%s: scale must be higher than 0", mID.c_str());
+	}
+
+
+	bool CVResizeStage::process(CVPipelineFrame& frame)
+	{
+		cv::resize(frame.getInput(), frame.getOutput(), cv::Size(), mScale, mScale, cv::INTER_AREA);
+		frame.swap();
+		frame.mScale *= mScale;
+		return true;
+	}
+
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool CVBlurStage::init(utility::ErrorState& errorState)
+	{
+		return errorState.check(mKernelSize > 0 && mKernelSize % 2 == 1, "%s: kernel size must be positive and odd", mID.c_str());
+	}
+
+
+	bool CVBlurStage::process(CVPipelineFrame& frame)
+	{
+		cv::Size kernel(mKernelSize, mKernelSize);
+		if (mGaussian)
+			cv::GaussianBlur(frame.getInput(), frame.getOutput(), kernel, 0.0);
+		else
+			cv::blur(frame.getInput(), frame.getOutput(), kernel);
+		frame.swap();
+		return true;
+	}
+
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool CVThresholdStage::process(CVPipelineFrame& frame)
+	{
+		cv::threshold(frame.getInput(), frame.getOutput(), mThreshold, mMaxValue, mInvert ? cv::THRESH_BINARY_INV : cv::THRESH_BINARY);
+		frame.swap();
+		return true;
+	}
+
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool CVContourStage::process(CVPipelineFrame& frame)
+	{
+		// Find contours, the input is left untouched
+		frame.mContours.clear();
+		cv::findContours(frame.getInput(), frame.mContours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_SIMPLE);
+
+		// Remove small contours and add bounds of others as objects, mapped back to the original frame
+		float inv_scale = 1.0f / frame.mScale;
+		auto it = frame.mContours.begin();
+		while (it != frame.mContours.end())
+		{
+			if (cv::contourArea(*it) < mMinArea)
+			{
+				it = frame.mContours.erase(it);
+				continue;
+			}
+			cv::Rect bounds = cv::boundingRect(*it);
+			frame.mObjects.emplace_back(math::Rect(bounds.x * inv_scale, bounds.y * inv_scale, bounds.width * inv_scale, bounds.height * inv_scale));
+			++it;
+		}
+		return true;
+	}
+
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool CVClassifyStage::init(utility::ErrorState& errorState)
+	{
+		return errorState.check(mClassifier.load(mPath), "%s: unable to load cascade: %s",
+			mID.c_str(), mPath.c_str());
+	}
+
+
+	bool CVClassifyStage::process(CVPipelineFrame& frame)
+	{
+		// Detect objects and map back to the original frame
+		mClassifier.detectMultiScale(frame.getInput(), mDetected, mScaleFactor, mMinNeighbors);
+		float inv_scale = 1.0f / frame.mScale;
+		for (const auto& rect : mDetected)
+			frame.mObjects.emplace_back(math::Rect(rect.x * inv_scale, rect.y * inv_scale, rect.width * inv_scale, rect.height * inv_scale));
+		return true;
+	}
+}
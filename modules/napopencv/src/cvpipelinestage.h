@@ -0,0 +1,200 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// External Includes
+#include <nap/resource.h>
+#include <nap/numeric.h>
+#include <rect.h>
+#include <opencv2/core/mat.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/objdetect.hpp>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+namespace nap
+{
+	// Forward Declares
+	class CVPipeline;
+
+	/**
+	 * Frame that travels through a nap::CVPipeline.
+	 * Frames are owned and recycled by the pipeline, the matrices of a frame keep their allocation
+	 * when the frame is reused, which avoids allocating a new matrix for every stage of every frame.
+	 *
+	 * Every frame holds two matrices: an input and output matrix. A stage reads from getInput(),
+	 * writes into getOutput() and calls swap() to make the output the input of the next stage.
+	 * Stages that only analyze the frame don't write the output and don't swap.
+	 */
+	class NAPAPI CVPipelineFrame final
+	{
+		friend class CVPipeline;
+	public:
+		/**
+		 * @return the matrix to read from
+		 */
+		const cv::UMat& getInput() const							{ return mMatrices[mInput]; }
+
+		/**
+		 * @return the matrix to write into
+		 */
+		cv::UMat& getOutput()										{ return mMatrices[1 - mInput]; }
+
+		/**
+		 * Makes the output the input of the next stage.
+		 */
+		void swap()													{ mInput = 1 - mInput; }
+
+		/**
+		 * @return the number of the frame, incremented for every frame that enters the pipeline.
+		 */
+		uint64 getNumber() const									{ return mNumber; }
+
+		std::vector<math::Rect> mObjects;							///< Detected objects, in pixel coordinates of the frame that entered the pipeline
+		std::vector<std::vector<cv::Point>> mContours;				///< Detected contours, in pixel coordinates of the processed frame
+		float mScale = 1.0f;										///< Scale of the processed frame relative to the frame that entered the pipeline
+
+	private:
+		cv::UMat mMatrices[2];										///< Input and output matrix
+		int mInput = 0;												///< Index of the input matrix
+		uint64 mNumber = 0;											///< Frame number
+		std::chrono::high_resolution_clock::time_point mTime;		///< Time the frame entered the pipeline
+	};
+
+
+	/**
+	 * Single processing step of a nap::CVPipeline.
+	 * Stages are executed on a thread pool owned by the pipeline. A stage is never executed on more than one thread
+	 * at the same time, but different stages run concurrently on different frames.
+	 * A stage can be shared by multiple pipelines or listed more than once in the same pipeline,
+	 * calls to process() are serialized, stages are therefore allowed to keep state between frames.
+	 * Derive from this class to implement a custom stage.
+	 */
+	class NAPAPI CVPipelineStage : public Resource
+	{
+		friend class CVPipeline;
+		RTTI_ENABLE(Resource)
+	public:
+		/**
+		 * Processes a frame, called from a pipeline thread.
+		 * @param frame the frame to process
+		 * @return if the frame should be forwarded to the next stage, the frame is dropped otherwise.
+		 */
+		virtual bool process(CVPipelineFrame& frame) = 0;
+
+	private:
+		std::mutex mProcessMutex;									///< Serializes process() calls of pipelines that share this stage
+	};
+
+
+	//////////////////////////////////////////////////////////////////////////
+
+	/**
+	 * Supported color conversions
+	 */
+	enum class ECVColorConversion : int
+	{
+		BGRToGray	= cv::COLOR_BGR2GRAY,		///< Color to gray scale
+		BGRToRGB	= cv::COLOR_BGR2RGB,		///< Swap red and blue channel
+		BGRToHSV	= cv::COLOR_BGR2HSV,		///< Color to hue, saturation and value
+		GrayToBGR	= cv::COLOR_GRAY2BGR		///< Gray scale to color
+	};
+
+
+	/**
+	 * Converts the color space of a frame.
+	 */
+	class NAPAPI CVConvertStage : public CVPipelineStage
+	{
+		RTTI_ENABLE(CVPipelineStage)
+	public:
+		virtual bool process(CVPipelineFrame& frame) override;
+
+		ECVColorConversion mConversion = ECVColorConversion::BGRToGray;		///< Property: 'Conversion' the color conversion to apply
+		bool mEqualize = false;												///< Property: 'Equalize' equalize the histogram, only applied to gray scale output
+	};
+
+
+	/**
+	 * Scales a frame. Objects that are detected after this stage are mapped back to the resolution of the original frame.
+	 * Downscaling early in the pipeline is the most effective way to reduce the cost of all subsequent stages.
+	 */
+	class NAPAPI CVResizeStage : public CVPipelineStage
+	{
+		RTTI_ENABLE(CVPipelineStage)
+	public:
+		virtual bool init(utility::ErrorState& errorState) override;
+		virtual bool process(CVPipelineFrame& frame) override;
+
+		float mScale = 0.5f;												///< Property: 'Scale' scale factor, 0.5 halves the resolution
+	};
+
+
+	/**
+	 * Blurs a frame.
+	 */
+	class NAPAPI CVBlurStage : public CVPipelineStage
+	{
+		RTTI_ENABLE(CVPipelineStage)
+	public:
+		virtual bool init(utility::ErrorState& errorState) override;
+		virtual bool process(CVPipelineFrame& frame) override;
+
+		int mKernelSize = 5;												///< Property: 'KernelSize' size of the blur kernel in pixels, must be odd
+		bool mGaussian = true;												///< Property: 'Gaussian' gaussian blur instead of a box blur
+	};
+
+
+	/**
+	 * Thresholds a single channel frame.
+	 */
+	class NAPAPI CVThresholdStage : public CVPipelineStage
+	{
+		RTTI_ENABLE(CVPipelineStage)
+	public:
+		virtual bool process(CVPipelineFrame& frame) override;
+
+		float mThreshold = 128.0f;											///< Property: 'Threshold' pixel values above the threshold are set to the max value
+		float mMaxValue = 255.0f;											///< Property: 'MaxValue' value of pixels above the threshold
+		bool mInvert = false;												///< Property: 'Invert' set pixels below the threshold to the max value instead
+	};
+
+
+	/**
+	 * Finds the external contours of a binary (thresholded) single channel frame.
+	 * The bounding box of every contour is added to the detected objects of the frame.
+	 */
+	class NAPAPI CVContourStage : public CVPipelineStage
+	{
+		RTTI_ENABLE(CVPipelineStage)
+	public:
+		virtual bool process(CVPipelineFrame& frame) override;
+
+		float mMinArea = 16.0f;												///< Property: 'MinArea' minimum area of a contour in pixels of the processed frame
+	};
+
+
+	/**
+	 * Detects objects in a gray scale frame using a HaarCascade profile.
+	 * Every detected object is added to the detected objects of the frame.
+	 * Run a resize stage before this stage to detect on a lower resolution.
+	 */
+	class NAPAPI CVClassifyStage : public CVPipelineStage
+	{
+		RTTI_ENABLE(CVPipelineStage)
+	public:
+		virtual bool init(utility::ErrorState& errorState) override;
+		virtual bool process(CVPipelineFrame& frame) override;
+
+		std::string mPath;													///< Property: 'Path' path to cascade classifier file
+		float mScaleFactor = 1.1f;											///< Property: 'ScaleFactor' how much the image size is reduced at each image scale
+		int mMinNeighbors = 3;												///< Property: 'MinNeighbors' how many neighbors each candidate rectangle should have to retain it
+
+	private:
+		cv::CascadeClassifier mClassifier;
+		std::vector<cv::Rect> mDetected;
+	};
+}
@@ -3,6 +3,7 @@
  * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
 
 #include <parameter.h>
+#include <concurrentqueue.h>
 
 RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::Parameter)
 	RTTI_PROPERTY("Name",		&nap::Parameter::mName, nap::rtti::EPropertyMetaData::Default)
@@ -15,6 +16,52 @@ RTTI_END_CLASS
 
 namespace nap
 {
+	// Parameters with a staged value, drained by the nap::ParameterService
+	static moodycamel::ConcurrentQueue<Parameter*>& getStagedQueue()
+	{
+		static moodycamel::ConcurrentQueue<Parameter*> queue;
+		return queue;
+	}
+
+
+	Parameter::~Parameter()
+	{
+		if (!mQueued.load())
+			return;
+
+		// Take every parameter from the queue and put back the ones that aren't this parameter.
+		// A parameter is queued at most once, so the number of queued parameters is bounded.
+		auto& queue = getStagedQueue();
+		std::vector<Parameter*> queued;
+		Parameter* parameter = nullptr;
+		while (queue.try_dequeue(parameter))
+		{
+			if (parameter != this)
+				queued.emplace_back(parameter);
+		}
+		queue.enqueue_bulk(queued.begin(), queued.size());
+	}
+
+
+	void Parameter::queueStagedValue()
+	{
+		if (!mQueued.exchange(true))
+			getStagedQueue().enqueue(this);
+	}
+
+
+	bool Parameter::dequeueStagedValue(Parameter*& outParameter)
+	{
+		return getStagedQueue().try_dequeue(outParameter);
+	}
+
+
+	size_t Parameter::getStagedValueCount()
+	{
+		return getStagedQueue().size_approx();
+	}
+
+
 	ResourcePtr<Parameter> ParameterGroup::findParameter(const std::string& id) const
 	{
 		for (const auto& param : mParameters)
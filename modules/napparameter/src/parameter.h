@@ -8,6 +8,8 @@
 #include <rtti/rtti.h>
 #include <nap/resource.h>
 #include <nap/resourceptr.h>
+#include <nap/signalslot.h>
+#include <atomic>
 
 namespace nap
 {
@@ -22,6 +24,12 @@ namespace nap
 		RTTI_ENABLE(Resource)
 	
 	public:
+		/**
+		 * Removes this parameter from the queue of parameters with a staged value.
+		 * Values must not be staged on a parameter that is being destroyed.
+		 */
+		virtual ~Parameter();
+
 		/** 
 		 * Set the value for this parameter from another parameter. The incoming value is guaranteed to be of the same parameter type.
 		 *
@@ -29,6 +37,15 @@ namespace nap
 		 */
 		virtual void setValue(const Parameter& value) = 0;
 
+		/**
+		 * Applies the last value staged from another thread, see the stageValue() method of the derived parameter.
+		 * Raises the valueChanged signal of the derived parameter when the value changes.
+		 * Called once per frame by the nap::ParameterService for every parameter with a staged value, on the main thread.
+		 *
+		 * @return if the value of this parameter changed
+		 */
+		virtual bool commitStagedValue()					{ return false; }
+
 		/**
 		 * Get the display name for this parameter. If this parameter has a name set, that name is used. Otherwise, the ID is used.
 		 *
@@ -37,6 +54,31 @@ namespace nap
 		const std::string getDisplayName() const { return mName.empty() ? mID : mName; }
 
 		std::string mName;		///< Property 'Name': The name of this property. The name is separate from the ID and doesn't have to be unique.
+
+	protected:
+		/**
+		 * Called by the derived parameter after a value is staged, thread safe.
+		 * Queues this parameter for the next commit of the nap::ParameterService, a parameter is queued at most once.
+		 */
+		void queueStagedValue();
+
+	private:
+		friend class ParameterService;
+
+		/**
+		 * Takes the next parameter from the queue of parameters with a staged value, called by the nap::ParameterService.
+		 * The queue is shared by all parameters, a parameter removes itself from the queue when it is destroyed.
+		 * @param outParameter the queued parameter
+		 * @return if a parameter was taken from the queue
+		 */
+		static bool dequeueStagedValue(Parameter*& outParameter);
+
+		/**
+		 * @return approximate number of parameters in the queue of parameters with a staged value.
+		 */
+		static size_t getStagedValueCount();
+
+		std::atomic<bool> mQueued = { false };		///< If this parameter is queued for the next commit
 	};
 
 
@@ -88,6 +130,13 @@ namespace nap
 		 */
 		ResourcePtr<ParameterGroup> findChild(const std::string& id) const;
 
+		/**
+		 * Signal that's raised once per frame when the value of one or more parameters in this group changed by a commit of staged values.
+		 * Contains the parameters of this group that changed, child groups raise their own signal.
+		 * Every changed parameter raises its own valueChanged signal before this signal is raised.
+		 */
+		Signal<const std::vector<Parameter*>&> stagedValuesCommitted;
+
 	private:
 		friend class ParameterService;
 
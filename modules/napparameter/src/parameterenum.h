@@ -8,6 +8,7 @@
 #include <parameter.h>
 #include <nap/signalslot.h>
 #include <utility/dllexport.h>
+#include <stagedvalue.h>
 
 namespace nap
 {
@@ -108,9 +109,29 @@ namespace nap
 		 */
 		void setValue(T value);
 
+		/**
+		 * Stages a value to be set on the next commit, lock free and thread safe with respect to the main thread.
+		 * Values can be staged from one thread at a time, for example the sequence player thread.
+		 * Only the last value staged before a commit is set, the valueChanged signal is therefore raised at most once per commit.
+		 * Staged values are committed once per frame by the nap::ParameterService.
+		 *
+		 * @param value The value to stage
+		 */
+		void stageValue(T value)							{ mStagedValue.write(value); queueStagedValue(); }
+
+		/**
+		 * Sets the last staged value, raises the valueChanged signal if the value actually changes.
+		 *
+		 * @return if the value changed
+		 */
+		virtual bool commitStagedValue() override;
+
 	public:
 		T			mValue;			///< Property: 'Value' the current value of the parameter
 		Signal<T>	valueChanged;	///< Signal that's raised when the value of this parameter changes
+
+	private:
+		StagedValue<T>	mStagedValue;	///< Value staged from another thread
 	};
 
 	//////////////////////////////////////////////////////////////////////////
@@ -136,6 +157,18 @@ namespace nap
 			valueChanged(mValue);
 		}
 	}
+
+	template<class T>
+	bool ParameterEnum<T>::commitStagedValue()
+	{
+		T value;
+		if (!mStagedValue.read(value))
+			return false;
+
+		T oldValue = mValue;
+		setValue(value);
+		return oldValue != mValue;
+	}
 }
 
 #define DEFINE_ENUM_PARAMETER(Type)																			\
@@ -10,6 +10,7 @@
 // External Includes
 #include <parameter.h>
 #include <nap/signalslot.h>
+#include <stagedvalue.h>
 
 namespace nap
 {
@@ -36,6 +37,23 @@ namespace nap
 		 */
 		void setValue(T value);
 
+		/**
+		 * Stages a value to be set on the next commit, lock free and thread safe with respect to the main thread.
+		 * Values can be staged from one thread at a time, for example the sequence player thread.
+		 * Only the last value staged before a commit is set, the valueChanged signal is therefore raised at most once per commit.
+		 * Staged values are committed once per frame by the nap::ParameterService.
+		 *
+		 * @param value The value to stage
+		 */
+		void stageValue(T value)							{ mStagedValue.write(value); queueStagedValue(); }
+
+		/**
+		 * Sets the last staged value, raises the valueChanged signal if the value actually changes.
+		 *
+		 * @return if the value changed
+		 */
+		virtual bool commitStagedValue() override;
+
 		/**
 		 * Sets the min/max range of this parameter to the specified values. 
 		 * If the current value is outside of the specified range, it will be clamped.
@@ -51,6 +69,9 @@ namespace nap
 		T			mMaximum = static_cast<T>(1);	///< Property: 'Maximum' the maximum value of this parameter
 
 		Signal<T>	valueChanged;					///< Signal that's raised when the value of this parameter changes
+
+	private:
+		StagedValue<T>	mStagedValue;				///< Value staged from another thread
 	};
 
 
@@ -91,6 +112,18 @@ namespace nap
 		}
 	}
 
+	template<typename T>
+	bool ParameterNumeric<T>::commitStagedValue()
+	{
+		T value;
+		if (!mStagedValue.read(value))
+			return false;
+
+		T oldValue = mValue;
+		setValue(value);
+		return oldValue != mValue;
+	}
+
 	template<typename T>
 	void ParameterNumeric<T>::setRange(T minimum, T maximum)
 	{
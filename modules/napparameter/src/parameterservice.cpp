@@ -177,10 +177,68 @@ namespace nap
 			}
 		}
 
+		// Gather all parameters to commit staged values for, together with the first group they are part of
+		mParameterGroups.clear();
+		mCommitted.clear();
+		mCommittedGroups.clear();
+		for (auto& parameter : getCore().getResourceManager()->getObjects<Parameter>())
+			mParameterGroups.emplace(parameter.get(), nullptr);
+
+		for (auto& parameter_group : parameter_groups)
+		{
+			for (auto& parameter : parameter_group->mParameters)
+			{
+				auto it = mParameterGroups.find(parameter.get());
+				if (it != mParameterGroups.end() && it->second == nullptr)
+					it->second = parameter_group.get();
+			}
+		}
+
 		fileLoaded();
 	}
 
 
+	void ParameterService::update(double deltaTime)
+	{
+		commitStagedValues();
+	}
+
+
+	void ParameterService::commitStagedValues()
+	{
+		// Commit every queued parameter, parameters remove themselves from the queue when destroyed.
+		// The queued flag is cleared before the commit, a value staged after that queues the parameter again.
+		// The number of dequeued parameters is bounded, a parameter that is queued again is committed on the next call.
+		Parameter* parameter = nullptr;
+		size_t remaining = Parameter::getStagedValueCount();
+		while (remaining-- > 0 && Parameter::dequeueStagedValue(parameter))
+		{
+			parameter->mQueued.store(false);
+			if (!parameter->commitStagedValue())
+				continue;
+
+			// Parameters that aren't part of a loaded group only raise their own valueChanged signal
+			auto it = mParameterGroups.find(parameter);
+			if (it == mParameterGroups.end() || it->second == nullptr)
+				continue;
+
+			std::vector<Parameter*>& committed = mCommitted[it->second];
+			if (committed.empty())
+				mCommittedGroups.emplace_back(it->second);
+			committed.emplace_back(parameter);
+		}
+
+		// Notify every group once with all of its parameters that changed
+		for (auto* group : mCommittedGroups)
+		{
+			std::vector<Parameter*>& committed = mCommitted[group];
+			group->stagedValuesCommitted(committed);
+			committed.clear();
+		}
+		mCommittedGroups.clear();
+	}
+
+
 	void ParameterService::setParametersRecursive(const ParameterGroup& sourceParameters, ParameterGroup& destinationParameters)
 	{
 		// Apply all parameters in the source to the destination. 
@@ -8,10 +8,12 @@
 #include <nap/service.h>
 #include <nap/resourceptr.h>
 #include <nap/signalslot.h>
+#include <unordered_map>
 
 namespace nap
 {
 	class ParameterGroup;
+	class Parameter;
 
 	/**
 	 * The ParameterService manages the Parameters for a project. It provides support for loading/saving presets of Parameters
@@ -100,6 +102,15 @@ namespace nap
 		 */
 		std::string getGroupPresetDirectory(const std::string& groupID) const;
 
+		/**
+		 * Sets the values staged from other threads, see stageValue() of the derived parameter.
+		 * Only parameters that staged a value since the last commit are visited.
+		 * Every parameter that changed raises its valueChanged signal once, after which every group that contains
+		 * changed parameters raises its stagedValuesCommitted signal once.
+		 * Called automatically once per frame, call it manually to apply staged values immediately. Must be called from the main thread.
+		 */
+		void commitStagedValues();
+
 		/**
          * Signal that is emitted when a preset is loaded
          */
@@ -117,6 +128,12 @@ namespace nap
 		 */
 		virtual void postResourcesLoaded() override;
 
+		/**
+		 * Commits all staged parameter values.
+		 * @param deltaTime time in seconds in between frames
+		 */
+		virtual void update(double deltaTime) override;
+
 	private:
 
 		/** 
@@ -130,6 +147,9 @@ namespace nap
 	private:	
 		ParameterGroupList mGroups;
 		ResourcePtr<ParameterGroup> mRootGroup;		///< The root parameter group containing the parameters for this project
+		std::unordered_map<Parameter*, ParameterGroup*> mParameterGroups;				///< All parameters and the group they belong to, nullptr when not part of a group
+		std::unordered_map<ParameterGroup*, std::vector<Parameter*>> mCommitted;		///< Parameters of a group that changed in the current commit
+		std::vector<ParameterGroup*> mCommittedGroups;									///< Groups with changed parameters in the current commit
 	};
 
 
@@ -9,6 +9,7 @@
 
 // External Includes
 #include <nap/signalslot.h>
+#include <stagedvalue.h>
 
 namespace nap
 {
@@ -35,6 +36,23 @@ namespace nap
 		 */
 		void setValue(const T& value);
 
+		/**
+		 * Stages a value to be set on the next commit, lock free and thread safe with respect to the main thread.
+		 * Values can be staged from one thread at a time, for example the sequence player thread.
+		 * Only the last value staged before a commit is set, the valueChanged signal is therefore raised at most once per commit.
+		 * Staged values are committed once per frame by the nap::ParameterService.
+		 *
+		 * @param value The value to stage
+		 */
+		void stageValue(const T& value)							{ mStagedValue.write(value); queueStagedValue(); }
+
+		/**
+		 * Sets the last staged value, raises the valueChanged signal if the value actually changes.
+		 *
+		 * @return if the value changed
+		 */
+		virtual bool commitStagedValue() override;
+
 		/**
 		 * @return const reference to value
 		 */
@@ -43,6 +61,9 @@ namespace nap
 	public:
 		T			mValue;				///< Property: 'Value' the value of this parameter
 		Signal<T>	valueChanged;		///< Signal that's raised when the value of this parameter changes
+
+	private:
+		StagedValue<T>	mStagedValue;	///< Value staged from another thread
 	};
 
 
@@ -75,6 +96,18 @@ namespace nap
 		}
 	}
 
+	template<typename T>
+	bool ParameterSimple<T>::commitStagedValue()
+	{
+		T value;
+		if (!mStagedValue.read(value))
+			return false;
+
+		T oldValue = mValue;
+		setValue(value);
+		return oldValue != mValue;
+	}
+
 	template<typename T>
 	const T& nap::ParameterSimple<T>::getValue() const
 	{
@@ -0,0 +1,65 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// External Includes
+#include <utility/triplebuffer.h>
+
+namespace nap
+{
+	/**
+	 * Hands the last written value from one thread to another without locking, using a utility::TripleBuffer.
+	 * Writing and reading never wait on each other. Values written in between reads are coalesced, only the last one is read.
+	 * Values can be written from one thread at a time and read from one (other) thread at a time.
+	 */
+	template<typename T>
+	class StagedValue final
+	{
+	public:
+		/**
+		 * Stages a value, replaces the previously staged value if it hasn't been read yet.
+		 * @param value the value to stage
+		 */
+		void write(const T& value);
+
+		/**
+		 * Reads the last staged value.
+		 * @param outValue the last staged value, untouched if no value was staged since the last read
+		 * @return if a value was staged since the last read
+		 */
+		bool read(T& outValue);
+
+		/**
+		 * @return if a value was staged since the last read
+		 */
+		bool isStaged() const										{ return mBuffer.isPublished(); }
+
+	private:
+		utility::TripleBuffer<T> mBuffer;							///< Write, shared and read value
+	};
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Template Definitions
+	//////////////////////////////////////////////////////////////////////////
+
+	template<typename T>
+	void StagedValue<T>::write(const T& value)
+	{
+		mBuffer.getWriteBuffer() = value;
+		mBuffer.publish();
+	}
+
+
+	template<typename T>
+	bool StagedValue<T>::read(T& outValue)
+	{
+		if (!mBuffer.update())
+			return false;
+
+		outValue = mBuffer.getReadBuffer();
+		return true;
+	}
+}
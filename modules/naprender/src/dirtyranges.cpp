@@ -0,0 +1,68 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "dirtyranges.h"
+
+// External Includes
+#include <algorithm>
+
+namespace nap
+{
+	constexpr int DirtyRanges::maxRanges;
+
+	void DirtyRanges::add(size_t offset, size_t count)
+	{
+		if (mAll || count == 0)
+			return;
+
+		// Find first range that ends at or after the new range starts, ranges that touch are merged
+		size_t end = offset + count;
+		auto it = std::lower_bound(mRanges.begin(), mRanges.end(), offset, [](const BufferRange& range, size_t value)
+		{
+			return range.mOffset + range.mCount < value;
+		});
+
+		// Merge with all ranges that start at or before the end of the new range
+		auto last = it;
+		while (last != mRanges.end() && last->mOffset <= end)
+		{
+			offset = std::min<size_t>(offset, last->mOffset);
+			end = std::max<size_t>(end, last->mOffset + last->mCount);
+			++last;
+		}
+
+		it = mRanges.erase(it, last);
+		mRanges.insert(it, { offset, end - offset });
+
+		// Too many ranges, merge into one
+		if (mRanges.size() > static_cast<size_t>(maxRanges))
+		{
+			BufferRange span = { mRanges.front().mOffset, mRanges.back().mOffset + mRanges.back().mCount - mRanges.front().mOffset };
+			mRanges.clear();
+			mRanges.emplace_back(span);
+		}
+	}
+
+
+	void DirtyRanges::add(const DirtyRanges& ranges)
+	{
+		if (ranges.all())
+		{
+			addAll();
+			return;
+		}
+		for (const BufferRange& range : ranges.getRanges())
+			add(range.mOffset, range.mCount);
+	}
+
+
+	size_t DirtyRanges::getCount() const
+	{
+		size_t count = 0;
+		for (const BufferRange& range : mRanges)
+			count += range.mCount;
+		return count;
+	}
+}
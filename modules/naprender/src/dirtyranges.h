@@ -0,0 +1,83 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// External Includes
+#include <utility/dllexport.h>
+#include <vector>
+#include <stddef.h>
+
+namespace nap
+{
+	/**
+	 * A range of elements in a buffer
+	 */
+	struct NAPAPI BufferRange
+	{
+		size_t mOffset = 0;				///< First element in the range
+		size_t mCount = 0;				///< Number of elements in the range
+	};
+
+
+	/**
+	 * Keeps track of the ranges of a buffer that changed.
+	 * Overlapping and adjacent ranges are merged when added, the ranges are always sorted.
+	 * When the number of ranges exceeds the maximum, all ranges are merged into a single range that spans all of them.
+	 * A buffer can be marked as changed entirely, in which case the individual ranges are discarded.
+	 */
+	class NAPAPI DirtyRanges final
+	{
+	public:
+		// Maximum number of ranges before all ranges are merged into a single range
+		static constexpr int maxRanges = 32;
+
+		/**
+		 * Marks a range of elements as changed.
+		 * @param offset first element that changed
+		 * @param count number of elements that changed
+		 */
+		void add(size_t offset, size_t count);
+
+		/**
+		 * Marks all ranges of the given set as changed.
+		 * @param ranges the ranges to add
+		 */
+		void add(const DirtyRanges& ranges);
+
+		/**
+		 * Marks the entire buffer as changed.
+		 */
+		void addAll()														{ mAll = true; mRanges.clear(); }
+
+		/**
+		 * Marks the entire buffer as unchanged.
+		 */
+		void clear()														{ mAll = false; mRanges.clear(); }
+
+		/**
+		 * @return if nothing changed
+		 */
+		bool empty() const													{ return !mAll && mRanges.empty(); }
+
+		/**
+		 * @return if the entire buffer changed
+		 */
+		bool all() const													{ return mAll; }
+
+		/**
+		 * @return all changed ranges, sorted, not valid when the entire buffer changed.
+		 */
+		const std::vector<BufferRange>& getRanges() const					{ return mRanges; }
+
+		/**
+		 * @return total number of changed elements, not valid when the entire buffer changed.
+		 */
+		size_t getCount() const;
+
+	private:
+		std::vector<BufferRange> mRanges;
+		bool mAll = false;
+	};
+}
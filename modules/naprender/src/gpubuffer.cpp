@@ -31,6 +31,7 @@ namespace nap
 		// Scale buffers based on number of frames in flight when not static.
 		mRenderBuffers.resize(mUsage == EMeshDataUsage::Static ? 1 : 
 			renderService.getMaxFramesInFlight() + 1);
+		mPendingRanges.resize(mRenderBuffers.size());
 	}
 
 
@@ -63,7 +64,7 @@ namespace nap
 		switch (mUsage)
 		{
 			case EMeshDataUsage::DynamicWrite:
-				return setDataInternalDynamic(data, elementSize, numVertices, reservedNumVertices, usage, error);
+				return setDataInternalDynamic(data, elementSize, numVertices, reservedNumVertices, nullptr, usage, error);
 			case EMeshDataUsage::Static:
 				return setDataInternalStatic(data, elementSize, numVertices, usage, error);
 			default:
@@ -75,6 +76,18 @@ namespace nap
 	}
 
 
+	bool GPUBuffer::setDataInternal(void* data, int elementSize, size_t numVertices, size_t reservedNumVertices, const DirtyRanges& ranges, VkBufferUsageFlagBits usage, utility::ErrorState& error)
+	{
+		if (numVertices == 0)
+			return true;
+
+		// Only dynamic buffers can be updated partially
+		if (mUsage != EMeshDataUsage::DynamicWrite)
+			return setDataInternal(data, elementSize, numVertices, reservedNumVertices, usage, error);
+		return setDataInternalDynamic(data, elementSize, numVertices, reservedNumVertices, &ranges, usage, error);
+	}
+
+
 	bool GPUBuffer::setDataInternalStatic(void* data, int elementSize, size_t numVertices, VkBufferUsageFlagBits usage, utility::ErrorState& error)
 	{
 		// Calculate buffer byte size and fetch allocator
@@ -108,17 +121,31 @@ namespace nap
 		}
 
 		// Request upload
+		mUploadedBytes = mSize;
+		mRenderService->mUploadedBufferBytes += mSize;
 		mRenderService->requestBufferUpload(*this);
 		return true;
 	}
 
 
-	bool GPUBuffer::setDataInternalDynamic(void* data, int elementSize, size_t numVertices, size_t reservedNumVertices, VkBufferUsageFlagBits usage, utility::ErrorState& error)
+	bool GPUBuffer::setDataInternalDynamic(void* data, int elementSize, size_t numVertices, size_t reservedNumVertices, const DirtyRanges* ranges, VkBufferUsageFlagBits usage, utility::ErrorState& error)
 	{
 		// For each update of data, we cycle through the buffers. This has the effect that if you only ever need a single buffer (static data), you 
 		// will use only one buffer.
 		mCurrentBufferIndex = (mCurrentBufferIndex + 1) % mRenderBuffers.size();
 
+		// A partial update is only possible when the size of the data did not change.
+		// Every other render buffer must receive the same changes when it is cycled to, which are remembered per buffer.
+		uint32 data_size = elementSize * numVertices;
+		bool partial = ranges != nullptr && !ranges->all() && data_size == mSize;
+		for (DirtyRanges& buffer_ranges : mPendingRanges)
+		{
+			if (partial)
+				buffer_ranges.add(*ranges);
+			else
+				buffer_ranges.addAll();
+		}
+
 		// Calculate buffer byte size and fetch allocator
 		uint32_t required_size_bytes = elementSize * reservedNumVertices;
 		VmaAllocator allocator = mRenderService->getVulkanAllocator();
@@ -143,12 +170,26 @@ namespace nap
 				error.fail("Render buffer error");
 				return false;
 			}
+			mPendingRanges[mCurrentBufferIndex].addAll();
 		}
 
-		// Upload directly into buffer, use exact data size
-		mSize = elementSize * numVertices;
-		if (!error.check(uploadToBuffer(allocator, mSize, data, buffer_data), "Buffer upload failed"))
-			return false;
+		// Upload directly into buffer, use exact data size.
+		// Only upload the ranges that changed since this buffer was last written, if possible.
+		mSize = data_size;
+		DirtyRanges& pending = mPendingRanges[mCurrentBufferIndex];
+		if (pending.all())
+		{
+			if (!error.check(uploadToBuffer(allocator, mSize, data, buffer_data), "Buffer upload failed"))
+				return false;
+			mUploadedBytes = mSize;
+		}
+		else
+		{
+			if (!error.check(uploadToBuffer(allocator, elementSize, pending, data, buffer_data, mUploadedBytes), "Buffer upload failed"))
+				return false;
+		}
+		pending.clear();
+		mRenderService->mUploadedBufferBytes += mUploadedBytes;
 		bufferChanged();
 
 		return true;
@@ -75,6 +75,11 @@ namespace nap
 		 */
 		VkBuffer getBuffer() const;
 
+		/**
+		 * @return number of bytes written by the last update, excluding bytes that were skipped because they did not change.
+		 */
+		uint32 getUploadedBytes() const								{ return mUploadedBytes; }
+
 		/**
 		 * Called right after the buffer on the GPU has been updated.
 		 */
@@ -93,6 +98,22 @@ namespace nap
 		 */
 		bool setDataInternal(void* data, int elementSize, size_t numVertices, size_t reservedNumVertices, VkBufferUsageFlagBits usage, utility::ErrorState& error);
 
+		/**
+		 * Updates only the given ranges of the GPU buffer content, called by derived classes.
+		 * Every dynamic render buffer remembers the ranges that changed since it was last written, when the buffer
+		 * is cycled those ranges are uploaded together with the given ranges. The entire buffer is uploaded when
+		 * the number of vertices changed or the buffer is (re)allocated. Static buffers are always uploaded entirely.
+		 * @param data pointer to all the data, not only the changed ranges.
+		 * @param elementSize size in bytes of the element to upload
+		 * @param numVertices the number of vertices in data, data should be: numVertices * elementSize.
+		 * @param reservedNumVertices needs to be >= numVertices, allows the buffer to allocate more memory then required
+		 * @param ranges the element ranges that changed since the previous update
+		 * @param usage how the data is used at runtime
+		 * @param error contains error when data could not be set.
+		 * @return if the data was set
+		 */
+		bool setDataInternal(void* data, int elementSize, size_t numVertices, size_t reservedNumVertices, const DirtyRanges& ranges, VkBufferUsageFlagBits usage, utility::ErrorState& error);
+
 	private:
 		RenderService*			mRenderService = nullptr;			///< Handle to the render service
 		std::vector<BufferData>	mRenderBuffers;						///< Render accessible buffers
@@ -100,12 +121,14 @@ namespace nap
 		int						mCurrentBufferIndex = 0;			///< Current render buffer index
 		EMeshDataUsage			mUsage;								///< How the buffer is used, static, updated frequently etc.
 		uint32					mSize = 0;							///< Current used buffer size in bytes
+		uint32					mUploadedBytes = 0;					///< Number of bytes written by the last update
+		std::vector<DirtyRanges> mPendingRanges;					///< Per render buffer, ranges that changed since the buffer was last written
 
 		// Called when usage = static
 		bool setDataInternalStatic(void* data, int elementSize, size_t numVertices, VkBufferUsageFlagBits usage, utility::ErrorState& error);
 		
 		// Called when usage = dynamic write
-		bool setDataInternalDynamic(void* data, int elementSize, size_t numVertices, size_t reservedNumVertices, VkBufferUsageFlagBits usage, utility::ErrorState& error);
+		bool setDataInternalDynamic(void* data, int elementSize, size_t numVertices, size_t reservedNumVertices, const DirtyRanges* ranges, VkBufferUsageFlagBits usage, utility::ErrorState& error);
 
 		// Uploads data from the staging buffer into GPU buffer. Automatically called by the render service at the appropriate time.
 		// Only occurs when 'usage' = 'static'. Dynamic data shares GPU / CPU memory and is updated immediately.
@@ -114,6 +114,7 @@ namespace nap
 			assert(source_shape.getNumIndices() != 0);
 			dest_shape.setIndices(source_shape.getIndices().data(), source_shape.getIndices().size());
 		}
+		mConnectivityDirty = true;
 	}
 
 
@@ -126,11 +127,23 @@ namespace nap
 
 	MeshShape& MeshInstance::createShape()
 	{
+		mConnectivityDirty = true;
 		mProperties.mShapes.push_back(MeshShape());
 		return mProperties.mShapes.back();
 	}
 
 
+	const MeshConnectivity& MeshInstance::getConnectivity() const
+	{
+		if (mConnectivityDirty)
+		{
+			mConnectivity.build(*this);
+			mConnectivityDirty = false;
+		}
+		return mConnectivity;
+	}
+
+
 	bool MeshInstance::update(utility::ErrorState& errorState)
 	{
 		// Assert when trying to update a mesh that is static and already initialized
@@ -150,8 +163,7 @@ namespace nap
 		// Synchronize mesh attributes
 		for (auto& mesh_attribute : mProperties.mAttributes)
 		{
-			VertexBuffer& vertex_attr_buffer = mGPUMesh->getVertexBuffer(mesh_attribute->mAttributeID);
-			if (!vertex_attr_buffer.setData(mesh_attribute->getRawData(), mesh_attribute->getCount(), mesh_attribute->getCapacity(), errorState))
+			if (!updateAttribute(*mesh_attribute, errorState))
 				return false;
 		}
 
@@ -168,13 +180,34 @@ namespace nap
 
 	bool MeshInstance::update(nap::BaseVertexAttribute& attribute, utility::ErrorState& errorState)
 	{
-		VertexBuffer& gpu_buffer = mGPUMesh->getVertexBuffer(attribute.mAttributeID);
 		if (!errorState.check(attribute.getCount() == mProperties.mNumVertices,
 			"Vertex attribute %s has a different amount of elements (%d) than the mesh (%d)", attribute.mAttributeID.c_str(), attribute.getCount(), mProperties.mNumVertices))
 		{
 			return false;
 		}
-		return gpu_buffer.setData(attribute.getRawData(), attribute.getCount(), attribute.getCapacity(), errorState);
+		return updateAttribute(attribute, errorState);
+	}
+
+
+	bool MeshInstance::updateAttribute(nap::BaseVertexAttribute& attribute, utility::ErrorState& errorState)
+	{
+		// Without dirty tracking, or on initialization, the entire attribute is uploaded
+		VertexBuffer& gpu_buffer = mGPUMesh->getVertexBuffer(attribute.mAttributeID);
+		if (!attribute.getDirtyTracking() || !mInitialized)
+		{
+			attribute.clearDirty();
+			return gpu_buffer.setData(attribute.getRawData(), attribute.getCount(), attribute.getCapacity(), errorState);
+		}
+
+		// Nothing changed, the current GPU buffer already holds the latest data
+		if (!attribute.isDirty())
+			return true;
+
+		// Upload changed ranges only
+		if (!gpu_buffer.setData(attribute.getRawData(), attribute.getCount(), attribute.getCapacity(), attribute.getDirtyRanges(), errorState))
+			return false;
+		attribute.clearDirty();
+		return true;
 	}
 
 
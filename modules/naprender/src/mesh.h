@@ -6,6 +6,7 @@
 
 // Local Includes
 #include "vertexattribute.h"
+#include "meshconnectivity.h"
 
 // External includes
 #include <gpumesh.h>
@@ -250,7 +251,7 @@ namespace nap
 		 * the amount of vertices in the mesh.
 		 * @param numVertices: amount of vertices in the mesh.
 		 */
-		void setNumVertices(int numVertices)									{ mProperties.mNumVertices = numVertices; }
+		void setNumVertices(int numVertices)									{ mProperties.mNumVertices = numVertices; mConnectivityDirty = true; }
 
 		/**
 		 * @return the total number of vertices associated with this mesh
@@ -265,7 +266,7 @@ namespace nap
 		/**
 		* @return Set the topology of this mesh (triangle list, strip, lines etc).
 		*/
-		void setDrawMode(EDrawMode mode)										{ mProperties.mDrawMode = mode; }
+		void setDrawMode(EDrawMode mode)										{ mProperties.mDrawMode = mode; mConnectivityDirty = true; }
 
 		/**
 		 * @return The topology of this mesh (triangle list, strip, lines etc).
@@ -283,11 +284,12 @@ namespace nap
 		ECullMode getCullMode() const											{ return mProperties.mCullMode; }
 
 		/**
-		 * Get the shape at the specified index
+		 * Get the shape at the specified index.
+		 * Invalidates the cached connectivity, as the indices of the shape can be changed.
 		 * @param index The index of the shape to get (between 0 and getNumShapes())
 		 * @return The shape
 		 */
-		MeshShape& getShape(int index)											{ return mProperties.mShapes[index]; }
+		MeshShape& getShape(int index)											{ mConnectivityDirty = true; return mProperties.mShapes[index]; }
 
 		/**
 		 * Get the shape at the specified index
@@ -302,6 +304,21 @@ namespace nap
 		 */
 		MeshShape& createShape();
 
+		/**
+		 * Returns the cached triangle connectivity of this mesh, see nap::MeshConnectivity.
+		 * The connectivity is rebuilt on demand when the indices, draw mode or number of vertices changed.
+		 * Indices are considered changed when a shape is acquired using the non-const getShape() or created using createShape().
+		 * Call invalidateConnectivity() when the indices are changed in any other way.
+		 * Note that this call is not thread safe, the connectivity is rebuilt on demand.
+		 * @return the cached connectivity of all triangle shapes
+		 */
+		const MeshConnectivity& getConnectivity() const;
+
+		/**
+		 * Forces the connectivity to be rebuilt the next time it is requested.
+		 */
+		void invalidateConnectivity()											{ mConnectivityDirty = true; }
+
 		/**
 		 * Set the usage for this mesh. Note that it only makes sense to change this before init is called, 
 		 * changing it after init will not have any effect.
@@ -318,6 +335,8 @@ namespace nap
 		 * so this is only required if CPU data is modified after init().
 		 * Only update the mesh when 'Usage' is set to 'DynamicWrite', an assert is triggered otherwise.
 		 * If there is a mismatch between vertex buffer, an error will be returned.
+		 * Attributes with dirty tracking enabled only upload the ranges marked dirty, and are skipped when nothing changed,
+		 * see BaseVertexAttribute::setDirtyTracking(). Indices are always uploaded.
 		 * @param errorState Contains error information if an error occurred.
 		 * @return True if succeeded, false on error.		 
 		 */
@@ -338,10 +357,15 @@ namespace nap
 		bool initGPUData(utility::ErrorState& errorState);
 
 	private:
+		// Uploads the entire attribute, or only the dirty ranges when dirty tracking is enabled
+		bool updateAttribute(nap::BaseVertexAttribute& attribute, utility::ErrorState& errorState);
+
 		RenderService&											mRenderService;			///< Required reference to the render service
 		MeshProperties<std::unique_ptr<BaseVertexAttribute>>	mProperties;			///< CPU mesh data
 		std::unique_ptr<GPUMesh>								mGPUMesh;				///< GPU mesh
 		bool													mInitialized = false;	///< If the instance is initialized
+		mutable MeshConnectivity								mConnectivity;			///< Cached triangle connectivity
+		mutable bool											mConnectivityDirty = true;	///< If the connectivity needs to be rebuilt
 	};
 
 
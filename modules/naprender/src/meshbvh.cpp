@@ -0,0 +1,523 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "meshbvh.h"
+#include "mesh.h"
+#include "meshutils.h"
+
+// External Includes
+#include <mathutils.h>
+#include <utility/threading.h>
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+namespace nap
+{
+	// Number of bins used to evaluate the surface area heuristic
+	static constexpr int sahBinCount = 16;
+
+	// Minimum number of triangles in a sub-tree before it is built on the thread pool
+	static constexpr uint32 minParallelTriangles = 8192;
+
+	// Maximum depth of the traversal stack
+	static constexpr int maxStackDepth = 128;
+
+	// Maximum depth of the hierarchy. A traversal holds at most one sibling per level on the stack,
+	// capping the depth at half the stack size guarantees that the stack never overflows.
+	static constexpr uint32 maxBuildDepth = maxStackDepth / 2;
+
+
+	/**
+	 * @return half the surface area of a box
+	 */
+	static float halfArea(const glm::vec3& min, const glm::vec3& max)
+	{
+		glm::vec3 e = max - min;
+		return e.x * e.y + e.y * e.z + e.z * e.x;
+	}
+
+
+	/**
+	 * @return if the ray hits the box before the given distance, outNear holds the entry distance
+	 */
+	static bool intersectBox(const glm::vec3& min, const glm::vec3& max, const glm::vec3& origin, const glm::vec3& invDirection, float maxDistance, float& outNear)
+	{
+		glm::vec3 t1 = (min - origin) * invDirection;
+		glm::vec3 t2 = (max - origin) * invDirection;
+		glm::vec3 t_min = glm::min(t1, t2);
+		glm::vec3 t_max = glm::max(t1, t2);
+		float t_near = math::max<float>(math::max<float>(t_min.x, t_min.y), math::max<float>(t_min.z, 0.0f));
+		float t_far = math::min<float>(math::min<float>(t_max.x, t_max.y), t_max.z);
+		outNear = t_near;
+		return t_near <= t_far && t_near < maxDistance;
+	}
+
+
+	/**
+	 * @return squared distance from a point to a box
+	 */
+	static float distanceToBox2(const glm::vec3& min, const glm::vec3& max, const glm::vec3& point)
+	{
+		glm::vec3 d = glm::max(glm::max(min - point, point - max), glm::vec3(0.0f));
+		return glm::dot(d, d);
+	}
+
+
+	/**
+	 * Computes the point on a triangle closest to the given point, based on: Real-Time Collision Detection, Christer Ericson
+	 * @return barycentric coordinates of the closest point, x: weight of b, y: weight of c
+	 */
+	static glm::vec2 closestPointOnTriangle(const glm::vec3& p, const glm::vec3& a, const glm::vec3& b, const glm::vec3& c)
+	{
+		glm::vec3 ab = b - a;
+		glm::vec3 ac = c - a;
+		glm::vec3 ap = p - a;
+		float d1 = glm::dot(ab, ap);
+		float d2 = glm::dot(ac, ap);
+		if (d1 <= 0.0f && d2 <= 0.0f)
+			return { 0.0f, 0.0f };
+
+		glm::vec3 bp = p - b;
+		float d3 = glm::dot(ab, bp);
+		float d4 = glm::dot(ac, bp);
+		if (d3 >= 0.0f && d4 <= d3)
+			return { 1.0f, 0.0f };
+
+		float vc = d1 * d4 - d3 * d2;
+		if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+			return { d1 / (d1 - d3), 0.0f };
+
+		glm::vec3 cp = p - c;
+		float d5 = glm::dot(ab, cp);
+		float d6 = glm::dot(ac, cp);
+		if (d6 >= 0.0f && d5 <= d6)
+			return { 0.0f, 1.0f };
+
+		float vb = d5 * d2 - d1 * d6;
+		if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+			return { 0.0f, d2 / (d2 - d6) };
+
+		float va = d3 * d6 - d5 * d4;
+		if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f)
+		{
+			float w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+			return { 1.0f - w, w };
+		}
+
+		float denom = 1.0f / (va + vb + vc);
+		return { vb * denom, vc * denom };
+	}
+
+
+	/**
+	 * Triangle / box overlap test using the separating axis theorem, based on: Fast 3D Triangle-Box Overlap Testing, Tomas Akenine-Moller
+	 */
+	static bool overlapsTriangle(const glm::vec3& center, const glm::vec3& halfSize, const glm::vec3& a, const glm::vec3& b, const glm::vec3& c)
+	{
+		glm::vec3 v[3] = { a - center, b - center, c - center };
+		glm::vec3 edges[3] = { v[1] - v[0], v[2] - v[1], v[0] - v[2] };
+
+		// Projects the triangle and box on an axis, returns true when separated
+		auto separated = [&](const glm::vec3& axis)
+		{
+			float p0 = glm::dot(v[0], axis);
+			float p1 = glm::dot(v[1], axis);
+			float p2 = glm::dot(v[2], axis);
+			float r = glm::dot(halfSize, glm::abs(axis));
+			return math::min<float>(p0, math::min<float>(p1, p2)) > r || math::max<float>(p0, math::max<float>(p1, p2)) < -r;
+		};
+
+		// Edge cross products
+		const glm::vec3 axes[3] = { { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } };
+		for (const glm::vec3& edge : edges)
+		{
+			for (const glm::vec3& axis : axes)
+			{
+				if (separated(glm::cross(edge, axis)))
+					return false;
+			}
+		}
+
+		// Box faces
+		for (const glm::vec3& axis : axes)
+		{
+			if (separated(axis))
+				return false;
+		}
+
+		// Triangle plane
+		return !separated(glm::cross(edges[0], edges[1]));
+	}
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// MeshBVH
+	//////////////////////////////////////////////////////////////////////////
+
+	void MeshBVH::build(const MeshInstance& mesh, const VertexAttribute<glm::vec3>& positions, ThreadPool* threadPool)
+	{
+		clear();
+		mPositions = positions.getData();
+		mIndices = mesh.getConnectivity().getIndices();
+		uint32 triangle_count = static_cast<uint32>(getTriangleCount());
+		if (triangle_count == 0)
+			return;
+
+		// Gather triangle bounds and centroids
+		computeTriangleBounds();
+		mTriangles.resize(triangle_count);
+		for (uint32 i = 0; i < triangle_count; i++)
+			mTriangles[i] = i;
+
+		// Allocate enough nodes for the worst case, every split creates 2 nodes
+		mNodes.resize(triangle_count * 2 - 1);
+		mNodeCount = 1;
+		buildNode(0, 0, triangle_count, 0, threadPool);
+		mNodes.resize(mNodeCount.load());
+	}
+
+
+	void MeshBVH::refit(const VertexAttribute<glm::vec3>& positions)
+	{
+		assert(positions.getCount() == mPositions.size());
+		mPositions = positions.getData();
+		if (mNodes.empty())
+			return;
+
+		// Children are always stored after their parent, walk back to front
+		for (int i = static_cast<int>(mNodes.size()) - 1; i >= 0; i--)
+		{
+			Node& node = mNodes[i];
+			if (node.mCount > 0)
+			{
+				node.mMin = glm::vec3(std::numeric_limits<float>::max());
+				node.mMax = glm::vec3(std::numeric_limits<float>::lowest());
+				for (uint32 t = node.mFirst; t < node.mFirst + node.mCount; t++)
+				{
+					const uint32* tri = getTriangleIndices(mTriangles[t]);
+					for (int v = 0; v < 3; v++)
+					{
+						node.mMin = glm::min(node.mMin, mPositions[tri[v]]);
+						node.mMax = glm::max(node.mMax, mPositions[tri[v]]);
+					}
+				}
+			}
+			else
+			{
+				const Node& left = mNodes[node.mFirst];
+				const Node& right = mNodes[node.mFirst + 1];
+				node.mMin = glm::min(left.mMin, right.mMin);
+				node.mMax = glm::max(left.mMax, right.mMax);
+			}
+		}
+	}
+
+
+	void MeshBVH::clear()
+	{
+		mPositions.clear();
+		mIndices.clear();
+		mTriangles.clear();
+		mNodes.clear();
+		mNodeCount = 0;
+	}
+
+
+	math::Box MeshBVH::getBounds() const
+	{
+		return mNodes.empty() ? math::Box(glm::vec3(0.0f), glm::vec3(0.0f)) : math::Box(mNodes[0].mMin, mNodes[0].mMax);
+	}
+
+
+	void MeshBVH::computeTriangleBounds()
+	{
+		int triangle_count = getTriangleCount();
+		mCentroids.resize(triangle_count);
+		mTriangleMin.resize(triangle_count);
+		mTriangleMax.resize(triangle_count);
+		for (int i = 0; i < triangle_count; i++)
+		{
+			const uint32* tri = getTriangleIndices(i);
+			const glm::vec3& a = mPositions[tri[0]];
+			const glm::vec3& b = mPositions[tri[1]];
+			const glm::vec3& c = mPositions[tri[2]];
+			mTriangleMin[i] = glm::min(a, glm::min(b, c));
+			mTriangleMax[i] = glm::max(a, glm::max(b, c));
+			mCentroids[i] = (a + b + c) * (1.0f / 3.0f);
+		}
+	}
+
+
+	void MeshBVH::buildNode(uint32 nodeIndex, uint32 first, uint32 count, uint32 depth, ThreadPool* threadPool)
+	{
+		// Compute node and centroid bounds
+		Node& node = mNodes[nodeIndex];
+		node.mMin = glm::vec3(std::numeric_limits<float>::max());
+		node.mMax = glm::vec3(std::numeric_limits<float>::lowest());
+		glm::vec3 centroid_min = node.mMin;
+		glm::vec3 centroid_max = node.mMax;
+		for (uint32 i = first; i < first + count; i++)
+		{
+			uint32 tri = mTriangles[i];
+			node.mMin = glm::min(node.mMin, mTriangleMin[tri]);
+			node.mMax = glm::max(node.mMax, mTriangleMax[tri]);
+			centroid_min = glm::min(centroid_min, mCentroids[tri]);
+			centroid_max = glm::max(centroid_max, mCentroids[tri]);
+		}
+
+		if (count <= maxLeafSize || depth >= maxBuildDepth)
+		{
+			node.mFirst = first;
+			node.mCount = count;
+			return;
+		}
+
+		// Find the cheapest split, evaluated on a fixed number of bins per axis
+		int best_axis = -1;
+		int best_split = 0;
+		float best_cost = static_cast<float>(count) * halfArea(node.mMin, node.mMax);
+		glm::vec3 extent = centroid_max - centroid_min;
+		for (int axis = 0; axis < 3; axis++)
+		{
+			if (extent[axis] <= 0.0f)
+				continue;
+
+			uint32 bin_count[sahBinCount] = {};
+			glm::vec3 bin_min[sahBinCount];
+			glm::vec3 bin_max[sahBinCount];
+			for (int b = 0; b < sahBinCount; b++)
+			{
+				bin_min[b] = glm::vec3(std::numeric_limits<float>::max());
+				bin_max[b] = glm::vec3(std::numeric_limits<float>::lowest());
+			}
+
+			float scale = static_cast<float>(sahBinCount) / extent[axis];
+			for (uint32 i = first; i < first + count; i++)
+			{
+				uint32 tri = mTriangles[i];
+				int b = math::min<int>(static_cast<int>((mCentroids[tri][axis] - centroid_min[axis]) * scale), sahBinCount - 1);
+				bin_count[b]++;
+				bin_min[b] = glm::min(bin_min[b], mTriangleMin[tri]);
+				bin_max[b] = glm::max(bin_max[b], mTriangleMax[tri]);
+			}
+
+			// Sweep from the right to gather the area of every right side, from the left to evaluate every split
+			float right_area[sahBinCount];
+			uint32 right_count[sahBinCount];
+			glm::vec3 r_min(std::numeric_limits<float>::max()), r_max(std::numeric_limits<float>::lowest());
+			uint32 r_count = 0;
+			for (int b = sahBinCount - 1; b > 0; b--)
+			{
+				r_count += bin_count[b];
+				r_min = glm::min(r_min, bin_min[b]);
+				r_max = glm::max(r_max, bin_max[b]);
+				right_count[b] = r_count;
+				right_area[b] = r_count > 0 ? halfArea(r_min, r_max) : 0.0f;
+			}
+
+			glm::vec3 l_min(std::numeric_limits<float>::max()), l_max(std::numeric_limits<float>::lowest());
+			uint32 l_count = 0;
+			for (int b = 0; b < sahBinCount - 1; b++)
+			{
+				l_count += bin_count[b];
+				l_min = glm::min(l_min, bin_min[b]);
+				l_max = glm::max(l_max, bin_max[b]);
+				if (l_count == 0 || right_count[b + 1] == 0)
+					continue;
+
+				float cost = static_cast<float>(l_count) * halfArea(l_min, l_max) + static_cast<float>(right_count[b + 1]) * right_area[b + 1];
+				if (cost < best_cost)
+				{
+					best_cost = cost;
+					best_axis = axis;
+					best_split = b + 1;
+				}
+			}
+		}
+
+		// Partition triangles, fall back to splitting in the middle when no split improves the cost
+		uint32 left_count = count / 2;
+		if (best_axis >= 0)
+		{
+			float scale = static_cast<float>(sahBinCount) / extent[best_axis];
+			uint32* begin = mTriangles.data() + first;
+			uint32* middle = std::partition(begin, begin + count, [&](uint32 tri)
+			{
+				int b = math::min<int>(static_cast<int>((mCentroids[tri][best_axis] - centroid_min[best_axis]) * scale), sahBinCount - 1);
+				return b < best_split;
+			});
+			left_count = static_cast<uint32>(middle - begin);
+			assert(left_count > 0 && left_count < count);
+		}
+
+		// Allocate children and recurse, large sub-trees are built at the same time
+		uint32 children = mNodeCount.fetch_add(2);
+		node.mFirst = children;
+		node.mCount = 0;
+		if (threadPool != nullptr && count >= minParallelTriangles)
+		{
+			parallelFor(2, 2, threadPool, [&](int child, int, int)
+			{
+				if (child == 0)
+					buildNode(children, first, left_count, depth + 1, threadPool);
+				else
+					buildNode(children + 1, first + left_count, count - left_count, depth + 1, threadPool);
+			});
+		}
+		else
+		{
+			buildNode(children, first, left_count, depth + 1, threadPool);
+			buildNode(children + 1, first + left_count, count - left_count, depth + 1, threadPool);
+		}
+	}
+
+
+	bool MeshBVH::intersect(const glm::vec3& rayOrigin, const glm::vec3& rayDirection, MeshHit& outHit) const
+	{
+		if (mNodes.empty())
+			return false;
+
+		glm::vec3 inv_direction = 1.0f / rayDirection;
+		float best_distance = std::numeric_limits<float>::max();
+		TriangleData<glm::vec3> triangle;
+		glm::vec3 coordinates;
+		outHit.mTriangle = -1;
+
+		uint32 stack[maxStackDepth];
+		int stack_size = 0;
+		stack[stack_size++] = 0;
+		while (stack_size > 0)
+		{
+			const Node& node = mNodes[stack[--stack_size]];
+			float near_distance;
+			if (!intersectBox(node.mMin, node.mMax, rayOrigin, inv_direction, best_distance, near_distance))
+				continue;
+
+			if (node.mCount > 0)
+			{
+				for (uint32 t = node.mFirst; t < node.mFirst + node.mCount; t++)
+				{
+					const uint32* tri = getTriangleIndices(mTriangles[t]);
+					triangle[0] = mPositions[tri[0]];
+					triangle[1] = mPositions[tri[1]];
+					triangle[2] = mPositions[tri[2]];
+					if (utility::intersect(rayOrigin, rayDirection, triangle, coordinates) && coordinates.z < best_distance)
+					{
+						best_distance = coordinates.z;
+						outHit.mTriangle = static_cast<int>(mTriangles[t]);
+						outHit.mCoordinates = coordinates;
+					}
+				}
+				continue;
+			}
+
+			// Visit the closest child first
+			float left_near, right_near;
+			bool left_hit = intersectBox(mNodes[node.mFirst].mMin, mNodes[node.mFirst].mMax, rayOrigin, inv_direction, best_distance, left_near);
+			bool right_hit = intersectBox(mNodes[node.mFirst + 1].mMin, mNodes[node.mFirst + 1].mMax, rayOrigin, inv_direction, best_distance, right_near);
+			assert(stack_size + 2 <= maxStackDepth);
+			if (left_hit && right_hit)
+			{
+				bool left_first = left_near <= right_near;
+				stack[stack_size++] = left_first ? node.mFirst + 1 : node.mFirst;
+				stack[stack_size++] = left_first ? node.mFirst : node.mFirst + 1;
+			}
+			else if (left_hit)
+			{
+				stack[stack_size++] = node.mFirst;
+			}
+			else if (right_hit)
+			{
+				stack[stack_size++] = node.mFirst + 1;
+			}
+		}
+		return outHit.mTriangle >= 0;
+	}
+
+
+	int MeshBVH::intersect(const glm::vec3& center, float radius, std::vector<MeshHit>& outHits) const
+	{
+		outHits.clear();
+		if (mNodes.empty())
+			return 0;
+
+		float radius2 = radius * radius;
+		uint32 stack[maxStackDepth];
+		int stack_size = 0;
+		stack[stack_size++] = 0;
+		while (stack_size > 0)
+		{
+			const Node& node = mNodes[stack[--stack_size]];
+			if (distanceToBox2(node.mMin, node.mMax, center) > radius2)
+				continue;
+
+			if (node.mCount == 0)
+			{
+				assert(stack_size + 2 <= maxStackDepth);
+				stack[stack_size++] = node.mFirst;
+				stack[stack_size++] = node.mFirst + 1;
+				continue;
+			}
+
+			for (uint32 t = node.mFirst; t < node.mFirst + node.mCount; t++)
+			{
+				const uint32* tri = getTriangleIndices(mTriangles[t]);
+				const glm::vec3& a = mPositions[tri[0]];
+				const glm::vec3& b = mPositions[tri[1]];
+				const glm::vec3& c = mPositions[tri[2]];
+				glm::vec2 bary = closestPointOnTriangle(center, a, b, c);
+				glm::vec3 point = a + (b - a) * bary.x + (c - a) * bary.y;
+				glm::vec3 delta = point - center;
+				if (glm::dot(delta, delta) > radius2)
+					continue;
+
+				outHits.emplace_back();
+				outHits.back().mTriangle = static_cast<int>(mTriangles[t]);
+				outHits.back().mCoordinates = { bary.x, bary.y, glm::length(delta) };
+			}
+		}
+		return static_cast<int>(outHits.size());
+	}
+
+
+	int MeshBVH::intersect(const math::Box& box, std::vector<int>& outTriangles) const
+	{
+		outTriangles.clear();
+		if (mNodes.empty())
+			return 0;
+
+		const glm::vec3& box_min = box.getMin();
+		const glm::vec3& box_max = box.getMax();
+		glm::vec3 center = (box_min + box_max) * 0.5f;
+		glm::vec3 half_size = (box_max - box_min) * 0.5f;
+
+		uint32 stack[maxStackDepth];
+		int stack_size = 0;
+		stack[stack_size++] = 0;
+		while (stack_size > 0)
+		{
+			const Node& node = mNodes[stack[--stack_size]];
+			if (glm::any(glm::greaterThan(node.mMin, box_max)) || glm::any(glm::lessThan(node.mMax, box_min)))
+				continue;
+
+			if (node.mCount == 0)
+			{
+				assert(stack_size + 2 <= maxStackDepth);
+				stack[stack_size++] = node.mFirst;
+				stack[stack_size++] = node.mFirst + 1;
+				continue;
+			}
+
+			for (uint32 t = node.mFirst; t < node.mFirst + node.mCount; t++)
+			{
+				const uint32* tri = getTriangleIndices(mTriangles[t]);
+				if (overlapsTriangle(center, half_size, mPositions[tri[0]], mPositions[tri[1]], mPositions[tri[2]]))
+					outTriangles.emplace_back(static_cast<int>(mTriangles[t]));
+			}
+		}
+		return static_cast<int>(outTriangles.size());
+	}
+}
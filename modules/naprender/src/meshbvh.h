@@ -0,0 +1,167 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Local Includes
+#include "vertexattribute.h"
+
+// External Includes
+#include <utility/dllexport.h>
+#include <nap/numeric.h>
+#include <box.h>
+#include <glm/glm.hpp>
+#include <atomic>
+#include <vector>
+
+namespace nap
+{
+	// Forward Declares
+	class MeshInstance;
+	class ThreadPool;
+
+	/**
+	 * Result of a query against a nap::MeshBVH.
+	 */
+	struct NAPAPI MeshHit
+	{
+		int			mTriangle = -1;						///< Triangle number, as flattened by nap::MeshConnectivity
+		glm::vec3	mCoordinates = { 0.0f, 0.0f, 0.0f };	///< Barycentric u and v coordinates of the hit point, z holds the ray factor or distance to the sphere center
+	};
+
+
+	/**
+	 * Bounding volume hierarchy over the triangles of a nap::MeshInstance.
+	 *
+	 * Accelerates ray intersection (picking), sphere and box queries from linear to logarithmic time.
+	 * The hierarchy is built top-down using the surface area heuristic (SAH), evaluated over a fixed number of bins.
+	 * Large meshes are built in parallel when a thread pool is provided: sub-trees are handed to the pool as soon
+	 * as they are split off. The hierarchy is built in object space, transform the query into object space
+	 * to query a mesh that is transformed.
+	 *
+	 * Call refit() when the vertex positions change but the indices do not. Refitting only updates the bounds
+	 * of all nodes, which is considerably cheaper than a rebuild, but the quality of the hierarchy degrades when
+	 * the vertices move far from their original location. Rebuild the hierarchy when the indices change.
+	 *
+	 * Triangle numbers match the flattened triangle list of the nap::MeshConnectivity of the mesh,
+	 * which is the order in which a nap::TriangleIterator visits the triangles.
+	 *
+	 *~~~~~{.cpp}
+	 * MeshBVH bvh;
+	 * bvh.build(mesh, mesh.getAttribute<glm::vec3>(vertexid::position));
+	 * MeshHit hit;
+	 * if (bvh.intersect(ray_origin, ray_direction, hit))
+	 *		const uint32* indices = bvh.getTriangleIndices(hit.mTriangle);
+	 *~~~~~
+	 */
+	class NAPAPI MeshBVH final
+	{
+	public:
+		/**
+		 * Builds the hierarchy over all triangle shapes of the mesh.
+		 * @param mesh the mesh to build the hierarchy for
+		 * @param positions the vertex positions of the mesh
+		 * @param threadPool optional pool used to build large meshes in parallel, nullptr to build on the calling thread
+		 */
+		void build(const MeshInstance& mesh, const VertexAttribute<glm::vec3>& positions, ThreadPool* threadPool = nullptr);
+
+		/**
+		 * Updates the bounds of all nodes after the vertex positions changed.
+		 * The number of vertices and the mesh indices must be the same as on build.
+		 * @param positions the updated vertex positions of the mesh
+		 */
+		void refit(const VertexAttribute<glm::vec3>& positions);
+
+		/**
+		 * Removes the hierarchy, keeps allocated memory.
+		 */
+		void clear();
+
+		/**
+		 * Finds the closest triangle hit by a ray. Back-facing triangles relative to the ray direction are not considered,
+		 * similar to utility::intersect().
+		 * @param rayOrigin origin of the ray, in object space
+		 * @param rayDirection direction of the ray, in object space
+		 * @param outHit the closest hit, where z is the scalar factor for the ray
+		 * @return if the ray hits the mesh
+		 */
+		bool intersect(const glm::vec3& rayOrigin, const glm::vec3& rayDirection, MeshHit& outHit) const;
+
+		/**
+		 * Finds all triangles that overlap a sphere.
+		 * The coordinates of every hit describe the point on the triangle closest to the center of the sphere,
+		 * where z holds the distance from that point to the center.
+		 * @param center center of the sphere, in object space
+		 * @param radius radius of the sphere
+		 * @param outHits all overlapping triangles, cleared first
+		 * @return number of overlapping triangles
+		 */
+		int intersect(const glm::vec3& center, float radius, std::vector<MeshHit>& outHits) const;
+
+		/**
+		 * Finds all triangles that overlap an axis aligned box.
+		 * @param box the box, in object space
+		 * @param outTriangles all overlapping triangles, cleared first
+		 * @return number of overlapping triangles
+		 */
+		int intersect(const math::Box& box, std::vector<int>& outTriangles) const;
+
+		/**
+		 * @param triangle the triangle number
+		 * @return the three vertex indices of a triangle
+		 */
+		const uint32* getTriangleIndices(int triangle) const		{ return mIndices.data() + (triangle * 3); }
+
+		/**
+		 * @return total number of triangles in the hierarchy
+		 */
+		int getTriangleCount() const								{ return static_cast<int>(mIndices.size() / 3); }
+
+		/**
+		 * @return total number of nodes in the hierarchy
+		 */
+		int getNodeCount() const									{ return static_cast<int>(mNodes.size()); }
+
+		/**
+		 * @return bounds of the entire hierarchy
+		 */
+		math::Box getBounds() const;
+
+		// Maximum number of triangles in a leaf node, nodes at the maximum depth of 64 levels can hold more
+		static constexpr int maxLeafSize = 4;
+
+	private:
+		/**
+		 * A node in the hierarchy. Leaf nodes have a triangle count, the triangles are stored in the triangle list
+		 * starting at mFirst. Other nodes have a triangle count of 0 and two children, starting at mFirst.
+		 */
+		struct Node
+		{
+			glm::vec3	mMin;
+			uint32		mFirst = 0;
+			glm::vec3	mMax;
+			uint32		mCount = 0;
+		};
+
+		/**
+		 * Computes the bounds of the given node and splits it, recursively.
+		 * Large sub-trees are built in parallel when a thread pool is available.
+		 */
+		void buildNode(uint32 node, uint32 first, uint32 count, uint32 depth, ThreadPool* threadPool);
+
+		/**
+		 * Computes the bounds of all triangles, and their centroids, from the current positions
+		 */
+		void computeTriangleBounds();
+
+		std::vector<glm::vec3> mPositions;				///< Copy of the vertex positions
+		std::vector<uint32> mIndices;					///< Flat triangle list, 3 indices per triangle
+		std::vector<uint32> mTriangles;					///< Triangles referenced by the leaf nodes
+		std::vector<Node> mNodes;						///< All nodes, root first, children always after their parent
+		std::vector<glm::vec3> mCentroids;				///< Triangle centroids, used on build
+		std::vector<glm::vec3> mTriangleMin;			///< Triangle bounds, used on build
+		std::vector<glm::vec3> mTriangleMax;			///< Triangle bounds, used on build
+		std::atomic<uint32> mNodeCount = { 0 };			///< Number of allocated nodes, used on build
+	};
+}
@@ -0,0 +1,64 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Local Includes
+#include "meshconnectivity.h"
+#include "mesh.h"
+#include "triangleiterator.h"
+
+// External Includes
+#include <cassert>
+
+namespace nap
+{
+	void MeshConnectivity::build(const MeshInstance& mesh)
+	{
+		clear();
+
+		// Flatten all triangles of all shapes into a single triangle list
+		TriangleIterator iterator(mesh);
+		while (!iterator.isDone())
+		{
+			Triangle triangle = iterator.next();
+			mIndices.emplace_back(static_cast<uint32>(triangle.firstIndex()));
+			mIndices.emplace_back(static_cast<uint32>(triangle.secondIndex()));
+			mIndices.emplace_back(static_cast<uint32>(triangle.thirdIndex()));
+		}
+
+		// Count the number of triangles per vertex, offset by one
+		int vertex_count = mesh.getNumVertices();
+		mOffsets.assign(vertex_count + 1, 0);
+		for (uint32 index : mIndices)
+		{
+			assert(index < static_cast<uint32>(vertex_count));
+			mOffsets[index + 1]++;
+		}
+
+		// Turn counts into offsets
+		for (int i = 0; i < vertex_count; i++)
+			mOffsets[i + 1] += mOffsets[i];
+
+		// Scatter triangles, the first offset of every vertex is used as insertion cursor and restored afterwards
+		mTriangles.resize(mIndices.size());
+		int triangle_count = getTriangleCount();
+		for (int t = 0; t < triangle_count; t++)
+		{
+			const uint32* indices = getTriangleIndices(t);
+			mTriangles[mOffsets[indices[0]]++] = t;
+			mTriangles[mOffsets[indices[1]]++] = t;
+			mTriangles[mOffsets[indices[2]]++] = t;
+		}
+		for (int i = vertex_count; i > 0; i--)
+			mOffsets[i] = mOffsets[i - 1];
+		mOffsets[0] = 0;
+	}
+
+
+	void MeshConnectivity::clear()
+	{
+		mIndices.clear();
+		mOffsets.clear();
+		mTriangles.clear();
+	}
+}
@@ -0,0 +1,92 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// External Includes
+#include <utility/dllexport.h>
+#include <nap/numeric.h>
+#include <vector>
+
+namespace nap
+{
+	// Forward Declares
+	class MeshInstance;
+
+	/**
+	 * Binds the vertices of a triangle mesh to the triangles they are part of.
+	 *
+	 * The connectivity is stored in compressed sparse row (CSR) form: a flat list of triangles
+	 * per vertex, where the triangles of vertex v are in the range [offset(v), offset(v+1)).
+	 * All triangles of all triangle shapes are flattened into one triangle list, where every
+	 * triangle occupies three consecutive indices. Triangle fans and strips are resolved on build.
+	 *
+	 * Compared to the nap::utility::MeshConnectivityMap this structure is contiguous in memory,
+	 * requires only two allocations and can be rebuilt without allocating at all.
+	 * A MeshInstance caches its connectivity, see nap::MeshInstance::getConnectivity().
+	 */
+	class NAPAPI MeshConnectivity final
+	{
+	public:
+		/**
+		 * (Re)builds the connectivity of all triangle shapes in a mesh.
+		 * Shapes that do not contain triangles are skipped.
+		 * @param mesh the mesh to build the connectivity for
+		 */
+		void build(const MeshInstance& mesh);
+
+		/**
+		 * Removes all connectivity information, keeps allocated memory.
+		 */
+		void clear();
+
+		/**
+		 * @return total number of vertices
+		 */
+		int getVertexCount() const										{ return mOffsets.empty() ? 0 : static_cast<int>(mOffsets.size()) - 1; }
+
+		/**
+		 * @return total number of triangles, of all shapes
+		 */
+		int getTriangleCount() const									{ return static_cast<int>(mIndices.size() / 3); }
+
+		/**
+		 * @param triangle the triangle number, 0 - getTriangleCount()
+		 * @return the three vertex indices of a triangle
+		 */
+		const uint32* getTriangleIndices(int triangle) const			{ return mIndices.data() + (triangle * 3); }
+
+		/**
+		 * @param vertex the vertex index
+		 * @return the number of triangles the vertex is part of
+		 */
+		int getVertexTriangleCount(int vertex) const					{ return static_cast<int>(mOffsets[vertex + 1] - mOffsets[vertex]); }
+
+		/**
+		 * @param vertex the vertex index
+		 * @return the triangles the vertex is part of, holds getVertexTriangleCount() elements
+		 */
+		const uint32* getVertexTriangles(int vertex) const				{ return mTriangles.data() + mOffsets[vertex]; }
+
+		/**
+		 * @return flat triangle list, 3 indices per triangle
+		 */
+		const std::vector<uint32>& getIndices() const					{ return mIndices; }
+
+		/**
+		 * @return offset into the vertex triangle list for every vertex, holds vertex count + 1 elements.
+		 */
+		const std::vector<uint32>& getOffsets() const					{ return mOffsets; }
+
+		/**
+		 * @return the triangles of all vertices, see getOffsets()
+		 */
+		const std::vector<uint32>& getTriangles() const					{ return mTriangles; }
+
+	private:
+		std::vector<uint32> mIndices;				///< Flat triangle list, 3 indices per triangle
+		std::vector<uint32> mOffsets;				///< Start of every vertex in the vertex triangle list
+		std::vector<uint32> mTriangles;				///< Triangles bound to every vertex
+	};
+}
@@ -10,11 +10,25 @@
 #include <mathutils.h>
 #include <glm/gtx/normal.hpp>
 #include <triangleiterator.h>
+#include <utility/threading.h>
 
 namespace nap
 {
 	namespace utility
 	{
+		// Minimum number of vertices handled by a single task when processing a mesh in parallel
+		static constexpr int minVerticesPerTask = 4096;
+
+		/**
+		 * Returns the number of ranges to split the vertices of a mesh into, one per thread with at least minVerticesPerTask vertices each
+		 */
+		static int getRangeCount(int vertexCount, const ThreadPool* threadPool)
+		{
+			int thread_count = threadPool != nullptr ? threadPool->getThreadCount() + 1 : 1;
+			return math::max<int>(math::min<int>(thread_count, vertexCount / minVerticesPerTask), 1);
+		}
+
+
 		bool isTriangleMesh(const MeshInstance& meshInstance)
 		{
 			switch (meshInstance.getDrawMode())
@@ -152,6 +166,14 @@ namespace nap
 		{
 			assert(outNormals.getCount() == positions.getCount());
 
+			// Use cached connectivity when indices are available
+			const MeshConnectivity& connectivity = meshInstance.getConnectivity();
+			if (connectivity.getVertexCount() == positions.getCount())
+			{
+				computeNormals(connectivity, positions, outNormals);
+				return;
+			}
+
 			// Normal data
 			std::vector<glm::vec3>& normal_data = outNormals.getData();
 
@@ -182,6 +204,83 @@ namespace nap
 		}
 
 
+		void computeNormals(const MeshConnectivity& connectivity, const VertexAttribute<glm::vec3>& positions, VertexAttribute<glm::vec3>& outNormals, ThreadPool* threadPool)
+		{
+			assert(outNormals.getCount() == positions.getCount());
+			assert(connectivity.getVertexCount() == positions.getCount());
+
+			const glm::vec3* position_data = positions.getData().data();
+			glm::vec3* normal_data = outNormals.getData().data();
+			const uint32* offsets = connectivity.getOffsets().data();
+			const uint32* triangles = connectivity.getTriangles().data();
+			const uint32* indices = connectivity.getIndices().data();
+
+			// Gather the weighted face normals of all connected triangles, every vertex is written once
+			parallelFor(connectivity.getVertexCount(), getRangeCount(connectivity.getVertexCount(), threadPool), threadPool, [=](int, int begin, int end)
+			{
+				for (int v = begin; v < end; v++)
+				{
+					glm::vec3 normal(0.0f);
+					for (uint32 t = offsets[v]; t < offsets[v + 1]; t++)
+					{
+						const uint32* tri = indices + (triangles[t] * 3);
+						const glm::vec3& a = position_data[tri[0]];
+						normal += glm::cross(a - position_data[tri[1]], a - position_data[tri[2]]);
+					}
+					normal_data[v] = glm::normalize(normal);
+				}
+			});
+		}
+
+
+		void computeTangents(const MeshConnectivity& connectivity, const VertexAttribute<glm::vec3>& positions, const VertexAttribute<glm::vec3>& uvs,
+			const VertexAttribute<glm::vec3>& normals, VertexAttribute<glm::vec3>& outTangents, ThreadPool* threadPool)
+		{
+			assert(outTangents.getCount() == positions.getCount());
+			assert(uvs.getCount() == positions.getCount());
+			assert(normals.getCount() == positions.getCount());
+			assert(connectivity.getVertexCount() == positions.getCount());
+
+			const glm::vec3* position_data = positions.getData().data();
+			const glm::vec3* uv_data = uvs.getData().data();
+			const glm::vec3* normal_data = normals.getData().data();
+			glm::vec3* tangent_data = outTangents.getData().data();
+			const uint32* offsets = connectivity.getOffsets().data();
+			const uint32* triangles = connectivity.getTriangles().data();
+			const uint32* indices = connectivity.getIndices().data();
+
+			parallelFor(connectivity.getVertexCount(), getRangeCount(connectivity.getVertexCount(), threadPool), threadPool, [=](int, int begin, int end)
+			{
+				for (int v = begin; v < end; v++)
+				{
+					// Sum triangle tangents, weighted by the area of the triangle in uv space
+					glm::vec3 tangent(0.0f);
+					for (uint32 t = offsets[v]; t < offsets[v + 1]; t++)
+					{
+						const uint32* tri = indices + (triangles[t] * 3);
+						glm::vec3 edge_one = position_data[tri[1]] - position_data[tri[0]];
+						glm::vec3 edge_two = position_data[tri[2]] - position_data[tri[0]];
+						glm::vec2 duv_one = glm::vec2(uv_data[tri[1]] - uv_data[tri[0]]);
+						glm::vec2 duv_two = glm::vec2(uv_data[tri[2]] - uv_data[tri[0]]);
+						float det = duv_one.x * duv_two.y - duv_two.x * duv_one.y;
+						tangent += (edge_one * duv_two.y - edge_two * duv_one.y) * (det < 0.0f ? -1.0f : 1.0f);
+					}
+
+					// Orthogonalize against the normal, fall back to any perpendicular vector
+					const glm::vec3& n = normal_data[v];
+					tangent -= n * glm::dot(n, tangent);
+					float length = glm::length(tangent);
+					if (length <= math::epsilon<float>())
+					{
+						tangent = glm::cross(n, glm::abs(n.x) < 0.9f ? glm::vec3(1.0f, 0.0f, 0.0f) : glm::vec3(0.0f, 1.0f, 0.0f));
+						length = glm::length(tangent);
+					}
+					tangent_data[v] = tangent / length;
+				}
+			});
+		}
+
+
 		void reverseWindingOrder(MeshInstance& mesh)
 		{
 			TriangleIterator iterator(mesh);
@@ -11,6 +11,9 @@
 
 namespace nap
 {
+	// Forward Declares
+	class ThreadPool;
+
 	namespace utility
 	{
 		// Binds all the points to a set of triangular faces
@@ -69,7 +72,7 @@ namespace nap
 
 		/**
 		* Automatically re-computes all the normals of a mesh
-		* When the mesh has indices the normal is computed based on connectivity
+		* When the mesh has indices the normal is computed based on the cached connectivity of the mesh, see MeshInstance::getConnectivity().
 		* Meshes without indices receive the triangular face normal
 		* @param mesh the triangular mesh
 		* @param vertices the vertex position attribute
@@ -77,6 +80,34 @@ namespace nap
 		*/
 		void NAPAPI computeNormals(const nap::MeshInstance& mesh, const nap::VertexAttribute<glm::vec3>& vertices, nap::VertexAttribute<glm::vec3>& outNormals);
 
+		/**
+		* Re-computes all the normals of a mesh using the given connectivity.
+		* Every vertex normal is the normalized sum of the weighted face normals of the triangles it is part of.
+		* Every vertex is computed independently, without scattered writes, which allows the work to be split into
+		* ranges of vertices that are processed in parallel on the given thread pool. The calling thread processes one range as well.
+		* Small meshes, or a pool without threads, are processed on the calling thread only.
+		* @param connectivity the mesh connectivity, acquired using MeshInstance::getConnectivity()
+		* @param vertices the vertex position attribute
+		* @param outNormals the recomputed normals, the normals have to be initialized and of the same length as the vertices
+		* @param threadPool optional pool used to compute the normals in parallel, nullptr to compute them on the calling thread
+		*/
+		void NAPAPI computeNormals(const MeshConnectivity& connectivity, const nap::VertexAttribute<glm::vec3>& vertices, nap::VertexAttribute<glm::vec3>& outNormals, ThreadPool* threadPool = nullptr);
+
+		/**
+		* Re-computes all the tangents of a mesh using the given connectivity.
+		* The tangent of every triangle is derived from the change in uv coordinates, summed per vertex
+		* and orthogonalized against the vertex normal (Gram-Schmidt). Vertices are processed in parallel
+		* when a thread pool is given, similar to computeNormals().
+		* @param connectivity the mesh connectivity, acquired using MeshInstance::getConnectivity()
+		* @param vertices the vertex position attribute
+		* @param uvs the vertex uv attribute
+		* @param normals the vertex normal attribute
+		* @param outTangents the recomputed tangents, the tangents have to be initialized and of the same length as the vertices
+		* @param threadPool optional pool used to compute the tangents in parallel, nullptr to compute them on the calling thread
+		*/
+		void NAPAPI computeTangents(const MeshConnectivity& connectivity, const nap::VertexAttribute<glm::vec3>& vertices, const nap::VertexAttribute<glm::vec3>& uvs,
+			const nap::VertexAttribute<glm::vec3>& normals, nap::VertexAttribute<glm::vec3>& outTangents, ThreadPool* threadPool = nullptr);
+
 		/**
 		* Reverses the winding order of all the triangle vertices in a mesh
 		* When a triangle has vertices A, B, C the new order will be C, B, A
@@ -99,7 +130,8 @@ namespace nap
 		* Builds a 'map' that binds points (mesh index values) to faces
 		* The index in the array corresponds to a mesh vertex index (point).
 		* This call only works for meshes that have indices. When the mesh does not have indices this call asserts
-		* Try to avoid building the map regularly, it's a heavy operation
+		* Try to avoid building the map regularly, it's a heavy operation.
+		* Prefer the cached, contiguous MeshInstance::getConnectivity() when connectivity is required frequently.
 		* This call asserts when the mesh is not a triangular mesh or has no indices associated with it
 		* @param mesh the mesh to get build the array from
 		* @param outConnectivityMap the array that is populated with the triangles associated with a single index
@@ -381,6 +381,7 @@ namespace nap
 
 	Vec3VertexAttribute& PolyLine::getPositionAttr()
 	{
+		mDistancesDirty = true;
 		return getMeshInstance().getAttribute<glm::vec3>(vertexid::position);
 	}
 
@@ -437,4 +438,59 @@ namespace nap
 	{
 		return math::getDistancesAlongLine(getPositionAttr().getData(), outDistances, isClosed());
 	}
+
+
+	const std::vector<float>& PolyLine::getDistanceTable() const
+	{
+		const Vec3VertexAttribute& attr = getPositionAttr();
+		const std::vector<glm::vec3>& positions = attr.getData();
+		size_t table_size = isClosed() ? positions.size() + 1 : positions.size();
+		if (mDistancesDirty || mDistances.size() != table_size || mDistancesAttr != &attr || mDistancesVersion != attr.getVersion())
+		{
+			mLength = math::getDistancesAlongLine(positions, mDistances, isClosed());
+			mDistancesDirty = false;
+			mDistancesAttr = &attr;
+			mDistancesVersion = attr.getVersion();
+		}
+		return mDistances;
+	}
+
+
+	float PolyLine::getLength() const
+	{
+		getDistanceTable();
+		return mLength;
+	}
+
+
+	void PolyLine::getPosition(float location, glm::vec3& outPosition) const
+	{
+		const std::vector<float>& distances = getDistanceTable();
+		const Vec3VertexAttribute& attr = getPositionAttr();
+		math::LineSample sample = math::getVertexLerpValue(distances, attr.getCount(), location);
+		math::getValuesAlongLine(&sample, 1, attr.getData(), &outPosition);
+	}
+
+
+	void PolyLine::getNormal(float location, glm::vec3& outNormal) const
+	{
+		const std::vector<float>& distances = getDistanceTable();
+		math::LineSample sample = math::getVertexLerpValue(distances, getPositionAttr().getCount(), location);
+		math::getNormalsAlongLine(&sample, 1, getNormalAttr().getData(), &outNormal);
+	}
+
+
+	void PolyLine::getSamples(const float* locations, int count, std::vector<math::LineSample>& outSamples) const
+	{
+		const std::vector<float>& distances = getDistanceTable();
+		outSamples.resize(count);
+		math::getVertexLerpValues(distances, getPositionAttr().getCount(), locations, count, outSamples.data());
+	}
+
+
+	void PolyLine::getNormals(const Vec3VertexAttribute& attr, const std::vector<math::LineSample>& samples, std::vector<glm::vec3>& outValues) const
+	{
+		outValues.resize(samples.size());
+		math::getNormalsAlongLine(samples.data(), static_cast<int>(samples.size()), attr.getData(), outValues.data());
+	}
 }
\ No newline at end of file
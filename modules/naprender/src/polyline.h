@@ -59,7 +59,8 @@ namespace nap
 		virtual const MeshInstance&	getMeshInstance() const override 			{ return *mMeshInstance; }
 
 		/**
-		 *	@return The line position vertex data
+		 * Invalidates the cached distance table, the table is rebuilt the next time it is required.
+		 * @return The line position vertex data
 		 */
 		Vec3VertexAttribute& getPositionAttr();
 		
@@ -132,6 +133,20 @@ namespace nap
 		 */
 		void getNormal(const std::map<float, int>& distanceMap, const Vec3VertexAttribute& attr, float location, glm::vec3& outValue) const;
 
+		/**
+		 * Returns the interpolated (accurate) position along the line, using the cached distance table.
+		 * @param location the location on the line to get the position for, needs to be within the 0-1 range
+		 * @param outPosition the interpolated position
+		 */
+		void getPosition(float location, glm::vec3& outPosition) const;
+
+		/**
+		 * Returns the interpolated (rotated) normal along the line, using the cached distance table.
+		 * @param location the location on the line to get the normal for, needs to be within the 0-1 range
+		 * @param outNormal the interpolated normal
+		 */
+		void getNormal(float location, glm::vec3& outNormal) const;
+
 		/**
 		 * Utility function that retrieves the distance along the line for every vertex
 		 * Note that this call is relatively heavy
@@ -140,6 +155,53 @@ namespace nap
 		 */
 		float getDistances(std::map<float, int>& outDistances) const;
 
+		/**
+		 * Returns the accumulated distance along the line for every vertex, see math::getDistancesAlongLine().
+		 * The table is cached and rebuilt when the positions might have changed, see BaseVertexAttribute::getVersion():
+		 * when the position data is changed or acquired for writing, or when the non-const position attribute is acquired.
+		 * Call invalidateDistances() explicitly after writing to the mData member of the position attribute.
+		 * Note that this call is not thread safe, the table is rebuilt on demand.
+		 * @return the cached distance table
+		 */
+		const std::vector<float>& getDistanceTable() const;
+
+		/**
+		 * @return total length of the line, based on the cached distance table.
+		 */
+		float getLength() const;
+
+		/**
+		 * Forces the distance table to be rebuilt the next time it is required.
+		 */
+		void invalidateDistances()												{ mDistancesDirty = true; }
+
+		/**
+		 * Resolves a set of sample locations along the line using the cached distance table.
+		 * The samples can be used to interpolate any number of attributes using getValues() or getNormals().
+		 * Provide the locations in ascending order for best performance.
+		 * @param locations parametric normalized locations along the line, every value needs to be within the 0-1 range
+		 * @param count number of locations
+		 * @param outSamples the resolved samples
+		 */
+		void getSamples(const float* locations, int count, std::vector<math::LineSample>& outSamples) const;
+
+		/**
+		 * Interpolates an attribute for every sample, this is the batched version of getValue().
+		 * @param attr the attribute to get the values for, ie: position, color or uv
+		 * @param samples line samples, acquired using getSamples()
+		 * @param outValues the interpolated values
+		 */
+		template<typename T>
+		void getValues(const VertexAttribute<T>& attr, const std::vector<math::LineSample>& samples, std::vector<T>& outValues) const;
+
+		/**
+		 * Interpolates (rotates) the normal for every sample, this is the batched version of getNormal().
+		 * @param attr the normal attribute to get the interpolated (rotated) values for
+		 * @param samples line samples, acquired using getSamples()
+		 * @param outValues the interpolated normals
+		 */
+		void getNormals(const Vec3VertexAttribute& attr, const std::vector<math::LineSample>& samples, std::vector<glm::vec3>& outValues) const;
+
 		/**
 		 * @return if the line is closed or not
 		 */
@@ -152,6 +214,12 @@ namespace nap
 		std::unique_ptr<MeshInstance> mMeshInstance;
 		RenderService* mRenderService = nullptr;
 
+		mutable std::vector<float> mDistances;						///< Cached distance table
+		mutable float mLength = 0.0f;								///< Cached length of the line
+		mutable bool mDistancesDirty = true;						///< If the distance table needs to be rebuilt
+		mutable const Vec3VertexAttribute* mDistancesAttr = nullptr;	///< Position attribute the distance table was built from
+		mutable uint64 mDistancesVersion = 0;						///< Version of the position attribute the distance table was built from
+
 		/**
 		 * Utility function, creates all the default line attributes: Position, Normal, UV0 and Color0.
 		 * @param instance the instance to add the attributes to.
@@ -326,4 +394,11 @@ namespace nap
 	{
 		return math::getValueAlongLine(distanceMap, attr.getData(), location, outValue);
 	}
+
+	template<typename T>
+	void nap::PolyLine::getValues(const VertexAttribute<T>& attr, const std::vector<math::LineSample>& samples, std::vector<T>& outValues) const
+	{
+		outValues.resize(samples.size());
+		math::getValuesAlongLine(samples.data(), static_cast<int>(samples.size()), attr.getData(), outValues.data());
+	}
 }
\ No newline at end of file
@@ -1651,6 +1651,10 @@ namespace nap
 		vkQueueSubmit(mQueue, 0, VK_NULL_HANDLE, mFramesInFlight[mCurrentFrameIndex].mFence);
 		mCurrentFrameIndex = (mCurrentFrameIndex + 1) % 2;
 		mIsRenderingFrame = false;
+
+		// Store number of bytes uploaded to buffers this frame
+		mLastFrameUploadedBufferBytes = mUploadedBufferBytes;
+		mUploadedBufferBytes = 0;
 	}
 
 
@@ -623,6 +623,13 @@ namespace nap
 		 */
 		int getCurrentFrameIndex() const											{ return mCurrentFrameIndex; }
 
+		/**
+		 * Returns the number of bytes written to dynamic and staging buffers in the previous frame,
+		 * counted from the end of the frame before it. Use this to monitor the cost of mesh updates.
+		 * @return number of bytes uploaded to GPU buffers in the previous frame.
+		 */
+		uint64 getUploadedBufferBytes() const										{ return mLastFrameUploadedBufferBytes; }
+
 		/**
 		 * Returns the max number of frames in flight. If there is only
 		 * 1 frame in flight the application will stall until it is rendered. Having
@@ -871,6 +878,8 @@ namespace nap
 
 		int										mCurrentFrameIndex = 0;
 		std::vector<Frame>						mFramesInFlight;
+		uint64									mUploadedBufferBytes = 0;
+		uint64									mLastFrameUploadedBufferBytes = 0;
 		VkCommandBuffer							mCurrentCommandBuffer = VK_NULL_HANDLE;
 		RenderWindow*							mCurrentRenderWindow = nullptr;		
 
@@ -124,6 +124,25 @@ namespace nap
 	}
 
 
+	bool NAPAPI uploadToBuffer(VmaAllocator allocator, uint32 elementSize, const DirtyRanges& ranges, void* data, BufferData& buffer, uint32& outSize)
+	{
+		outSize = 0;
+		void* mapped_memory;
+		if (vmaMapMemory(allocator, buffer.mAllocation, &mapped_memory) != VK_SUCCESS)
+			return false;
+
+		for (const BufferRange& range : ranges.getRanges())
+		{
+			size_t offset = range.mOffset * elementSize;
+			size_t size = range.mCount * elementSize;
+			memcpy(static_cast<uint8*>(mapped_memory) + offset, static_cast<const uint8*>(data) + offset, size);
+			outSize += static_cast<uint32>(size);
+		}
+		vmaUnmapMemory(allocator, buffer.mAllocation);
+		return true;
+	}
+
+
 	void nap::BufferData::release()
 	{
 		mAllocation = VK_NULL_HANDLE;
@@ -12,6 +12,7 @@
 
 // Local Includes
 #include "vk_mem_alloc.h"
+#include "dirtyranges.h"
 
 namespace nap
 {
@@ -95,4 +96,11 @@ namespace nap
 	 * Uploads data into a staging buffer
 	 */
 	bool NAPAPI uploadToBuffer(VmaAllocator allocator, uint32 size, void* data, BufferData& buffer);
+
+	/**
+	 * Uploads the given element ranges into a buffer, the memory is mapped only once.
+	 * Ranges are specified in elements, the data is copied to the same offset in the buffer.
+	 * Returns the number of uploaded bytes in outSize.
+	 */
+	bool NAPAPI uploadToBuffer(VmaAllocator allocator, uint32 elementSize, const DirtyRanges& ranges, void* data, BufferData& buffer, uint32& outSize);
 }
@@ -9,6 +9,7 @@
 
 // External Includes
 #include <mathutils.h>
+#include <randomgenerator.h>
 #include <nap/core.h>
 
 // nap::scatterpointsmesh run time class definition 
@@ -185,12 +186,19 @@ namespace nap
 		TriangleAreaMap area_map;
 		float total_area = computeArea(area_map);
 
+		// Generate all random numbers up front, used for placement and barycentric coordinates
+		std::vector<float> rnumbers(mNumberOfPoints);
+		std::vector<glm::vec2> rvectors(mNumberOfPoints);
+		math::RandomGenerator& generator = math::getRandomGenerator();
+		generator.fill(rnumbers.data(), mNumberOfPoints, 0.0f, total_area);
+		generator.fill(rvectors.data(), mNumberOfPoints, { 0.0f, 0.0f }, { 1.0f, 1.0f });
+
 		// Scatter points randomly
 		for (int i = 0; i < mNumberOfPoints; i++)
 		{
-			// Generate random number for point
+			// Random number for point
 			// Used for placement
-			float rnumber = math::random<float>(0.0f, total_area);
+			float rnumber = rnumbers[i];
 
 			auto it = area_map.lower_bound(rnumber);
 			assert(it != area_map.end());
@@ -200,7 +208,7 @@ namespace nap
 			nap::TriangleData<glm::vec3> tri_pos = triangle.getVertexData<glm::vec3>(*ref_pos);
 
 			// Extract colors for triangle
-			glm::vec2 rand_v = math::random<glm::vec2>({ 0.0f, 0.0f }, {1.0f, 1.0f});
+			glm::vec2 rand_v = rvectors[i];
 			if (rand_v.x + rand_v.y >= 1)
 			{
 				rand_v.x = 1.0f - rand_v.x;
@@ -45,6 +45,16 @@ namespace nap
 	{
 	}
 
+
+	void BaseVertexAttribute::setDirtyTracking(bool enable)
+	{
+		// Start with everything dirty, the GPU buffer might not hold the latest data
+		mDirtyTracking = enable;
+		mDirtyRanges.clear();
+		if (enable)
+			mDirtyRanges.addAll();
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 
 	template<>
@@ -4,8 +4,10 @@
 
 #pragma once
 
+#include "dirtyranges.h"
 #include <utility/dllexport.h>
 #include <nap/resource.h>
+#include <nap/numeric.h>
 #include <glm/glm.hpp>
 #include "vulkan/vulkan_core.h"
 
@@ -47,7 +49,68 @@ namespace nap
 		 */
 		virtual void reserve(size_t numElements) = 0;
 
+		/**
+		 * Enables or disables dirty tracking. Dirty tracking is disabled by default, in which case
+		 * the entire attribute is uploaded on every MeshInstance::update(). When enabled, only the ranges
+		 * marked dirty are uploaded and attributes without dirty ranges are skipped entirely.
+		 * Changing the number of elements using setData(), addData(), resize() or clear() marks the entire attribute dirty.
+		 * Edits through getData(), mData or the subscript operator are not tracked, call markDirty() after those edits.
+		 * @param enable if dirty tracking is enabled
+		 */
+		void setDirtyTracking(bool enable);
+
+		/**
+		 * @return if dirty tracking is enabled
+		 */
+		bool getDirtyTracking() const							{ return mDirtyTracking; }
+
+		/**
+		 * Marks a range of elements as changed. The range is only recorded when dirty tracking is enabled,
+		 * the version of the attribute is always incremented.
+		 * @param first the first element that changed
+		 * @param count the number of elements that changed
+		 */
+		void markDirty(size_t first, size_t count)				{ mVersion++; if (mDirtyTracking) mDirtyRanges.add(first, count); }
+
+		/**
+		 * Marks all elements as changed. The range is only recorded when dirty tracking is enabled,
+		 * the version of the attribute is always incremented.
+		 */
+		void markDirty()										{ mVersion++; if (mDirtyTracking) mDirtyRanges.addAll(); }
+
+		/**
+		 * Returns a number that changes whenever the data of the attribute might have changed.
+		 * The version is incremented when the data is changed using setData(), addData(), resize() or clear(),
+		 * when the data is acquired for writing using getData() or the subscript operator and when the attribute is marked dirty.
+		 * Writes to mData are not detected, call markDirty() after those edits.
+		 * Use it to find out if data derived from the attribute is out of date.
+		 * @return the version of the attribute data
+		 */
+		uint64 getVersion() const								{ return mVersion; }
+
+		/**
+		 * @return if there are elements that changed since the last upload, always true when dirty tracking is disabled.
+		 */
+		bool isDirty() const									{ return !mDirtyTracking || !mDirtyRanges.empty(); }
+
+		/**
+		 * @return all ranges that changed since the last upload
+		 */
+		const DirtyRanges& getDirtyRanges() const				{ return mDirtyRanges; }
+
+		/**
+		 * Clears all dirty ranges, called by the mesh after upload.
+		 */
+		void clearDirty()										{ mDirtyRanges.clear(); }
+
 		std::string			mAttributeID;		///< Name/ID of the attribute
+
+	private:
+		DirtyRanges			mDirtyRanges;					///< Ranges that changed since the last upload
+		bool				mDirtyTracking = false;			///< If changes are tracked
+
+	protected:
+		uint64				mVersion = 0;					///< Incremented when the data might have changed
 	};
 
 
@@ -80,12 +143,12 @@ namespace nap
 		 * Resizes the data container to hold the given number of elements.
 		 * @param numElements the new number of elements.
 		 */
-		void resize(size_t numElements)							{ mData.resize(numElements); }
+		void resize(size_t numElements)							{ mData.resize(numElements); markDirty(); }
 
 		/**
 		 * Clears all data associated with this attribute
 		 */
-		void clear()											{ mData.clear(); }
+		void clear()											{ mData.clear(); markDirty(); }
 
 		/**
 		* @return Types interface toward the internal values. Use this function to read CPU data.
@@ -95,13 +158,13 @@ namespace nap
 		/**
 		* @return Types interface toward the internal values. Use this function to read CPU data.
 		*/
-		std::vector<ELEMENTTYPE>& getData()						{ return mData; }
+		std::vector<ELEMENTTYPE>& getData()						{ mVersion++; return mData; }
 
 		/**
 		 * Adds a single element to the end of the buffer. Data is copied.
 		 * @param element to add.
 		 */
-		void addData(const ELEMENTTYPE& element)				{ mData.emplace_back(element); }
+		void addData(const ELEMENTTYPE& element)				{ mData.emplace_back(element); markDirty(); }
 
 		/**
 		 * Adds data to the existing data in the buffer. Data is copied.
@@ -135,7 +198,7 @@ namespace nap
 		 * @param index the index of the attribute value
 		 * @return the vertex attribute value at index
 		 */
-		ELEMENTTYPE& operator[](std::size_t index)				{ return mData[index]; }
+		ELEMENTTYPE& operator[](std::size_t index)				{ mVersion++; return mData[index]; }
 		
 		/**
 		 * Const array subscript overload
@@ -177,6 +240,7 @@ namespace nap
 	{
 		mData.resize(numElements);
 		memcpy(mData.data(), elements, numElements * sizeof(ELEMENTTYPE));
+		markDirty();
 	}
 
 	template<typename ELEMENTTYPE>
@@ -185,6 +249,7 @@ namespace nap
 		int cur_num_elements = mData.size();
 		mData.resize(cur_num_elements + numElements);
 		memcpy((void*)&mData[cur_num_elements], elements, numElements * sizeof(ELEMENTTYPE));
+		markDirty();
 	}
 
 	template<typename ELEMENTTYPE>
@@ -47,4 +47,11 @@ namespace nap
 		return setDataInternal(data, mVertexSize, numVertices, reservedNumVertices, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,  error);
 	}
 
+
+	// Uploads the changed ranges of the data block to the GPU
+	bool VertexBuffer::setData(void* data, size_t numVertices, size_t reservedNumVertices, const DirtyRanges& ranges, utility::ErrorState& error)
+	{
+		return setDataInternal(data, mVertexSize, numVertices, reservedNumVertices, ranges, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, error);
+	}
+
 } // opengl
\ No newline at end of file
@@ -55,6 +55,18 @@ namespace nap
 		 */
 		bool setData(void* data, size_t numVertices, size_t reservedNumVertices, utility::ErrorState& error);
 
+		/**
+		 * Uploads only the vertex ranges that changed to the GPU.
+		 * The entire buffer is uploaded when the number of vertices changed or new GPU memory is allocated.
+		 * @param data pointer to the block of data that contains all vertices, not only the changed ranges.
+		 * @param numVertices number of vertices represented by data.
+		 * @param reservedNumVertices used to calculate final buffer size, needs to be >= numVertices
+		 * @param ranges the vertex ranges that changed since the previous upload
+		 * @param error contains the error if upload operation failed
+		 * @return if upload succeeded
+		 */
+		bool setData(void* data, size_t numVertices, size_t reservedNumVertices, const DirtyRanges& ranges, utility::ErrorState& error);
+
 	private:
 		VkFormat		mFormat;
 		int				mVertexSize			= -1;
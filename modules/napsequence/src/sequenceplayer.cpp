@@ -8,6 +8,7 @@
 
 // nap include
 #include <nap/logger.h>
+#include <nap/profiler.h>
 #include <parametervec.h>
 #include <parameternumeric.h>
 
@@ -302,6 +303,7 @@ namespace nap
 		// Compute sleep time in microseconds 
 		float sleep_time_microf = 1000.0f / static_cast<float>(mFrequency);
 		long  sleep_time_micro = static_cast<long>(sleep_time_microf * 1000.0f);
+		Profiler::setThreadName("sequence player");
 
 		while (mUpdateThreadRunning)
 		{
@@ -312,6 +314,8 @@ namespace nap
 			mBefore = now;
 
 			{
+				NAP_PROFILE_SCOPE("SequencePlayer::onUpdate")
+
 				// lock
 				auto lock = std::unique_lock<std::mutex>(mMutex);
 
@@ -19,25 +19,13 @@ namespace nap
 {
 	//////////////////////////////////////////////////////////////////////////
 
-	/**
-	 * Base class for curve adapters
-	 * setValue must be called from main thread to set value of parameter on main thread
-	 */
-	class SequencePlayerCurveAdapterBase : public SequencePlayerAdapter
-	{
-		friend class SequencePlayerCurveOutput;
-	private:
-		virtual void setValue() = 0;
-	};
-
 	/**
 	 * Responsible for translating the value read on a curve track, to a parameter
-	 * When the user wants to do this on the main thread, it uses a SequencePlayerCurveOutput as an intermediate class to ensure thread safety,
-	 * SequencePlayerCurveOutput will then call setValue()
+	 * When the user wants to do this on the main thread, the value is staged on the parameter and committed by the nap::ParameterService,
 	 * otherwise it sets the parameter value directly from the sequence player thread
 	 */
 	template<typename CURVE_TYPE, typename PARAMETER_TYPE, typename PARAMETER_VALUE_TYPE>
-	class SequencePlayerCurveAdapter : public SequencePlayerCurveAdapterBase
+	class SequencePlayerCurveAdapter : public SequencePlayerAdapter
 	{
 	public:
 		/**
@@ -46,29 +34,20 @@ namespace nap
 		 * @param output reference to curve output
 		 */
 		SequencePlayerCurveAdapter(SequenceTrack& track, SequencePlayerCurveOutput& output)
-			:	mParameter(static_cast<PARAMETER_TYPE&>(*output.mParameter.get())), mOutput(output)
+			:	mParameter(static_cast<PARAMETER_TYPE&>(*output.mParameter.get()))
 		{
 			assert(track.get_type().is_derived_from(RTTI_OF(SequenceTrackCurve<CURVE_TYPE>)));
 			mTrack = static_cast<SequenceTrackCurve<CURVE_TYPE>*>(&track);
 
-			if (mOutput.mUseMainThread)
+			if (output.mUseMainThread)
 			{
 				mSetFunction = &SequencePlayerCurveAdapter::storeParameterValue;
-				mOutput.registerAdapter(this);
 			}else
 			{
 				mSetFunction = &SequencePlayerCurveAdapter::setParameterValue;
 			}
 		}
 
-		/**
-		 * Deconstructor
-		 */
-		virtual ~SequencePlayerCurveAdapter()
-		{
-			mOutput.removeAdapter(this);
-		}
-
 		/**
 		 * called from sequence player thread
 		 * @param time time in sequence player
@@ -97,15 +76,6 @@ namespace nap
 			}
 		}
 	private:
-		/**
-		 * setValue gets called from main thread and sets the parameter value
-		 */
-		virtual void setValue() override
-		{
-			std::unique_lock<std::mutex> l(mMutex);
-			mParameter.setValue(mStoredValue);
-		}
-
 		/**
 		 * Directly sets parameter value, not thread safe
 		 * @param value the value
@@ -116,21 +86,18 @@ namespace nap
 		}
 
 		/**
-		 * Uses SequencePlayerCurveOutput  to set parameter value, value will be set from main thread with function setValue(), thread safe
+		 * Stages the parameter value, thread safe and lock free.
+		 * Staged values are committed on the main thread by the nap::ParameterService, together with the other parameters of the group.
 		 * @param value the value
 		 */
 		void storeParameterValue(PARAMETER_VALUE_TYPE& value)
 		{
-			std::unique_lock<std::mutex> l(mMutex);
-			mStoredValue = value;
+			mParameter.stageValue(value);
 		}
 
 		PARAMETER_TYPE&									mParameter;
 		SequenceTrackCurve<CURVE_TYPE>*					mTrack;
 		bool											mUseMainThread;
-		SequencePlayerCurveOutput&						mOutput;
-		std::mutex										mMutex;
-		PARAMETER_VALUE_TYPE							mStoredValue;
 
 		void (SequencePlayerCurveAdapter::*mSetFunction)(PARAMETER_VALUE_TYPE& value);
 	};
@@ -4,7 +4,6 @@
 
 #include "sequenceplayercurveoutput.h"
 #include "sequenceservice.h"
-#include "sequenceplayercurveadapter.h"
 
 #include <nap/logger.h>
 
@@ -26,41 +25,4 @@ namespace nap
 	{
 	}
 
-
-	void SequencePlayerCurveOutput::update(double deltaTime)
-	{
-		for(auto* curve_adapter : mAdapters)
-		{
-			curve_adapter->setValue();
-		}
-	}
-
-
-	void SequencePlayerCurveOutput::registerAdapter(SequencePlayerCurveAdapterBase* curveAdapter)
-	{
-		auto found_it = std::find_if(mAdapters.begin(), mAdapters.end(), [&](const auto& it)
-		{
-		  return it == curveAdapter;
-		});
-		assert(found_it == mAdapters.end()); // duplicate entry
-
-		if(found_it == mAdapters.end())
-		{
-			mAdapters.emplace_back(curveAdapter);
-		}
-	}
-
-
-	void SequencePlayerCurveOutput::removeAdapter(SequencePlayerCurveAdapterBase* curveAdapter)
-	{
-		auto found_it = std::find_if(mAdapters.begin(), mAdapters.end(), [&](const auto& it)
-		{
-			return it == curveAdapter;
-		});
-
-		if(found_it != mAdapters.end())
-		{
-			mAdapters.erase(found_it);
-		}
-	}
 }
\ No newline at end of file
@@ -16,7 +16,6 @@ namespace nap
 	//////////////////////////////////////////////////////////////////////////
 
 	// forward declares
-	class SequencePlayerCurveAdapterBase;
 	class SequenceService;
 
 	/**
@@ -31,28 +30,6 @@ namespace nap
 		// properties
 		ResourcePtr<Parameter>	mParameter; 	///< Property: 'Parameter' parameter resource
 		bool					mUseMainThread; ///< Property: 'Use Main Thread' update in main thread or player thread
-
-		/**
-		 * registers a parameter setter to the output. Parameter setters are called from main thread
-		 * @param curveAdapter adapter to register
-		 */
-		void registerAdapter(SequencePlayerCurveAdapterBase* curveAdapter);
-
-		/**
-		 * removes parameter setter
-		 * @param curveAdapter ptr to parameter setter
-		 */
-		void removeAdapter(SequencePlayerCurveAdapterBase* curveAdapter);
-
-	protected:
-		/**
-		 * called from update loop sequence service main thread
-		 * @param deltaTime time since last update
-		 */
-		virtual void update(double deltaTime) override ;
-
-		// vector holding registered parameter setters
-		std::vector<SequencePlayerCurveAdapterBase*> mAdapters;
 	private:
 
 	};
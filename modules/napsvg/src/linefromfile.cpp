@@ -17,6 +17,13 @@
 #include <nap/logger.h>
 #include <nap/core.h>
 #include <renderglobals.h>
+#include <nap/datetime.h>
+#include <utility/fileutils.h>
+#include <utility/threading.h>
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 
 RTTI_BEGIN_ENUM(nap::ESVGUnits)
 	RTTI_ENUM_VALUE(nap::ESVGUnits::PX,		"px"),
@@ -33,6 +40,7 @@ RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::LineFromFile)
 	RTTI_PROPERTY("Units",				&nap::LineFromFile::mUnits,		nap::rtti::EPropertyMetaData::Default)
 	RTTI_PROPERTY("DPI",				&nap::LineFromFile::mDPI,		nap::rtti::EPropertyMetaData::Default)
 	RTTI_PROPERTY("Tolerance",			&nap::LineFromFile::mTolerance, nap::rtti::EPropertyMetaData::Default)
+	RTTI_PROPERTY("ScreenSize",			&nap::LineFromFile::mScreenSize, nap::rtti::EPropertyMetaData::Default)
 	RTTI_PROPERTY("Normalize",			&nap::LineFromFile::mNormalize,	nap::rtti::EPropertyMetaData::Default)
 	RTTI_PROPERTY("Scale",				&nap::LineFromFile::mScale,		nap::rtti::EPropertyMetaData::Default)
 	RTTI_PROPERTY("FlipHorizontal",		&nap::LineFromFile::mFlipX,		nap::rtti::EPropertyMetaData::Default)
@@ -40,6 +48,13 @@ RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::LineFromFile)
 	RTTI_PROPERTY("LineIndex",			&nap::LineFromFile::mLineIndex,	nap::rtti::EPropertyMetaData::Default)
 RTTI_END_CLASS
 
+// Maximum number of times a curve segment is subdivided
+static constexpr int maxCurveLevel = 12;
+
+// Minimum number of paths handled by a single task when flattening paths in parallel
+static constexpr int minPathsPerTask = 32;
+
+
 /**
  *	Calculates the distance of a point to a specific segment on the line
  */
@@ -63,138 +78,281 @@ static float distPtSeg(float x, float y, float px, float py, float qx, float qy)
 
 /**
  *	Cubic spline bezier implementation
+ *	Segments are subdivided until the curve is within tolerance of the chord. The curve never deviates more than
+ *	3/4 of the furthest control point distance from the chord, which is used as flatness test. Unlike testing the
+ *	midpoint this also holds for s-shaped segments. Strongly curved parts are subdivided more than flat parts.
+ *	Uses an explicit stack instead of recursion, the end point of every flat segment is added to the vertices.
  */
 static void cubicBez(float x1, float y1, float x2, float y2,
 	float x3, float y3, float x4, float y4,
-	float tol, int level, std::vector<glm::vec3>& vertices)
+	float tol, std::vector<glm::vec3>& vertices)
 {
-	float x12, y12, x23, y23, x34, y34, x123, y123, x234, y234, x1234, y1234;
-	float d;
-
-	if (level > 12) return;
-
-	x12		= (x1 + x2)		* 0.5f;
-	y12		= (y1 + y2)		* 0.5f;
-	x23		= (x2 + x3)		* 0.5f;
-	y23		= (y2 + y3)		* 0.5f;
-	x34		= (x3 + x4)		* 0.5f;
-	y34		= (y3 + y4)		* 0.5f;
-	x123	= (x12 + x23)	* 0.5f;
-	y123	= (y12 + y23)	* 0.5f;
-	x234	= (x23 + x34)	* 0.5f;
-	y234	= (y23 + y34)	* 0.5f;
-	x1234	= (x123 + x234) * 0.5f;
-	y1234	= (y123 + y234) * 0.5f;
-
-	d = distPtSeg(x1234, y1234, x1, y1, x4, y4);
-	if (d > tol*tol) 
+	struct Segment
 	{
-		cubicBez(x1, y1, x12, y12, x123, y123, x1234, y1234, tol, level + 1, vertices);
-		cubicBez(x1234, y1234, x234, y234, x34, y34, x4, y4, tol, level + 1, vertices);
-	}
-	else 
+		float x1, y1, x2, y2, x3, y3, x4, y4;
+		int level;
+	};
+
+	// Depth first: every subdivision replaces a segment with two, at most one pending segment per level
+	Segment stack[maxCurveLevel + 2];
+	int size = 0;
+	stack[size++] = { x1, y1, x2, y2, x3, y3, x4, y4, 0 };
+	float max_dist = (tol * tol) / (0.75f * 0.75f);
+
+	while (size > 0)
 	{
-		vertices.emplace_back(glm::vec3(x4, y4, 0.0f));
+		Segment s = stack[--size];
+		float d = nap::math::max<float>(distPtSeg(s.x2, s.y2, s.x1, s.y1, s.x4, s.y4), distPtSeg(s.x3, s.y3, s.x1, s.y1, s.x4, s.y4));
+		if (d <= max_dist || s.level >= maxCurveLevel)
+		{
+			vertices.emplace_back(glm::vec3(s.x4, s.y4, 0.0f));
+			continue;
+		}
+
+		float x12	= (s.x1 + s.x2)	* 0.5f;
+		float y12	= (s.y1 + s.y2)	* 0.5f;
+		float x23	= (s.x2 + s.x3)	* 0.5f;
+		float y23	= (s.y2 + s.y3)	* 0.5f;
+		float x34	= (s.x3 + s.x4)	* 0.5f;
+		float y34	= (s.y3 + s.y4)	* 0.5f;
+		float x123	= (x12 + x23)	* 0.5f;
+		float y123	= (y12 + y23)	* 0.5f;
+		float x234	= (x23 + x34)	* 0.5f;
+		float y234	= (y23 + y34)	* 0.5f;
+		float x1234	= (x123 + x234) * 0.5f;
+		float y1234	= (y123 + y234) * 0.5f;
+
+		// Second half is pushed first so the first half is flattened first
+		stack[size++] = { x1234, y1234, x234, y234, x34, y34, s.x4, s.y4, s.level + 1 };
+		stack[size++] = { s.x1, s.y1, x12, y12, x123, y123, x1234, y1234, s.level + 1 };
 	}
 }
 
 
-static void extractPathVertices(float* pts, int npts, char closed, float tol, std::vector<glm::vec3>& vertices)
+static void extractPathVertices(float* pts, int npts, float tol, std::vector<glm::vec3>& vertices)
 {
 	int i;
 	vertices.emplace_back(glm::vec3(pts[0], pts[1], 0.0f));
 	for (i = 0; i < npts - 1; i += 3) 
 	{
 		float* p = &pts[i * 2];
-		cubicBez(p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7], tol, 0, vertices);
+		cubicBez(p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7], tol, vertices);
+	}
+}
+
+
+/**
+ *	Flattens a path and appends the vertices. Points that are exactly the same as the previous point are discarded,
+ *	as is the last point of a closed path when it is the same as the first point.
+ *	@return the number of appended vertices
+ */
+static nap::uint32 flattenPath(const NSVGpath& path, float tol, std::vector<glm::vec3>& vertices)
+{
+	size_t first = vertices.size();
+	extractPathVertices(path.pts, path.npts, tol, vertices);
+
+	auto end = std::unique(vertices.begin() + first, vertices.end(), [](const glm::vec3& a, const glm::vec3& b)
+	{
+		return glm::distance(a, b) <= nap::math::epsilon<float>();
+	});
+	vertices.erase(end, vertices.end());
+
+	if (path.closed > 0 && vertices.size() - first > 1 && glm::distance(vertices[first], vertices.back()) <= nap::math::epsilon<float>())
+		vertices.pop_back();
+	return static_cast<nap::uint32>(vertices.size() - first);
+}
+
+
+/**
+ *	Computes the normals of a single line, perpendicular to the direction of the line in the x, y plane
+ */
+static void computeLineNormals(const glm::vec3* positions, int count, bool closed, glm::vec3* normals)
+{
+	// The normal to rotage against 
+	glm::vec3 crossn(0.0f, 0.0f, -1.0f);
+
+	// Calculate the normal based on the previous and next vertex
+	for (int i = 1; i < count - 1; i++)
+	{
+		// Get vector pointing to next and previous vertex
+		glm::vec3 dnormal_one = glm::normalize(positions[i + 1] - positions[i]);
+		glm::vec3 dnormal_two = glm::normalize(positions[i] - positions[i - 1]);
+
+		// Rotate around z using cross product
+		normals[i] = glm::cross(glm::normalize(nap::math::lerp<glm::vec3>(dnormal_one, dnormal_two, 0.5f)), crossn);
+	}
+
+	// Closed shapes need to wrap the first and last vertex
+	const glm::vec3& front = positions[0];
+	const glm::vec3& back = positions[count - 1];
+	if (closed)
+	{
+		// First normal
+		glm::vec3 dnormal_one = glm::normalize(positions[1] - front);
+		glm::vec3 dnormal_two = glm::normalize(front - back);
+		normals[0] = glm::cross(nap::math::lerp<glm::vec3>(dnormal_one, dnormal_two, 0.5f), crossn);
+
+		// Last normal
+		dnormal_one = glm::normalize(front - back);
+		dnormal_two = glm::normalize(back - positions[count - 2]);
+		normals[count - 1] = glm::cross(nap::math::lerp<glm::vec3>(dnormal_one, dnormal_two, 0.5f), crossn);
+	}
+	// Otherwise the first vertex uses the next position and the last one the previous
+	else
+	{
+		normals[0] = glm::cross(glm::normalize(positions[1] - front), crossn);
+		normals[count - 1] = normals[count - 2];
 	}
 }
 
 
 namespace nap
 {
-	LineFromFile::LineFromFile(nap::Core& core) : PolyLine(core)
-	{}
+	// Flattened paths by file and settings, an entry expires when no resource uses the paths anymore
+	static std::unordered_map<std::string, std::weak_ptr<const LineFromFile::SVGPaths>> pathCache;
+	static std::mutex pathCacheMutex;
 
 
-	bool LineFromFile::init(utility::ErrorState& errorState)
+	/**
+	 * Flattens all paths of an image, consecutive ranges of paths are flattened in parallel.
+	 */
+	static bool flattenPaths(const NSVGimage& image, float tolerance, float screenSize, LineFromFile::SVGPaths& outPaths, const std::string& file, utility::ErrorState& errorState)
 	{
-		if (!PolyLine::init(errorState))
-			return false;
+		// Gather all paths and compute the bounds of the image
+		std::vector<const NSVGpath*> paths;
+		math::Rect& svg_rect = outPaths.mBounds;
+		svg_rect = math::Rect(glm::vec2(math::max<float>(), math::max<float>()), glm::vec2(math::min<float>(), math::min<float>()));
+		for (NSVGshape* shape = image.shapes; shape != nullptr; shape = shape->next)
+		{
+			for (NSVGpath* path = shape->paths; path != nullptr; path = path->next)
+			{
+				svg_rect.mMinPosition.x = math::min<float>(svg_rect.mMinPosition.x, path->bounds[0]);
+				svg_rect.mMinPosition.y = math::min<float>(svg_rect.mMinPosition.y, path->bounds[1]);
+				svg_rect.mMaxPosition.x = math::max<float>(svg_rect.mMaxPosition.x, path->bounds[2]);
+				svg_rect.mMaxPosition.y = math::max<float>(svg_rect.mMaxPosition.y, path->bounds[3]);
+				outPaths.mClosed.emplace_back(path->closed > 0);
+				paths.emplace_back(path);
+			}
+		}
+
+		// Convert a tolerance in pixels into svg units
+		float tol = tolerance;
+		if (screenSize > 0.0f)
+			tol = tolerance * math::max<float>(svg_rect.getWidth(), svg_rect.getHeight()) / screenSize;
+
+		// Every task flattens a consecutive range of paths into its own buffer
+		int path_count = static_cast<int>(paths.size());
+		int task_count = math::max<int>(math::min<int>(std::thread::hardware_concurrency(), path_count / minPathsPerTask), 1);
+		std::unique_ptr<ThreadPool> thread_pool = task_count > 1 ? std::make_unique<ThreadPool>(task_count - 1, task_count) : nullptr;
+		std::vector<std::vector<glm::vec3>> task_vertices(task_count);
+		std::vector<uint32> counts(path_count);
+		parallelFor(path_count, task_count, thread_pool.get(), [&](int task, int begin, int end)
+		{
+			for (int i = begin; i < end; i++)
+				counts[i] = flattenPath(*paths[i], tol, task_vertices[task]);
+		});
+
+		// Make sure every path has enough vertices to create a segment
+		for (auto count : counts)
+		{
+			if (!errorState.check(count >= 2, "not enough unique vertices in line from file: %s", file.c_str()))
+				return false;
+		}
+
+		// Concatenate the task buffers, the ranges are consecutive so the paths remain in order
+		outPaths.mOffsets.resize(path_count + 1, 0);
+		for (int i = 0; i < path_count; i++)
+			outPaths.mOffsets[i + 1] = outPaths.mOffsets[i] + counts[i];
+
+		outPaths.mVertices.reserve(outPaths.mOffsets.back());
+		for (const auto& vertices : task_vertices)
+			outPaths.mVertices.insert(outPaths.mVertices.end(), vertices.begin(), vertices.end());
+		return true;
+	}
 
-		// Append . before trying to load relative paths
-		std::string img_path = mFile;
-		if (utility::startsWith(img_path, "/"))
-			img_path = utility::stringFormat(".%s", img_path.c_str());
 
-		// Convert the enum to a string for loading
-		rtti::Variant var = mUnits;
+	/**
+	 * Appends . to absolute paths, nanosvg loads them relative to the working directory
+	 */
+	static std::string getImagePath(const std::string& file)
+	{
+		return utility::startsWith(file, "/") ? utility::stringFormat(".%s", file.c_str()) : file;
+	}
+
+
+	/**
+	 * Converts units to the string nanosvg expects
+	 */
+	static std::string getUnitsName(ESVGUnits units)
+	{
+		rtti::Variant var = units;
 		bool conversion_succeeded;
-		std::string units = var.to_string(&conversion_succeeded);
+		std::string name = var.to_string(&conversion_succeeded);
 		assert(conversion_succeeded);
+		return name;
+	}
 
-		NSVGimage* new_image = nsvgParseFromFile(img_path.c_str(), units.c_str(), mDPI);
-		if (!errorState.check(new_image != nullptr, "unable to load image: %s", img_path.c_str()))
-			return false;
 
-		// Make sure the image contains a shape
-		if (!errorState.check(new_image->shapes != nullptr, "image has no shapes: %s", img_path.c_str()))
-			return false;
+	LineFromFile::LineFromFile(nap::Core& core) : PolyLine(core)
+	{}
 
-		// Make sure that shape contains a path
-		if (!errorState.check(new_image->shapes->paths != nullptr, "image has no paths: %s", img_path.c_str()))
-			return false;
 
-		// Container that holds all extracted paths and if they're closed
-		SVGPaths extracted_paths;
-		SVGState states;
+	bool LineFromFile::loadPaths(const std::string& file, ESVGUnits units, float dpi, float tolerance, float screenSize, SVGPaths& outPaths, utility::ErrorState& errorState)
+	{
+		std::string img_path = getImagePath(file);
+		NSVGimage* new_image = nsvgParseFromFile(img_path.c_str(), getUnitsName(units).c_str(), dpi);
+		if (!errorState.check(new_image != nullptr, "unable to load image: %s", img_path.c_str()))
+			return false;
 
-		// Rectangle that is used to compute final image bounds
-		math::Rect svg_rect(glm::vec2(math::max<float>(), math::max<float>()), glm::vec2(math::min<float>(), math::min<float>()));
+		// Make sure the image contains a shape with a path
+		bool has_paths = errorState.check(new_image->shapes != nullptr, "image has no shapes: %s", img_path.c_str()) &&
+			errorState.check(new_image->shapes->paths != nullptr, "image has no paths: %s", img_path.c_str());
 
-		// Extract all paths
-		NSVGshape* current_shape = new_image->shapes;
-		while (current_shape != nullptr) 
-		{
-			NSVGpath* current_path = current_shape->paths;
-			while (current_path != nullptr)
-			{
-				// Extract vertices from current path based on threshold value
-				std::unique_ptr<std::vector<glm::vec3>> path_vertices = std::make_unique<std::vector<glm::vec3>>();
-				extractPathVertices(current_path->pts, current_path->npts, current_path->closed, mTolerance, *path_vertices);
+		// Extract all paths and delete the image
+		bool flattened = has_paths && flattenPaths(*new_image, tolerance, screenSize, outPaths, file, errorState);
+		nsvgDelete(new_image);
+		return flattened;
+	}
 
-				// Expand bounds of rectangle
-				if (current_path->bounds[0] < svg_rect.mMinPosition.x)
-					svg_rect.mMinPosition.x = current_path->bounds[0];
 
-				if (current_path->bounds[1] < svg_rect.mMinPosition.y)
-					svg_rect.mMinPosition.y = current_path->bounds[1];
+	bool LineFromFile::init(utility::ErrorState& errorState)
+	{
+		if (!PolyLine::init(errorState))
+			return false;
 
-				if (current_path->bounds[2] > svg_rect.mMaxPosition.x)
-					svg_rect.mMaxPosition.x = current_path->bounds[2];
+		// Paths are shared based on the file, its modification time and all settings that affect flattening
+		std::string img_path = getImagePath(mFile);
+		uint64 mod_time = 0;
+		utility::getFileModificationTime(img_path, mod_time);
+		std::string cache_key = utility::stringFormat("%s|%llu|%s|%f|%f|%f", utility::getAbsolutePath(img_path).c_str(),
+			static_cast<unsigned long long>(mod_time), getUnitsName(mUnits).c_str(), mDPI, mTolerance, mScreenSize);
+		{
+			std::lock_guard<std::mutex> lock(pathCacheMutex);
+			auto it = pathCache.find(cache_key);
+			if (it != pathCache.end())
+				mPaths = it->second.lock();
+		}
 
-				if (current_path->bounds[3] > svg_rect.mMaxPosition.y)
-					svg_rect.mMaxPosition.y = current_path->bounds[3];
+		if (mPaths == nullptr)
+		{
+			auto start = HighResolutionClock::now();
+			auto paths = std::make_shared<SVGPaths>();
+			if (!loadPaths(mFile, mUnits, mDPI, mTolerance, mScreenSize, *paths, errorState))
+				return false;
 
-				// Add path to container
-				extracted_paths.emplace_back(std::move(path_vertices));
-				bool is_closed = current_path->closed > 0;
-				states.emplace_back(is_closed);
+			Logger::debug("%s: flattened %d paths into %d vertices in %.2f ms", mID.c_str(), static_cast<int>(paths->mClosed.size()),
+				static_cast<int>(paths->mVertices.size()), std::chrono::duration<double, std::milli>(HighResolutionClock::now() - start).count());
 
-				// Cycle to next one
-				current_path = current_path->next;
-			}
-			// Cycle to next shape
-			current_shape = current_shape->next;
+			// Share the paths, removing expired entries
+			std::lock_guard<std::mutex> lock(pathCacheMutex);
+			for (auto it = pathCache.begin(); it != pathCache.end();)
+				it = it->second.expired() ? pathCache.erase(it) : std::next(it);
+			pathCache[cache_key] = paths;
+			mPaths = std::move(paths);
 		}
 
 		// Extract all the lines
-		if (!extractLinesFromPaths(extracted_paths, states, svg_rect, errorState))
-			return false;
-
-		// Delete the image
-		nsvgDelete(new_image);
-		return true;
+		return extractLinesFromPaths(*mPaths, errorState);
 	}
 
 
@@ -212,8 +370,24 @@ namespace nap
 	}
 
 
-	bool LineFromFile::extractLinesFromPaths(const SVGPaths& paths, const SVGState& states, const math::Rect& rect, utility::ErrorState& errorState)
+	int LineFromFile::getLineVertexOffset(int lineIndex) const
+	{
+		assert(lineIndex < getLineCount());
+		return static_cast<int>(mLineOffsets[lineIndex]);
+	}
+
+
+	int LineFromFile::getLineVertexCount(int lineIndex) const
+	{
+		assert(lineIndex < getLineCount());
+		return static_cast<int>(mLineOffsets[lineIndex + 1] - mLineOffsets[lineIndex]);
+	}
+
+
+	bool LineFromFile::extractLinesFromPaths(const SVGPaths& paths, utility::ErrorState& errorState)
 	{
+		const math::Rect& rect = paths.mBounds;
+
 		// Calculate rectangle ratio
 		glm::vec2 ratio(1.0f, 1.0f);
 		if (rect.getWidth() < rect.getHeight())
@@ -245,136 +419,60 @@ namespace nap
 		float pos_y_min = mFlipY ? mNormalize ? 0.5f  : rect.mMaxPosition.y : mNormalize ? -0.5f : rect.mMinPosition.y;
 		float pos_y_max = mFlipY ? mNormalize ? -0.5f : rect.mMinPosition.y : mNormalize ? 0.5f	 : rect.mMaxPosition.y;
 
-		// Create a set of mesh instances based on those paths
-		mClosedStates.clear();
-		for (int path_index = 0; path_index != paths.size(); ++path_index)
+		// Calculate uv's first as they use the rect to figure out the normalized 0-1 coordinates
+		// After that compute the vertex position based on the scale 
+		int vertex_count = static_cast<int>(paths.mVertices.size());
+		std::vector<glm::vec3> uvs(vertex_count);
+		std::vector<glm::vec3> positions(vertex_count);
+		std::vector<glm::vec3> normals(vertex_count);
+		for (int i = 0; i < vertex_count; i++)
 		{
-			auto& path = paths[path_index];
-
-			// Also create uv's and normals based on path vertices
-			std::vector<glm::vec3> uvs;
-			std::vector<glm::vec3> normals;
-			std::vector<glm::vec3> positions;
-
-			// Resize
-			uvs.reserve(path->size());
-			positions.reserve(path->size());
+			const glm::vec3& vertex = paths.mVertices[i];
 
-			// Calculate uv's first as they use the rect to figure out the normalized 0-1 coordinates
-			// After that compute the vertex position based on the scale 
-			glm::vec3* previous_point = nullptr;
-			for (auto& vertex : *path)
-			{
-				// Discard points that are exactly the same as the previous point
-				if (previous_point != nullptr && glm::distance(*previous_point, vertex) <= nap::math::epsilon<float>())
-					continue;
-
-				// calculate vertex uv
-				float uv_x = nap::math::fit<float>(vertex.x, rect.mMinPosition.x, rect.mMaxPosition.x, uv_x_min, uv_x_max);
-				float uv_y = nap::math::fit<float>(vertex.y, rect.mMinPosition.y, rect.mMaxPosition.y, uv_y_min, uv_y_max);
-				uvs.emplace_back(glm::vec3(uv_x, uv_y, 0.0f));
-
-				// calculate vertex position
-				float pos_x = nap::math::fit<float>(vertex.x, rect.mMinPosition.x, rect.mMaxPosition.x, pos_x_min, pos_x_max) * scale.x;
-				float pos_y = nap::math::fit<float>(vertex.y, rect.mMinPosition.y, rect.mMaxPosition.y, pos_y_min, pos_y_max) * scale.y;
-				positions.emplace_back(glm::vec3(pos_x, pos_y, 0.0f));
-
-				// Store previous point
-				previous_point = &vertex;
-			}
-
-			// If the shape is closed but the first and end points are the same, we can discard the last point
-			assert(positions.size() > 0);
-			bool is_closed = states[path_index];
-			if (is_closed && glm::distance(positions.front(), positions.back()) <= math::epsilon<float>())
-			{
-				positions.pop_back();
-				uvs.pop_back();
-			}
-
-			// Make sure there's enough vertices to create a segment
-			if (!errorState.check(positions.size() >= 2, "not enough unique vertices in line from file: %s", mFile.c_str()))
-				return false;
-
-			// Now we have the final vertex positions of this line we can calculate their respective normals
-			if (positions.size() > 1)
-			{
-				// The normal to rotage against 
-				glm::vec3 crossn(0.0f, 0.0f, -1.0f);
-				
-				// Resize normal array to be size of vertices
-				normals.resize(positions.size());
-
-				// Calculate the normal based on the previous and next vertex
-				for (int i = 1; i < positions.size() - 1; i++)
-				{
-					// Get vector pointing to next and previous vertex
-					glm::vec3 dnormal_one = glm::normalize(positions[i + 1] - positions[i]);
-					glm::vec3 dnormal_two = glm::normalize(positions[i] - positions[i - 1]);
-
-					// Rotate around z using cross product
-					normals[i] = glm::cross(glm::normalize(math::lerp<glm::vec3>(dnormal_one, dnormal_two, 0.5f)), crossn);
-				}
-
-				// Closed shapes need to wrap the first and last vertex
-				if (is_closed)
-				{
-					// First normal
-					glm::vec3 dnormal_one = glm::normalize(positions[1] - positions.front());
-					glm::vec3 dnormal_two = glm::normalize(positions.front() - positions.back());
-					normals[0] = glm::cross(math::lerp<glm::vec3>(dnormal_one, dnormal_two, 0.5f), crossn);
-					
-					// Last normal
-					dnormal_one = glm::normalize(positions.front() - positions.back());
-					dnormal_two = glm::normalize(positions.back() - positions[positions.size() - 2]);
-
-					normals.back() = glm::cross(math::lerp<glm::vec3>(dnormal_one, dnormal_two, 0.5f), crossn);
-				}
-				// Otherwise the first vertex uses the next position and the last one the previous
-				else
-				{
-					normals[0] = glm::cross(glm::normalize(positions[1] - positions.front()), crossn);
-					normals.back() = normals[normals.size() - 2];
-				}
-			}
-			else
-			{
-				normals.front() = { 0,1.0,0.0 };
-			}
+			// calculate vertex uv
+			float uv_x = nap::math::fit<float>(vertex.x, rect.mMinPosition.x, rect.mMaxPosition.x, uv_x_min, uv_x_max);
+			float uv_y = nap::math::fit<float>(vertex.y, rect.mMinPosition.y, rect.mMaxPosition.y, uv_y_min, uv_y_max);
+			uvs[i] = glm::vec3(uv_x, uv_y, 0.0f);
 
-			addShape(is_closed, positions, normals, uvs);
-			mClosedStates.emplace_back(is_closed);
+			// calculate vertex position
+			float pos_x = nap::math::fit<float>(vertex.x, rect.mMinPosition.x, rect.mMaxPosition.x, pos_x_min, pos_x_max) * scale.x;
+			float pos_y = nap::math::fit<float>(vertex.y, rect.mMinPosition.y, rect.mMaxPosition.y, pos_y_min, pos_y_max) * scale.y;
+			positions[i] = glm::vec3(pos_x, pos_y, 0.0f);
 		}
 
-		mMeshInstance->setDrawMode(EDrawMode::LineStrip);
-		return mMeshInstance->init(errorState);
-	}
-
+		// Now we have the final vertex positions of every line we can calculate their respective normals
+		int line_count = static_cast<int>(paths.mClosed.size());
+		for (int line = 0; line < line_count; line++)
+		{
+			uint32 offset = paths.mOffsets[line];
+			int count = static_cast<int>(paths.mOffsets[line + 1] - offset);
+			computeLineNormals(positions.data() + offset, count, paths.mClosed[line], normals.data() + offset);
+		}
 
-	void LineFromFile::addShape(bool closed, std::vector<glm::vec3>& pathVertices, std::vector<glm::vec3>& pathNormals, std::vector<glm::vec3>& pathUvs)
-	{		
+		// Add all lines to the mesh in one go, every line is a separate shape
 		Vec3VertexAttribute& pos_attr = mMeshInstance->getAttribute<glm::vec3>(vertexid::position);
 		Vec3VertexAttribute& uvs_attr = mMeshInstance->getAttribute<glm::vec3>(vertexid::getUVName(0));
 		Vec4VertexAttribute& col_attr = mMeshInstance->getAttribute<glm::vec4>(vertexid::getColorName(0));
 		Vec3VertexAttribute& nor_attr = mMeshInstance->getAttribute<glm::vec3>(vertexid::normal);
 
-		int vertex_count = static_cast<int>(pathVertices.size());
-		// Set position buffer
-		pos_attr.addData(pathVertices.data(), pathVertices.size());
-
-		// Set color buffer
+		pos_attr.addData(positions.data(), positions.size());
+		nor_attr.addData(normals.data(), normals.size());
+		uvs_attr.addData(uvs.data(), uvs.size());
 		std::vector<glm::vec4> vert_colors(vertex_count, mLineProperties.mColor);
 		col_attr.addData(vert_colors.data(), vert_colors.size());
 
-		// Set normal buffer (todo implement)
-		nor_attr.addData(pathNormals.data(), pathNormals.size());
-
-		// Set uv buffer (todo implement)
-		uvs_attr.addData(pathUvs.data(), pathUvs.size());
+		int first_vertex = mMeshInstance->getNumVertices();
+		for (int line = 0; line < line_count; line++)
+		{
+			MeshShape& shape = mMeshInstance->createShape();
+			int count = static_cast<int>(paths.mOffsets[line + 1] - paths.mOffsets[line]);
+			utility::generateIndices(shape, count, false, first_vertex + static_cast<int>(paths.mOffsets[line]));
+		}
+		mMeshInstance->setNumVertices(first_vertex + vertex_count);
 
-		MeshShape& shape = mMeshInstance->createShape();
-		utility::generateIndices(shape, vertex_count, mMeshInstance->getNumVertices());
-		mMeshInstance->setNumVertices(mMeshInstance->getNumVertices() + vertex_count);
+		mClosedStates = paths.mClosed;
+		mLineOffsets = paths.mOffsets;
+		mMeshInstance->setDrawMode(EDrawMode::LineStrip);
+		return mMeshInstance->init(errorState);
 	}
-
-}
\ No newline at end of file
+}
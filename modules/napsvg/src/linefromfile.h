@@ -6,6 +6,7 @@
 
 #include <polyline.h>
 #include <rect.h>
+#include <memory>
 
 namespace nap
 {
@@ -26,7 +27,14 @@ namespace nap
 	/**
 	 * Resource that loads a set of lines from an svg file
 	 * Every line is converted in a polyline. The line vertex reolution can be changed using a difference tolerance value.
-	 * A lower tolerance results in less vertices. The uv's of the lines are normalized based on the
+	 * A lower tolerance results in more vertices. Curves are subdivided until they deviate less than the tolerance from their
+	 * flattened version, flat segments therefore receive less vertices than strongly curved segments. When a screen size
+	 * is given the tolerance is specified in pixels at that size, making the resolution independent of the svg units.
+	 * All lines are stored in one contiguous vertex buffer, every line is a separate shape of the mesh.
+	 * Use getLineCount(), getLineVertexOffset() and getLineVertexCount() to access individual lines.
+	 * Paths are flattened in parallel and the flattened paths are shared between resources that load the same file
+	 * with the same settings, which speeds up reloading when only the other properties change.
+	 * The uv's of the lines are normalized based on the
 	 * total bounding box of the file, ie: all the lines in the file. The normals are perpendicular
 	 * to the tangent of the line, the line itself is loaded in the x, y plane.
 	 * When normalization is turned on the loaded lines will be placed relative to 0, with a default bounding box
@@ -55,12 +63,34 @@ namespace nap
 		 */
 		virtual bool isClosed(int shapeIndex) const;
 
+		/**
+		 * @return number of lines loaded from the file
+		 */
+		int getLineCount() const											{ return static_cast<int>(mClosedStates.size()); }
+
+		/**
+		 * @param lineIndex index of the line
+		 * @return index of the first vertex of the line in the vertex buffer
+		 */
+		int getLineVertexOffset(int lineIndex) const;
+
+		/**
+		 * @param lineIndex index of the line
+		 * @return number of vertices of the line
+		 */
+		int getLineVertexCount(int lineIndex) const;
+
 		// Property: the svg file to read
 		std::string mFile;
 
-		// Property: the cubic re-sample line tolerance
+		// Property: the cubic re-sample line tolerance, the maximum distance between a curve and its flattened version.
+		// The flatness test bounds the distance of the control points to the chord, which is stricter than the previous midpoint test:
+		// existing projects get more vertices at the same tolerance.
 		float mTolerance = 1.0f;
 
+		// Property: size in pixels of the longest side of the drawn lines, when higher than 0 the tolerance is in pixels at this size
+		float mScreenSize = 0.0f;
+
 		// Property: units used when reading the svg file
 		ESVGUnits mUnits = ESVGUnits::PX;
 
@@ -82,17 +112,41 @@ namespace nap
 		// The currently active line
 		int mLineIndex = 0;
 
-	private:
-		using SVGPaths = std::vector<std::unique_ptr<std::vector<glm::vec3>>>;
-		using SVGState = std::vector<bool>;
+		/**
+		 * All paths of an svg file, flattened into one contiguous vertex buffer in svg coordinates.
+		 */
+		struct SVGPaths
+		{
+			std::vector<glm::vec3> mVertices;		///< Vertices of all paths
+			std::vector<uint32> mOffsets;			///< Index of the first vertex of every path, followed by the total number of vertices
+			std::vector<bool> mClosed;				///< If a path is closed
+			math::Rect mBounds;						///< Bounds of all paths
+		};
 
-		// Utility for extracting lines from all the paths
-		bool extractLinesFromPaths(const SVGPaths& paths, const SVGState& states, const math::Rect& rectangle, utility::ErrorState& errorState);
+		/**
+		 * Parses an svg file and flattens all its paths, without sharing the result or creating a mesh.
+		 * @param file the svg file to load
+		 * @param units units used when reading the file
+		 * @param dpi dpi used when reading the file
+		 * @param tolerance maximum distance between a curve and its flattened version
+		 * @param screenSize when higher than 0 the tolerance is in pixels at this size
+		 * @param outPaths the flattened paths
+		 * @param errorState contains the error if the file can't be loaded
+		 * @return if the file loaded
+		 */
+		static bool loadPaths(const std::string& file, ESVGUnits units, float dpi, float tolerance, float screenSize, SVGPaths& outPaths, utility::ErrorState& errorState);
 
-		// Create a mesh instance out of curve sampled vertices
-		void addShape(bool closed, std::vector<glm::vec3>& pathVertices, std::vector<glm::vec3>& pathNormals, std::vector<glm::vec3>& pathUvs);
+	private:
+		// Utility for extracting lines from all the paths
+		bool extractLinesFromPaths(const SVGPaths& paths, utility::ErrorState& errorState);
 
 		// All the lines closed states
 		std::vector<bool> mClosedStates;
+
+		// Index of the first vertex of every line, followed by the total number of vertices
+		std::vector<uint32> mLineOffsets;
+
+		// The flattened paths, shared with other resources that load the same file with the same settings
+		std::shared_ptr<const SVGPaths> mPaths = nullptr;
 	};
 }
\ No newline at end of file
@@ -127,6 +127,7 @@ this means that all video frames up until time 2 will be dropped.
 #include <iostream>
 #include <limits>
 #include "nap/logger.h"
+#include "nap/profiler.h"
 
 extern "C"
 {
@@ -679,11 +680,16 @@ namespace nap
 			stream_start_time = mVideo->mFormatContext->streams[mStream]->start_time * av_q2d(mVideo->mFormatContext->streams[mStream]->time_base);
 
 		AVFrame* frame = av_frame_alloc();
+		Profiler::setThreadName("video decode");
 
 		while (!mExitDecodeThreadSignalled)
 		{
 			int frameFirstPacketDTS;
-			AVState::EDecodeFrameResult decode_result = decodeFrame(*frame, frameFirstPacketDTS);
+			AVState::EDecodeFrameResult decode_result;
+			{
+				NAP_PROFILE_SCOPE("Video::decodeFrame")
+				decode_result = decodeFrame(*frame, frameFirstPacketDTS);
+			}
 			if (decode_result == AVState::EDecodeFrameResult::Exit)
 				break;
 
@@ -167,6 +167,6 @@ namespace nap
 
 	void WebSocketClient::onMessageReceived(const WebSocketMessage& msg)
 	{
-		addEvent(std::make_unique<WebSocketMessageReceivedEvent>(mConnection, msg));
+		addMessageEvent(mConnection, msg);
 	}
 }
\ No newline at end of file
@@ -14,6 +14,8 @@ RTTI_END_CLASS
 
 namespace nap
 {
+	// Max number of message events kept for reuse per interface
+	static constexpr size_t maxFreeMessageEvents = 256;
 
 	WebSocketInterface::WebSocketInterface(WebSocketService& service) : mService(&service)
 	{
@@ -41,20 +43,41 @@ namespace nap
 
 	void WebSocketInterface::addEvent(WebSocketEventPtr newEvent)
 	{
-		std::lock_guard<std::mutex> lock(mEventMutex);
-		mEvents.emplace(std::move(newEvent));
+		mEvents.enqueue(std::move(newEvent));
 	}
 
 
-	void WebSocketInterface::consumeEvents(std::queue<WebSocketEventPtr>& outEvents)
+	void WebSocketInterface::addMessageEvent(const WebSocketConnection& connection, const WebSocketMessage& message)
 	{
-		// Swap events
-		std::lock_guard<std::mutex> lock(mEventMutex);
-		outEvents.swap(mEvents);
+		// Reuse a processed event, assigning the message reuses the payload buffer when large enough
+		std::unique_ptr<WebSocketMessageReceivedEvent> message_event;
+		if (mFreeMessageEvents.try_dequeue(message_event))
+		{
+			message_event->mConnection = connection;
+			message_event->mMessage = message;
+		}
+		else
+		{
+			message_event = std::make_unique<WebSocketMessageReceivedEvent>(connection, message);
+		}
+		mEvents.enqueue(std::move(message_event));
+	}
+
+
+	size_t WebSocketInterface::consumeEvents(std::vector<WebSocketEventPtr>& outEvents)
+	{
+		return mEvents.try_dequeue_bulk(outEvents.begin(), outEvents.size());
+	}
+
+
+	void WebSocketInterface::recycleEvent(WebSocketEventPtr event)
+	{
+		// Only keep plain message events, derived events can't be reused as message events
+		if (event->get_type() != RTTI_OF(WebSocketMessageReceivedEvent) || mFreeMessageEvents.size_approx() >= maxFreeMessageEvents)
+			return;
 
-		// Clear current queue
-		std::queue<WebSocketEventPtr> empty_queue;;
-		mEvents.swap(empty_queue);
+		std::unique_ptr<WebSocketMessageReceivedEvent> message_event(static_cast<WebSocketMessageReceivedEvent*>(event.release()));
+		mFreeMessageEvents.enqueue(std::move(message_event));
 	}
 
 }
\ No newline at end of file
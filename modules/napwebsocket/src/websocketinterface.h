@@ -9,8 +9,8 @@
 
 // External Includes
 #include <nap/resource.h>
-#include <queue>
-#include <mutex>
+#include <concurrentqueue.h>
+#include <vector>
 
 namespace nap
 {
@@ -67,26 +67,46 @@ namespace nap
 		/**
 		 * Called when the end point receives a new event.
 		 * Adds the event to the list of events to be processed on the application thread.
+		 * Thread safe and lock free.
 		 * @param newEvent the web-socket event.
 		 */
 		void addEvent(WebSocketEventPtr newEvent);
 
-		// Queue that holds all the consumed events
-		std::queue<WebSocketEventPtr> mEvents;
+		/**
+		 * Called when the end point receives a new message.
+		 * Adds a message received event to the list of events to be processed on the application thread.
+		 * The event is taken from a pool of recycled events, the message is copied into the buffer of the recycled event.
+		 * This avoids allocating a new event and payload for every message received.
+		 * Thread safe and lock free.
+		 * @param connection the connection the message was received from
+		 * @param message the received message
+		 */
+		void addMessageEvent(const WebSocketConnection& connection, const WebSocketMessage& message);
 
-		// Mutex associated with setting / getting events
-		std::mutex	mEventMutex;
+		// Queue that holds all the events to be consumed, multiple producers and a single consumer
+		moodycamel::ConcurrentQueue<WebSocketEventPtr> mEvents;
 
 		// Handle to the web socket service
 		WebSocketService* mService = nullptr;
 
 	private:
 		/**
-		 * Consumes all received web-socket events and moves them to outEvents
-		 * Calling this will clear the internal queue and transfers ownership of the events to the caller
+		 * Consumes received web-socket events and moves them to outEvents.
+		 * At most outEvents.size() events are consumed, ownership of the events is transferred to the caller.
 		 * @param outEvents will hold the transferred web-socket events
+		 * @return number of consumed events
+		 */
+		size_t consumeEvents(std::vector<WebSocketEventPtr>& outEvents);
+
+		/**
+		 * Returns a consumed event to the interface after it has been processed.
+		 * Message received events are recycled, all other events are destroyed.
+		 * @param event the processed event
 		 */
-		void consumeEvents(std::queue<WebSocketEventPtr>& outEvents);
+		void recycleEvent(WebSocketEventPtr event);
+
+		// Processed message events available for reuse
+		moodycamel::ConcurrentQueue<std::unique_ptr<WebSocketMessageReceivedEvent>> mFreeMessageEvents;
 
 		// If the interface registered on init
 		bool mRegistered = false;
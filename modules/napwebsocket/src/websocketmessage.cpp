@@ -10,7 +10,8 @@ namespace nap
 {
 	WebSocketMessage::WebSocketMessage(wspp::MessagePtr message)
 	{
-		mMessage = message->get_payload();
+		// The received message is discarded by the endpoint after it is handled, take the payload instead of copying it
+		mMessage = std::move(message->get_raw_payload());
 		mCode = static_cast<EWebSocketOPCode>(message->get_opcode());
 		mFin = message->get_fin();
 	}
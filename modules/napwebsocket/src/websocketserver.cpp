@@ -64,6 +64,24 @@ namespace nap
 	}
 
 
+	bool WebSocketServer::broadcast(const std::string& message, EWebSocketOPCode code, nap::utility::ErrorState& error)
+	{
+		return mEndPoint->broadcast(message, code, error);
+	}
+
+
+	bool WebSocketServer::broadcast(void const* payload, int length, EWebSocketOPCode code, nap::utility::ErrorState& error)
+	{
+		return mEndPoint->broadcast(payload, length, code, error);
+	}
+
+
+	bool WebSocketServer::broadcast(const WebSocketMessage& message, nap::utility::ErrorState& error)
+	{
+		return mEndPoint->broadcast(message.getPayload(), message.getCode(), error);
+	}
+
+
 	void WebSocketServer::onConnectionOpened(const WebSocketConnection& connection)
 	{
 		addEvent(std::make_unique<WebSocketConnectionOpenedEvent>(connection));
@@ -84,7 +102,7 @@ namespace nap
 
 	void WebSocketServer::onMessageReceived(const WebSocketConnection& connection, const WebSocketMessage& message)
 	{
-		addEvent(std::make_unique<WebSocketMessageReceivedEvent>(connection, message));
+		addMessageEvent(connection, message);
 	}
 
 
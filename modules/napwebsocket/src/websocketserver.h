@@ -115,6 +115,37 @@ namespace nap
 		 */
 		bool send(const WebSocketConnection& connection, const WebSocketMessage& message, nap::utility::ErrorState& error);
 
+		/**
+		 * Sends a message with the given opcode to all connected clients.
+		 * The message is framed once and sent on the endpoint thread, this call does not block.
+		 * Prefer this over sending the same message to every client individually.
+		 * @param message the message to send
+		 * @param code message type
+		 * @param error contains the error if the message can't be scheduled
+		 * @return if the message is scheduled to be sent
+		 */
+		bool broadcast(const std::string& message, EWebSocketOPCode code, nap::utility::ErrorState& error);
+
+		/**
+		 * Sends a message using the given payload and opcode to all connected clients.
+		 * The message is framed once and sent on the endpoint thread, this call does not block.
+		 * @param payload the message buffer
+		 * @param length total number of bytes
+		 * @param code message type
+		 * @param error contains the error if the message can't be scheduled
+		 * @return if the message is scheduled to be sent
+		 */
+		bool broadcast(void const* payload, int length, EWebSocketOPCode code, nap::utility::ErrorState& error);
+
+		/**
+		 * Sends a message to all connected clients.
+		 * The message is framed once and sent on the endpoint thread, this call does not block.
+		 * @param message the message to send
+		 * @param error contains the error if the message can't be scheduled
+		 * @return if the message is scheduled to be sent
+		 */
+		bool broadcast(const WebSocketMessage& message, nap::utility::ErrorState& error);
+
 	private:
 		/**
 		 * Called by web-socket server endpoint when the connection is opened.
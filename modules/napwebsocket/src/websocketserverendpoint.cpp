@@ -21,6 +21,11 @@ RTTI_BEGIN_ENUM(nap::WebSocketServerEndPoint::EAccessMode)
 	RTTI_ENUM_VALUE(nap::WebSocketServerEndPoint::EAccessMode::Reserved,	"Reserved")
 RTTI_END_ENUM
 
+RTTI_BEGIN_ENUM(nap::WebSocketServerEndPoint::EDropPolicy)
+	RTTI_ENUM_VALUE(nap::WebSocketServerEndPoint::EDropPolicy::DropMessage,	"DropMessage"),
+	RTTI_ENUM_VALUE(nap::WebSocketServerEndPoint::EDropPolicy::Disconnect,	"Disconnect")
+RTTI_END_ENUM
+
 RTTI_BEGIN_CLASS(nap::WebSocketServerEndPoint)
 	RTTI_PROPERTY("AllowPortReuse",			&nap::WebSocketServerEndPoint::mAllowPortReuse,				nap::rtti::EPropertyMetaData::Default)
 	RTTI_PROPERTY("LogConnectionUpdates",	&nap::WebSocketServerEndPoint::mLogConnectionUpdates,		nap::rtti::EPropertyMetaData::Default)
@@ -30,6 +35,8 @@ RTTI_BEGIN_CLASS(nap::WebSocketServerEndPoint)
 	RTTI_PROPERTY("ConnectionLimit",		&nap::WebSocketServerEndPoint::mConnectionLimit,			nap::rtti::EPropertyMetaData::Default)
 	RTTI_PROPERTY("LibraryLogLevel",		&nap::WebSocketServerEndPoint::mLibraryLogLevel,			nap::rtti::EPropertyMetaData::Default)
 	RTTI_PROPERTY("AllowControlOrigin",		&nap::WebSocketServerEndPoint::mAccessAllowControlOrigin,	nap::rtti::EPropertyMetaData::Default)
+	RTTI_PROPERTY("MaxBufferedBytes",		&nap::WebSocketServerEndPoint::mMaxBufferedBytes,			nap::rtti::EPropertyMetaData::Default)
+	RTTI_PROPERTY("DropPolicy",				&nap::WebSocketServerEndPoint::mDropPolicy,					nap::rtti::EPropertyMetaData::Default)
 	RTTI_PROPERTY("Clients",				&nap::WebSocketServerEndPoint::mClients,					nap::rtti::EPropertyMetaData::Default | nap::rtti::EPropertyMetaData::Embedded)
 RTTI_END_CLASS
 
@@ -111,6 +118,40 @@ namespace nap
 	}
 
 
+	bool WebSocketServerEndPoint::broadcast(const std::string& message, EWebSocketOPCode code, nap::utility::ErrorState& error)
+	{
+		return broadcast(message.data(), static_cast<int>(message.size()), code, error);
+	}
+
+
+	bool WebSocketServerEndPoint::broadcast(void const* payload, int length, EWebSocketOPCode code, nap::utility::ErrorState& error)
+	{
+		if (!error.check(mRunning, "%s: unable to broadcast, endpoint is not running", mID.c_str()))
+			return false;
+
+		if (!error.check(length >= 0, "%s: unable to broadcast, invalid payload length", mID.c_str()))
+			return false;
+
+		// Frame the message once. Server frames are never masked, the same frame is therefore valid for every connection.
+		// The message is marked as prepared so the connections send the frame as is, without copying it.
+		wspp::OpCode opcode = static_cast<wspp::OpCode>(code);
+		websocketpp::frame::basic_header header(opcode, static_cast<uint64>(length), true, false);
+		websocketpp::frame::extended_header extended_header(static_cast<uint64>(length));
+
+		wspp::MessagePtr message = std::make_shared<wspp::Config::message_type>(wspp::Config::message_type::con_msg_man_ptr(), opcode, length);
+		message->set_header(websocketpp::frame::prepare_header(header, extended_header));
+		message->set_payload(payload, length);
+		message->set_prepared(true);
+
+		// Send on the endpoint thread
+		mEndPoint.get_io_service().post([this, message]()
+		{
+			onBroadcast(message);
+		});
+		return true;
+	}
+
+
 	std::string WebSocketServerEndPoint::getHostName(const WebSocketConnection& connection)
 	{
 		std::error_code stdec;
@@ -517,6 +558,48 @@ namespace nap
 	}
 
 
+	void WebSocketServerEndPoint::onBroadcast(const wspp::MessagePtr& message)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mConnectionMutex);
+			for (auto& connection : mConnections)
+			{
+				std::error_code stdec;
+				wspp::ConnectionPtr cptr = mEndPoint.get_con_from_hdl(connection, stdec);
+				if (stdec)
+				{
+					mDroppedMessageCount++;
+					continue;
+				}
+
+				// Don't queue more data for clients that can't keep up
+				if (mMaxBufferedBytes >= 0 && cptr->get_buffered_amount() > static_cast<size_t>(mMaxBufferedBytes))
+				{
+					mDroppedMessageCount++;
+					if (mDropPolicy == EDropPolicy::Disconnect)
+						mOverflowConnections.emplace_back(connection);
+					continue;
+				}
+
+				// Fails when the connection is closing
+				stdec = cptr->send(message);
+				if (stdec)
+					mDroppedMessageCount++;
+			}
+		}
+
+		// Close outside of the lock, closing a connection removes it from the list of connections
+		for (auto& connection : mOverflowConnections)
+		{
+			std::error_code stdec;
+			mEndPoint.close(connection, websocketpp::close::status::try_again_later, "send buffer exceeded", stdec);
+			if (!stdec)
+				nap::Logger::warn("%s: closing client connection, send buffer exceeded %d bytes", mID.c_str(), mMaxBufferedBytes);
+		}
+		mOverflowConnections.clear();
+	}
+
+
 	bool WebSocketServerEndPoint::disconnect(nap::utility::ErrorState& error)
 	{
 		std::lock_guard<std::mutex> lock(mConnectionMutex);
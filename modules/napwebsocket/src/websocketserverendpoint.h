@@ -18,6 +18,7 @@
 #include <nap/signalslot.h>
 #include <nap/resourceptr.h>
 #include <mutex>
+#include <atomic>
 #include <unordered_set>
 #include <unordered_map>
 
@@ -85,6 +86,15 @@ namespace nap
 			Reserved		= 2				///< Only clients that have a matching ticket are allowed
 		};
 
+		/**
+		 * What happens to a broadcast message when a client connection has more than 'MaxBufferedBytes' waiting to be sent
+		 */
+		enum class EDropPolicy : int
+		{
+			DropMessage		= 0,			///< The message is not sent to the client, the client receives the next message that fits
+			Disconnect		= 1				///< The client connection is closed
+		};
+
 		// default constructor
 		WebSocketServerEndPoint();
 
@@ -149,6 +159,36 @@ namespace nap
 		 */
 		bool send(const WebSocketConnection& connection, void const* payload, int length, EWebSocketOPCode code, nap::utility::ErrorState& error);
 
+		/**
+		 * Sends a message to all connected clients.
+		 * The message is framed once and the frame is shared by all client connections,
+		 * the actual send is performed on the endpoint thread, this call does not block.
+		 * A client connection that has more than 'MaxBufferedBytes' waiting to be sent is handled according to the 'DropPolicy'.
+		 * @param message the message to send
+		 * @param code message type
+		 * @param error contains the error if the message can't be scheduled
+		 * @return if the message is scheduled to be sent
+		 */
+		bool broadcast(const std::string& message, EWebSocketOPCode code, nap::utility::ErrorState& error);
+
+		/**
+		 * Sends a message to all connected clients using the given payload and opcode.
+		 * The message is framed once and the frame is shared by all client connections,
+		 * the actual send is performed on the endpoint thread, this call does not block.
+		 * A client connection that has more than 'MaxBufferedBytes' waiting to be sent is handled according to the 'DropPolicy'.
+		 * @param payload the message buffer, copied once
+		 * @param length size of the buffer in bytes
+		 * @param code message type
+		 * @param error contains the error if the message can't be scheduled
+		 * @return if the message is scheduled to be sent
+		 */
+		bool broadcast(void const* payload, int length, EWebSocketOPCode code, nap::utility::ErrorState& error);
+
+		/**
+		 * @return total number of broadcast messages not sent to a client because of backpressure or a closing connection
+		 */
+		uint64 getDroppedMessageCount() const							{ return mDroppedMessageCount.load(); }
+
 		/**
 		 * @return a client connection host-name, empty string if the connection is not managed by this end-point.
 		 */
@@ -179,6 +219,8 @@ namespace nap
 		std::vector<ResourcePtr<WebSocketTicket>> mClients;					///< Property: "Clients" All authorized clients when mode is set to 'Reserved'"
 		std::string mAccessAllowControlOrigin = "*";						///< Property: "AllowControlOrigin" Access-Control-Allow-Origin response header value. Indicates if the server response can be shared with request code from the given origin.
 		std::string	mIPAddress = "";										///< Property: 'IPAddress' this server IP Address, when left empty the first available ethernet adapter is chosen.
+		int mMaxBufferedBytes = -1;											///< Property: 'MaxBufferedBytes' max number of bytes waiting to be sent to a client before broadcast messages are dropped, -1 = no limit
+		EDropPolicy mDropPolicy = EDropPolicy::DropMessage;					///< Property: 'DropPolicy' what happens to a broadcast message when a client exceeds 'MaxBufferedBytes'
 
 	private:
 		std::mutex mListenerMutex;
@@ -225,6 +267,11 @@ namespace nap
 		 */
 		bool onPing(wspp::ConnectionHandle con, std::string msg);
 
+		/**
+		 * Sends a framed message to all client connections, called on the endpoint thread.
+		 */
+		void onBroadcast(const wspp::MessagePtr& message);
+
 		/**
 		 * Closes all active client connections.
 		 */
@@ -238,5 +285,7 @@ namespace nap
 		uint32 mAccessLogLevel = 0;												///< Log client / server connection data
 		std::future<void> mServerTask;											///< The background server thread
 		std::vector<wspp::ConnectionHandle> mConnections;						///< List of all low level connections
+		std::vector<wspp::ConnectionHandle> mOverflowConnections;				///< Connections to close after a broadcast, only used on the endpoint thread
+		std::atomic<uint64> mDroppedMessageCount = { 0 };						///< Number of broadcast messages not sent to a client
 	};
 }
@@ -17,9 +17,13 @@ RTTI_END_CLASS
 
 namespace nap
 {
+	// Max number of events consumed from an interface at once
+	static constexpr size_t eventBatchSize = 64;
+
 	WebSocketService::WebSocketService(ServiceConfiguration* configuration) :
 		Service(configuration)
 	{
+		mEvents.resize(eventBatchSize);
 	}
 
 
@@ -38,55 +42,64 @@ namespace nap
 
 	void WebSocketService::update(double deltaTime)
 	{
-		std::queue<WebSocketEventPtr> events;
 		for (auto& ws_interface : mInterfaces)
 		{
-			ws_interface->consumeEvents(events);
-			while (!(events.empty()))
+			// Always consume events, also when no component listens to the interface
+			auto found_it = mComponents.find(ws_interface);
+			size_t count = 0;
+			while ((count = ws_interface->consumeEvents(mEvents)) > 0)
 			{
-				WebSocketEvent* websocket_event = events.front().get();
-				for (auto& component : mComponents)
+				for (size_t i = 0; i < count; i++)
 				{
-					if (&component->getInterface() != ws_interface)
-						continue;
-
-					WebSocketMessageReceivedEvent* msg_received = rtti_cast<WebSocketMessageReceivedEvent>(websocket_event);
-					if (msg_received != nullptr)
-					{
-						component->messageReceived(*msg_received);
-						continue;
-					}
-
-					WebSocketConnectionOpenedEvent* con_opened = rtti_cast<WebSocketConnectionOpenedEvent>(websocket_event);
-					if (con_opened != nullptr)
-					{
-						component->connectionOpened(*con_opened);
-						continue;
-					}
-
-					WebSocketConnectionClosedEvent* con_closed = rtti_cast<WebSocketConnectionClosedEvent>(websocket_event);
-					if (con_closed != nullptr)
-					{
-						component->connectionClosed(*con_closed);
-						continue;
-					}
-
-					WebSocketConnectionFailedEvent* con_failed = rtti_cast<WebSocketConnectionFailedEvent>(websocket_event);
-					if (con_failed != nullptr)
-					{
-						component->connectionFailed(*con_failed);
-						continue;
-					}
-
-					// Unknown message web-socket event type
-					assert(false);
+					if (found_it != mComponents.end())
+						dispatchEvent(*mEvents[i], found_it->second);
+					ws_interface->recycleEvent(std::move(mEvents[i]));
 				}
-				events.pop();
 			}
 		}
 	}
 
 
+	void WebSocketService::dispatchEvent(WebSocketEvent& event, const std::vector<WebSocketComponentInstance*>& components)
+	{
+		// Resolve the event type once for all components
+		WebSocketMessageReceivedEvent* msg_received = rtti_cast<WebSocketMessageReceivedEvent>(&event);
+		if (msg_received != nullptr)
+		{
+			for (auto& component : components)
+				component->messageReceived(*msg_received);
+			return;
+		}
+
+		WebSocketConnectionOpenedEvent* con_opened = rtti_cast<WebSocketConnectionOpenedEvent>(&event);
+		if (con_opened != nullptr)
+		{
+			for (auto& component : components)
+				component->connectionOpened(*con_opened);
+			return;
+		}
+
+		WebSocketConnectionClosedEvent* con_closed = rtti_cast<WebSocketConnectionClosedEvent>(&event);
+		if (con_closed != nullptr)
+		{
+			for (auto& component : components)
+				component->connectionClosed(*con_closed);
+			return;
+		}
+
+		WebSocketConnectionFailedEvent* con_failed = rtti_cast<WebSocketConnectionFailedEvent>(&event);
+		if (con_failed != nullptr)
+		{
+			for (auto& component : components)
+				component->connectionFailed(*con_failed);
+			return;
+		}
+
+		// Unknown message web-socket event type
+		assert(false);
+	}
+
+
 	void WebSocketService::registerInterface(WebSocketInterface& wsInterface)
 	{
 		mInterfaces.emplace_back(&wsInterface);
@@ -107,18 +120,24 @@ namespace nap
 
 	void WebSocketService::registerComponent(WebSocketComponentInstance& component)
 	{
-		mComponents.emplace_back(&component);
+		mComponents[&component.getInterface()].emplace_back(&component);
 	}
 
 
 	void WebSocketService::removeComponent(WebSocketComponentInstance& component)
 	{
-		auto found_it = std::find_if(mComponents.begin(), mComponents.end(), [&](const auto& it)
+		auto interface_it = mComponents.find(&component.getInterface());
+		assert(interface_it != mComponents.end());
+
+		auto& components = interface_it->second;
+		auto found_it = std::find_if(components.begin(), components.end(), [&](const auto& it)
 		{
 			return it == &component;
 		});
 
-		assert(found_it != mComponents.end());
-		mComponents.erase(found_it);
+		assert(found_it != components.end());
+		components.erase(found_it);
+		if (components.empty())
+			mComponents.erase(interface_it);
 	}
 }
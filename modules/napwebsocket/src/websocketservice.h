@@ -4,8 +4,12 @@
 
 #pragma once
 
+// Local includes
+#include "websocketevent.h"
+
 // Nap includes
 #include <nap/service.h>
+#include <unordered_map>
 
 namespace nap 
 {   
@@ -68,10 +72,18 @@ namespace nap
 		 */
 		void removeComponent(WebSocketComponentInstance& component);
 
+		/**
+		 * Forwards an event to all components that listen to the given interface
+		 */
+		void dispatchEvent(WebSocketEvent& event, const std::vector<WebSocketComponentInstance*>& components);
+
 		// All the web socket servers currently registered in the system
 		std::vector<WebSocketInterface*> mInterfaces;
 
-		// All the web socket server components currently registered in the system
-		std::vector<WebSocketComponentInstance*> mComponents;
+		// All the web socket components currently registered in the system, by interface
+		std::unordered_map<const WebSocketInterface*, std::vector<WebSocketComponentInstance*>> mComponents;
+
+		// Events consumed on update()
+		std::vector<WebSocketEventPtr> mEvents;
     };
 }
@@ -33,9 +33,17 @@ void splitNameIndex(const std::string& str, std::string& name, int& index)
 
 }
 
+Document::Document(nap::Core& core) : QObject(), mCore(core)
+{
+	connectIndexSignals();
+}
+
 Document::Document(nap::Core& core, const QString& filename, nap::rtti::OwnedObjectList objects)
 	: QObject(), mCore(core), mCurrentFilename(filename), mObjects(std::move(objects))
 {
+	for (auto& object : mObjects)
+		indexObject(*object);
+	connectIndexSignals();
 }
 
 nap::Entity* Document::getParent(const nap::Entity& child) const
@@ -100,6 +108,12 @@ const std::string& Document::setObjectName(nap::rtti::Object& object, const std:
 	auto oldName = object.mID;
 	object.mID = newName;
 
+	// Update name index
+	auto it = mObjectIndex.find(oldName);
+	if (it != mObjectIndex.end() && it->second == &object)
+		mObjectIndex.erase(it);
+	mObjectIndex[newName] = &object;
+
 	// Ensure all relevant property paths point to the new object name
 	for (auto& p : mPropertyPaths)
 		p->updateObjectName(oldName, newName);
@@ -131,6 +145,7 @@ nap::Component* Document::addComponent(nap::Entity& entity, rttr::type type)
 	comp->mID = getUniqueName(type.get_name().data(), *comp, true);
 
 	mObjects.emplace_back(comp);
+	indexObject(*comp);
 	entity.mComponents.emplace_back(comp);
 
 	componentAdded(comp, &entity);
@@ -163,6 +178,7 @@ nap::rtti::Object* Document::addObject(rttr::type type, nap::rtti::Object* paren
 	assert(objptr != nullptr);
 	obj->mID = getUniqueName(base_name, *objptr, true);
 	mObjects.emplace_back(std::move(obj));
+	indexObject(*objptr);
 
 	// Handle adding to a parent
 	// TODO: Make this a little less hokey
@@ -183,6 +199,7 @@ nap::rtti::Object* Document::addObject(rttr::type type, nap::rtti::Object* paren
 			{
 				parentEntity->mComponents.emplace_back(newComponent);
 			}
+			invalidateReferences(*parentEntity);
 		}
 	}
 
@@ -236,10 +253,8 @@ std::string Document::getUniqueName(const std::string& suggestedName, const nap:
 
 Object* Document::getObject(const std::string& name)
 {
-	for (auto obj : getObjectPointers())
-		if (obj->mID == name)
-			return obj;
-	return nullptr;
+	auto it = mObjectIndex.find(name);
+	return it != mObjectIndex.end() ? it->second : nullptr;
 }
 
 
@@ -306,10 +321,12 @@ void Document::removeObject(Object& object)
 		{
 			auto it = std::remove(owner->mComponents.begin(), owner->mComponents.end(), &object);
 			owner->mComponents.erase(it, owner->mComponents.end());
+			invalidateReferences(*owner);
 		}
 	}
 
 	// All clean. Remove our object
+	unindexObject(object);
 	auto filter = [&](const auto& obj) { return obj.get() == &object; };
 	mObjects.erase(std::remove_if(mObjects.begin(), mObjects.end(), filter), mObjects.end());
 }
@@ -825,13 +842,20 @@ QList<PropertyPath> Document::getPointersTo(const nap::rtti::Object& targetObjec
 {
 	QList<PropertyPath> properties;
 
-	for (const std::unique_ptr<nap::rtti::Object>& sourceObject : mObjects)
+	// Only visit the objects that point to the target
+	updateReferences();
+	auto it = mSourcesByTarget.find(&targetObject);
+	if (it == mSourcesByTarget.end())
+		return properties;
+
+	std::vector<nap::rtti::Object*> sourceObjects = it->second;
+	std::vector<nap::rtti::ObjectLink> links;
+	for (nap::rtti::Object* sourceObject : sourceObjects)
 	{
-		std::vector<nap::rtti::ObjectLink> links;
 		findObjectLinks(*sourceObject, links);
 		for (const auto& link : links)
 		{
-			assert(link.mSource == sourceObject.get());
+			assert(link.mSource == sourceObject);
 
 			if (link.mTarget != &targetObject)
 				continue;
@@ -848,7 +872,7 @@ QList<PropertyPath> Document::getPointersTo(const nap::rtti::Object& targetObjec
 
 			if (excludeParent)
 			{
-				auto entity = rtti_cast<nap::Entity>(sourceObject.get());
+				auto entity = rtti_cast<nap::Entity>(sourceObject);
 				if (entity != nullptr)
 				{
 					if (std::find(entity->mChildren.begin(), entity->mChildren.end(), &targetObject) != entity->mChildren.end())
@@ -868,6 +892,111 @@ QList<PropertyPath> Document::getPointersTo(const nap::rtti::Object& targetObjec
 	return properties;
 }
 
+void Document::invalidateReferences(const nap::rtti::Object& object)
+{
+	if (mChangedSourceSet.emplace(&object).second)
+		mChangedSources.emplace_back(&object);
+}
+
+void Document::connectIndexSignals()
+{
+	// Pointers of objects that changed are indexed again on the next reference query
+	auto invalidate = [this](const nap::rtti::Object* object)
+	{
+		if (object != nullptr)
+			invalidateReferences(*object);
+	};
+
+	connect(this, &Document::propertyValueChanged, this, [invalidate](const PropertyPath& path) { invalidate(path.getObject()); });
+	connect(this, &Document::propertyChildInserted, this, [invalidate](const PropertyPath& path, size_t) { invalidate(path.getObject()); });
+	connect(this, &Document::propertyChildRemoved, this, [invalidate](const PropertyPath& path, size_t) { invalidate(path.getObject()); });
+	connect(this, &Document::objectChanged, this, [invalidate](nap::rtti::Object* object) { invalidate(object); });
+	connect(this, &Document::objectAdded, this, [invalidate](nap::rtti::Object* object, bool) { invalidate(object); });
+	connect(this, &Document::entityAdded, this, [invalidate](nap::Entity* entity, nap::Entity* parent) { invalidate(parent); });
+	connect(this, &Document::componentAdded, this, [invalidate](nap::Component* component, nap::Entity* owner)
+	{
+		invalidate(component);
+		invalidate(owner);
+	});
+	connect(this, &Document::entityReparented, this, [invalidate](nap::Entity* entity, nap::Entity* oldParent, nap::Entity* newParent)
+	{
+		invalidate(oldParent);
+		invalidate(newParent);
+	});
+}
+
+void Document::indexObject(nap::rtti::Object& object)
+{
+	mObjectIndex.emplace(object.mID, &object);
+	mTargetsBySource.emplace(&object, std::vector<nap::rtti::Object*>());
+	invalidateReferences(object);
+}
+
+void Document::unindexObject(nap::rtti::Object& object)
+{
+	auto nameIt = mObjectIndex.find(object.mID);
+	if (nameIt != mObjectIndex.end() && nameIt->second == &object)
+		mObjectIndex.erase(nameIt);
+
+	// Objects pointing to this object hold a dangling pointer, index them again
+	auto sourcesIt = mSourcesByTarget.find(&object);
+	if (sourcesIt != mSourcesByTarget.end())
+	{
+		for (auto source : sourcesIt->second)
+			invalidateReferences(*source);
+		mSourcesByTarget.erase(sourcesIt);
+	}
+
+	// Remove the references of this object
+	auto targetsIt = mTargetsBySource.find(&object);
+	if (targetsIt != mTargetsBySource.end())
+	{
+		for (auto target : targetsIt->second)
+		{
+			auto& sources = mSourcesByTarget[target];
+			sources.erase(std::remove(sources.begin(), sources.end(), &object), sources.end());
+		}
+		mTargetsBySource.erase(targetsIt);
+	}
+
+	if (mChangedSourceSet.erase(&object) > 0)
+		mChangedSources.erase(std::remove(mChangedSources.begin(), mChangedSources.end(), &object), mChangedSources.end());
+}
+
+void Document::updateReferences()
+{
+	std::vector<nap::rtti::ObjectLink> links;
+	for (auto source : mChangedSources)
+	{
+		// Objects that are not part of this document are not indexed
+		auto targetsIt = mTargetsBySource.find(source);
+		if (targetsIt == mTargetsBySource.end())
+			continue;
+
+		// Remove previous references
+		auto& targets = targetsIt->second;
+		for (auto target : targets)
+		{
+			auto& sources = mSourcesByTarget[target];
+			sources.erase(std::remove(sources.begin(), sources.end(), source), sources.end());
+		}
+		targets.clear();
+
+		// Add current references, every target is stored once.
+		// The document owns all indexed objects, the source can therefore be stored as mutable.
+		findObjectLinks(*source, links);
+		for (const auto& link : links)
+		{
+			if (link.mTarget == nullptr || std::find(targets.begin(), targets.end(), link.mTarget) != targets.end())
+				continue;
+			targets.emplace_back(link.mTarget);
+			mSourcesByTarget[link.mTarget].emplace_back(const_cast<nap::rtti::Object*>(source));
+		}
+	}
+	mChangedSources.clear();
+	mChangedSourceSet.clear();
+}
+
 QList<nap::RootEntity*> Document::getRootEntities(nap::Scene& scene, nap::rtti::Object& object)
 {
 	auto entity = dynamic_cast<nap::Entity*>(&object);
@@ -958,6 +1087,7 @@ void Document::removeComponent(nap::Component& comp)
 	comps.erase(std::remove_if(comps.begin(), comps.end(), [&comp](const auto& objptr) {
 		return objptr == &comp;
 	}));
+	invalidateReferences(*owner);
 }
 
 void Document::absoluteObjectPathList(const nap::rtti::Object& obj, std::deque<std::string>& result) const
@@ -5,6 +5,8 @@
 #pragma once
 
 #include <deque>
+#include <unordered_map>
+#include <unordered_set>
 #include <entity.h>
 #include <nap/core.h>
 #include <propertypath.h>
@@ -24,7 +26,7 @@ namespace napkin
 	{
 	Q_OBJECT
 	public:
-		Document(nap::Core& core) : QObject(), mCore(core) {}
+		Document(nap::Core& core);
 
 		Document(nap::Core& core, const QString& filename, nap::rtti::OwnedObjectList objects);
 
@@ -79,7 +81,7 @@ namespace napkin
 		nap::rtti::ObjectList getObjectPointers() const;
 
 		/**
-		 * Retrieve an (data) object by name/id
+		 * Retrieve an (data) object by name/id, objects are indexed by name.
 		 * @param name The name/id of the object to find
 		 * @return The found object or nullptr if none was found
 		 */
@@ -301,11 +303,20 @@ namespace napkin
 
 		/**
 		 * Retrieve all properties referring to the given object.
+		 * Only the objects that point to the target are visited, using an index of references that is kept by this document.
 		 * @param targetObject The object that is being referred to.
 		 * @return A list of properties pointing to the given object.
 		 */
 		QList<PropertyPath> getPointersTo(const nap::rtti::Object& targetObject, bool excludeArrays, bool excludeParent, bool excludeInstanceProperties = true);
 
+		/**
+		 * Marks the pointers of an object as changed, the references of the object are indexed again on the next call to getPointersTo().
+		 * This is done automatically when this document signals a change.
+		 * Call it when the pointers of an object are modified directly, without notifying the document.
+		 * @param object The object of which the pointers changed
+		 */
+		void invalidateReferences(const nap::rtti::Object& object);
+
 		/**
 		 * Add an element to the end of an array
 		 * The propertyValueChanged signal will be emitted.
@@ -558,12 +569,38 @@ namespace napkin
 		 */
 		static std::string createSimpleUUID();
 
+		/**
+		 * Connects the signals of this document that change pointers to the reference index
+		 */
+		void connectIndexSignals();
+
+		/**
+		 * Adds an object to the name index and marks its references for indexing
+		 */
+		void indexObject(nap::rtti::Object& object);
+
+		/**
+		 * Removes an object from the name and reference index, objects that point to it are indexed again
+		 */
+		void unindexObject(nap::rtti::Object& object);
+
+		/**
+		 * Indexes the references of all objects that have been marked as changed
+		 */
+		void updateReferences();
+
 		nap::Core& mCore;                        // nap's core
 		nap::rtti::OwnedObjectList mObjects;    // The objects in this document
 		QString mCurrentFilename;                // This document's filename
 		QUndoStack mUndoStack;                    // This document's undostack
 		std::vector<PropertyPath*> mPropertyPaths;
 
+		std::unordered_map<std::string, nap::rtti::Object*> mObjectIndex;							// Objects by name
+		std::unordered_map<const nap::rtti::Object*, std::vector<nap::rtti::Object*>> mTargetsBySource;	// Objects pointed to, by every indexed object
+		std::unordered_map<const nap::rtti::Object*, std::vector<nap::rtti::Object*>> mSourcesByTarget;	// Objects pointing to an object
+		std::vector<const nap::rtti::Object*> mChangedSources;										// Objects of which the references need to be indexed, in order
+		std::unordered_set<const nap::rtti::Object*> mChangedSourceSet;								// Objects of which the references need to be indexed
+
 	};
 
 }
\ No newline at end of file
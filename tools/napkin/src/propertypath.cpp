@@ -276,6 +276,14 @@ void PropertyPath::setValue(rttr::variant value)
 {
 	auto resolved = resolve();
 
+	// Pointers may change, the document indexes the references of the changed objects again when queried
+	mDocument->invalidateReferences(*getObject());
+	if (isInstanceProperty())
+	{
+		for (auto scene : mDocument->getObjects<nap::Scene>())
+			mDocument->invalidateReferences(*scene);
+	}
+
 	if (isInstanceProperty())
 	{
 		auto targetAttr = targetAttribute();
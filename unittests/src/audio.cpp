@@ -0,0 +1,62 @@
+#include "utils/catch.hpp"
+
+#include <audio/core/audionodemanager.h>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Timed audio tasks", "[audio]")
+{
+	using namespace nap::audio;
+	using namespace std::chrono;
+
+	constexpr int framesPerBuffer = 256;
+	DeletionQueue deletion_queue;
+	NodeManager manager(deletion_queue);
+	manager.setSampleRate(48000.0f);
+	manager.setInternalBufferSize(64);
+	manager.setInputChannelCount(0);
+	manager.setOutputChannelCount(1);
+
+	std::vector<float> output(framesPerBuffer);
+	float* output_channels[] = { output.data() };
+	auto process = [&]() { manager.process(nullptr, output_channels, framesPerBuffer); };
+
+	// Records the sample time at which a task is executed
+	std::vector<std::pair<int, DiscreteTimeValue>> executed;
+	auto task = [&](int id)
+	{
+		return [&executed, &manager, id]() { executed.emplace_back(id, manager.getSampleTime()); };
+	};
+
+	// Late tasks are executed at the start of the next callback, sorted by time, equal times in the order they were enqueued
+	auto past = nap::HighResolutionClock::now() - milliseconds(100);
+	manager.enqueueTask(task(2), past + milliseconds(2));
+	manager.enqueueTask(task(0), past);
+	manager.enqueueTask(task(1), past);
+	process();
+	REQUIRE(executed.size() == 3);
+	for (int i = 0; i < 3; i++)
+	{
+		REQUIRE(executed[i].first == i);
+		REQUIRE(executed[i].second == 0);
+	}
+
+	// Tasks are executed at their offset from the start of the previous callback, rounded down to the internal buffer.
+	// At 48 samples per millisecond: 16 samples in the first internal buffer and 160 samples in the third.
+	executed.clear();
+	auto previous_callback = nap::HighResolutionClock::now();
+	manager.enqueueTask(task(4), previous_callback + microseconds(3333));
+	manager.enqueueTask(task(3), previous_callback + microseconds(333));
+	manager.enqueueTask(task(5), previous_callback + seconds(10));
+	std::this_thread::sleep_for(milliseconds(20));
+	process();
+	REQUIRE(executed.size() == 2);
+	REQUIRE(executed[0].first == 3);
+	REQUIRE(executed[0].second == framesPerBuffer);
+	REQUIRE(executed[1].first == 4);
+	REQUIRE(executed[1].second == framesPerBuffer + 128);
+
+	// Tasks in the future wait for the callback they fall in
+	process();
+	REQUIRE(executed.size() == 2);
+}
@@ -0,0 +1,155 @@
+#include "utils/catch.hpp"
+
+#include <cvpipeline.h>
+#include <cvvideo.h>
+#include <cvcapturedevice.h>
+#include <cvservice.h>
+#include <opencv2/videoio.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+namespace
+{
+	// Number of frames in the generated video
+	constexpr int frameCount = 10;
+
+	/**
+	 * Stage that records if process() is entered by more than one thread at the same time
+	 */
+	class OverlapStage : public nap::CVPipelineStage
+	{
+	public:
+		virtual bool process(nap::CVPipelineFrame& frame) override
+		{
+			if (mActive++ != 0)
+				mOverlapped = true;
+			std::this_thread::sleep_for(std::chrono::microseconds(200));
+			mActive--;
+			return true;
+		}
+
+		std::atomic<int> mActive = { 0 };
+		std::atomic<bool> mOverlapped = { false };
+	};
+
+	// Waits until the pipeline processed the given number of frames, returns false on time-out
+	bool waitForFrames(const nap::CVPipeline& pipeline, nap::uint64 count)
+	{
+		auto start = std::chrono::steady_clock::now();
+		while (pipeline.getProcessedCount() < count)
+		{
+			if (std::chrono::steady_clock::now() - start > std::chrono::seconds(10))
+				return false;
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		return true;
+	}
+}
+
+
+TEST_CASE("CVPipeline video", "[cvpipeline]")
+{
+	// Write a small video: a white square that moves over a black background
+	const std::string path = "cvpipeline_test.avi";
+	{
+		cv::VideoWriter writer(path, cv::VideoWriter::fourcc('M', 'J', 'P', 'G'), 10.0, cv::Size(64, 64));
+		REQUIRE(writer.isOpened());
+		for (int i = 0; i < frameCount; i++)
+		{
+			cv::Mat frame(64, 64, CV_8UC3, cv::Scalar::all(0));
+			cv::rectangle(frame, cv::Rect(8 + i * 2, 16, 16, 16), cv::Scalar::all(255), cv::FILLED);
+			writer.write(frame);
+		}
+	}
+
+	// Capture the video without a window or render loop, the service is never initialized
+	nap::CVServiceConfiguration config;
+	nap::CVService service(&config);
+
+	nap::CVVideo video;
+	video.mID = "video";
+	video.mFile = path;
+	video.mCloseOnCaptureError = true;
+
+	nap::CVCaptureDevice device(service);
+	device.mID = "device";
+	device.mAdapters.emplace_back(&video);
+
+	nap::CVConvertStage convert;
+	nap::CVThresholdStage threshold;
+	nap::CVContourStage contour;
+
+	// Queue every frame, nothing is dropped when the stages fall behind
+	nap::CVPipeline pipeline;
+	pipeline.mID = "pipeline";
+	pipeline.mDevice = &device;
+	pipeline.mAdapter = &video;
+	pipeline.mStages = { &convert, &threshold, &contour };
+	pipeline.mQueueSize = frameCount;
+
+	// Record the objects of every frame, called from a pipeline thread
+	std::vector<std::vector<nap::math::Rect>> objects(frameCount);
+	nap::Slot<const nap::CVPipelineFrame&> processed_slot([&](const nap::CVPipelineFrame& frame)
+	{
+		if (frame.getNumber() < objects.size())
+			objects[frame.getNumber()] = frame.mObjects;
+	});
+	pipeline.frameProcessed.connect(processed_slot);
+
+	nap::utility::ErrorState error;
+	REQUIRE(video.init(error));
+	REQUIRE(device.init(error));
+	REQUIRE(pipeline.init(error));
+	REQUIRE(pipeline.start(error));
+	REQUIRE(device.start(error));
+
+	bool completed = waitForFrames(pipeline, frameCount);
+	device.stop();
+	pipeline.stop();
+	std::remove(path.c_str());
+
+	REQUIRE(completed);
+	REQUIRE(pipeline.getProcessedCount() == frameCount);
+	REQUIRE(pipeline.getDroppedCount() == 0);
+	for (int i = 0; i < frameCount; i++)
+	{
+		REQUIRE(objects[i].size() == 1);
+		REQUIRE(objects[i][0].getMin().x == Approx(8 + i * 2).margin(1.0));
+		REQUIRE(objects[i][0].getWidth() == Approx(16.0f).margin(1.0));
+	}
+}
+
+
+TEST_CASE("CVPipeline shared stage", "[cvpipeline]")
+{
+	// Two pipelines share the same stage, pushed from different threads
+	OverlapStage stage;
+	nap::CVPipeline pipelines[2];
+	nap::utility::ErrorState error;
+	for (auto& pipeline : pipelines)
+	{
+		pipeline.mStages = { &stage };
+		pipeline.mQueueSize = 100;
+		REQUIRE(pipeline.init(error));
+		REQUIRE(pipeline.start(error));
+	}
+
+	auto push = [](nap::CVPipeline& pipeline)
+	{
+		cv::UMat frame(8, 8, CV_8UC1, cv::Scalar::all(0));
+		for (int i = 0; i < 100; i++)
+			pipeline.push(frame);
+	};
+	std::thread first(push, std::ref(pipelines[0]));
+	std::thread second(push, std::ref(pipelines[1]));
+	first.join();
+	second.join();
+
+	REQUIRE(waitForFrames(pipelines[0], 100));
+	REQUIRE(waitForFrames(pipelines[1], 100));
+	for (auto& pipeline : pipelines)
+		pipeline.stop();
+	REQUIRE(!stage.mOverlapped);
+}
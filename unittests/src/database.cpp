@@ -0,0 +1,97 @@
+#include "utils/catch.hpp"
+
+#include <database.h>
+#include <databasetable.h>
+#include <rtti/factory.h>
+#include <rtti/object.h>
+#include <sqlite3.h>
+#include <cstdio>
+
+/**
+ * Row of the unittest table
+ */
+class DatabaseTestRow : public nap::rtti::Object
+{
+	RTTI_ENABLE(nap::rtti::Object)
+public:
+	int mValue = 0;
+};
+
+RTTI_BEGIN_CLASS(DatabaseTestRow)
+	RTTI_PROPERTY("Value", &DatabaseTestRow::mValue, nap::rtti::EPropertyMetaData::Default)
+RTTI_END_CLASS
+
+TEST_CASE("Database batched writes", "[database]")
+{
+	const std::string path = "unit_test_database.db";
+	std::remove(path.c_str());
+
+	nap::rtti::Factory factory;
+	nap::utility::ErrorState error;
+
+	// Create the tables and make inserts of negative values in the first table fail.
+	// The database locks the file exclusively, the trigger is added while it is closed.
+	std::string column;
+	{
+		nap::Database database(factory);
+		REQUIRE(database.init(path, error));
+		nap::DatabaseTable* first = database.getOrCreateTable("first", RTTI_OF(DatabaseTestRow), {}, error);
+		REQUIRE(first != nullptr);
+		REQUIRE(database.getOrCreateTable("second", RTTI_OF(DatabaseTestRow), {}, error) != nullptr);
+
+		auto value_path = nap::DatabasePropertyPath::sCreate(RTTI_OF(DatabaseTestRow), nap::rtti::Path::fromString("Value"), error);
+		REQUIRE(value_path != nullptr);
+		column = first->getColumnName(*value_path, error);
+		REQUIRE(!column.empty());
+	}
+	sqlite3* connection = nullptr;
+	REQUIRE(sqlite3_open(path.c_str(), &connection) == SQLITE_OK);
+	std::string trigger = "CREATE TRIGGER reject BEFORE INSERT ON first WHEN NEW.\"" + column + "\" < 0 BEGIN SELECT RAISE(ABORT, 'negative value'); END";
+	REQUIRE(sqlite3_exec(connection, trigger.c_str(), nullptr, nullptr, nullptr) == SQLITE_OK);
+	sqlite3_close(connection);
+
+	{
+		nap::Database database(factory);
+		REQUIRE(database.init(path, error));
+		nap::DatabaseTable* first = database.getOrCreateTable("first", RTTI_OF(DatabaseTestRow), {}, error);
+		nap::DatabaseTable* second = database.getOrCreateTable("second", RTTI_OF(DatabaseTestRow), {}, error);
+		REQUIRE(first != nullptr);
+		REQUIRE(second != nullptr);
+
+		// Rows are pending until flushed, all tables are written in the same batch
+		DatabaseTestRow row;
+		for (int value : { 1, -1, 2, -2, 3 })
+		{
+			row.mValue = value;
+			first->addAsync(row);
+			second->addAsync(row);
+		}
+		REQUIRE(database.getPendingRowCount() == 10);
+
+		// Only the failing rows are discarded, the other rows of both tables are committed
+		REQUIRE(!database.flush(error));
+		REQUIRE(database.getPendingRowCount() == 0);
+
+		std::vector<std::unique_ptr<nap::rtti::Object>> objects;
+		REQUIRE(first->query("", objects, error));
+		REQUIRE(objects.size() == 3);
+		objects.clear();
+		REQUIRE(second->query("", objects, error));
+		REQUIRE(objects.size() == 5);
+
+		// A failing add doesn't affect the rows that follow
+		row.mValue = -3;
+		nap::utility::ErrorState add_error;
+		REQUIRE(!first->add(row, add_error));
+		row.mValue = 4;
+		REQUIRE(first->add(row, error));
+		objects.clear();
+		REQUIRE(first->query("", objects, error));
+		REQUIRE(objects.size() == 4);
+
+		// Flushing without pending rows succeeds
+		nap::utility::ErrorState flush_error;
+		REQUIRE(database.flush(flush_error));
+	}
+	std::remove(path.c_str());
+}
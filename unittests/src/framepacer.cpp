@@ -0,0 +1,68 @@
+#include "utils/catch.hpp"
+
+#include <framepacer.h>
+
+TEST_CASE("FixedTimeStep", "[framepacer]")
+{
+	nap::FixedTimeStep step;
+
+	// Whole steps are taken, the remainder is kept as alpha
+	REQUIRE(step.advance(0.625, 0.25, 8) == 2);
+	REQUIRE(step.getAlpha() == Approx(0.5f));
+
+	// The remainder is carried over to the next frame
+	REQUIRE(step.advance(0.125, 0.25, 8) == 1);
+	REQUIRE(step.getAlpha() == Approx(0.0f));
+	REQUIRE(step.advance(0.125, 0.25, 8) == 0);
+	REQUIRE(step.getAlpha() == Approx(0.5f));
+
+	// Catching up is clamped and the time that is not consumed is discarded
+	REQUIRE(step.advance(10.0, 0.25, 4) == 4);
+	REQUIRE(step.getAlpha() == Approx(0.0f));
+	REQUIRE(step.advance(0.25, 0.25, 4) == 1);
+
+	step.advance(0.125, 0.25, 4);
+	step.reset();
+	REQUIRE(step.getAlpha() == Approx(0.0f));
+	REQUIRE(step.advance(0.125, 0.25, 4) == 0);
+}
+
+TEST_CASE("FrameHistogram", "[framepacer]")
+{
+	nap::FrameHistogram histogram;
+	for (double time : { 1.0, 2.0, 3.0, 100.0 })
+		histogram.record(time);
+
+	REQUIRE(histogram.getCount() == 4);
+	REQUIRE(histogram.getMin() == Approx(1.0));
+	REQUIRE(histogram.getMax() == Approx(100.0));
+	REQUIRE(histogram.getAverage() == Approx(26.5));
+
+	// Long frames end up in the last bin, percentiles are rounded up to the bin width
+	REQUIRE(histogram.getBins()[nap::FrameHistogram::binCount - 1] == 1);
+	REQUIRE(histogram.getPercentile(0.5f) == Approx(2.25));
+	REQUIRE(histogram.getPercentile(1.0f) == Approx(100.0));
+
+	histogram.reset();
+	REQUIRE(histogram.getCount() == 0);
+	REQUIRE(histogram.getPercentile(0.5f) == Approx(0.0));
+}
+
+TEST_CASE("FramePacer", "[framepacer]")
+{
+	// Deadlines are scheduled relative to the start, waiting never returns early
+	constexpr int frameCount = 10;
+	auto start = nap::HighResolutionClock::now();
+	nap::FramePacer pacer;
+	for (int i = 0; i < frameCount; i++)
+		pacer.wait(100.0f);
+	double elapsed = std::chrono::duration<double, std::milli>(nap::HighResolutionClock::now() - start).count();
+
+	REQUIRE(elapsed >= 100.0);
+	REQUIRE(pacer.getHistogram().getCount() == frameCount);
+
+	// Uncapped frames are recorded without waiting
+	pacer.reset();
+	pacer.frame();
+	REQUIRE(pacer.getHistogram().getCount() == 1);
+}
@@ -3,6 +3,13 @@
 #include "utils/catch.hpp"
 #include <audio/utility/safeptr.h>
 #include <utility/fileutils.h>
+#include <nap/queuedsignal.h>
+#include <nap/profiler.h>
+#include <nap/logger.h>
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
 
 TEST_CASE("File path transformations", "[fileutils]")
 {
@@ -200,6 +207,171 @@ TEST_CASE("Signals and slots", "[signalslot]")
 	signal.disconnect(slot);
 	signal(x);
 	REQUIRE(x == 1);
+
+	// Functions are disconnected using the returned handle, a stale handle has no effect
+	auto connection = signal.connect([](int& x) { x += 10; });
+	signal(x);
+	REQUIRE(x == 11);
+	signal.disconnect(connection);
+	auto other = signal.connect([](int& x) { x += 100; });
+	signal.disconnect(connection);
+	signal(x);
+	REQUIRE(x == 111);
+	signal.disconnect(other);
+
+	// Connections made or removed while triggering take effect on the next trigger
+	nap::Signal<> trigger;
+	int count = 0;
+	nap::SignalConnection self;
+	self = trigger.connect([&]() { trigger.disconnect(self); trigger.connect([&]() { count++; }); });
+	trigger();
+	REQUIRE(count == 0);
+	trigger();
+	REQUIRE(count == 1);
+
+	// Slots disconnect from all signals on destruction
+	{
+		nap::Signal<int&> first;
+		nap::Signal<int&> second;
+		{
+			nap::Slot<int&> scoped = { [](int& x) { x = 0; } };
+			first.connect(scoped);
+			second.connect(scoped);
+			first.connect(second);
+		}
+		first(x);
+		REQUIRE(x == 111);
+	}
+}
+
+TEST_CASE("Queued signals", "[signalslot]")
+{
+	nap::QueuedSignal<int> signal;
+	int sum = 0;
+	signal.connect([&](int value) { sum += value; });
+
+	std::thread thread([&]() { for (int i = 0; i < 100; i++) signal.trigger(1); });
+	thread.join();
+	REQUIRE(sum == 0);
+
+	signal.dispatch();
+	REQUIRE(sum == 100);
+
+	// Triggers are dropped when the queue is full
+	nap::QueuedSignal<int> small(32);
+	sum = 0;
+	small.connect([&](int value) { sum += value; });
+	std::thread flood([&]() { for (int i = 0; i < 10000; i++) small.trigger(1); });
+	flood.join();
+	small.dispatch();
+	REQUIRE(small.getDroppedCount() > 0);
+	REQUIRE(sum + small.getDroppedCount() == 10000);
+}
+
+TEST_CASE("Profiler", "[profiler]")
+{
+	// Zones alternate between two names, the category always matches the name
+	static const char* even = "profiler test even";
+	static const char* odd = "profiler test odd";
+
+	nap::Profiler& profiler = nap::Profiler::instance();
+	nap::Profiler::setEnabled(true);
+
+	// Record zones on another thread while copying them, the ring buffer wraps many times
+	std::atomic<bool> running = { true };
+	std::atomic<bool> started = { false };
+	std::thread writer([&]()
+	{
+		nap::Profiler::setThreadName("profiler test");
+		for (int i = 0; running; i++)
+		{
+			const char* name = i % 2 == 0 ? even : odd;
+			nap::ProfileScope scope(name, name);
+			started = true;
+		}
+	});
+	while (!started)
+		std::this_thread::yield();
+
+	// Every copied zone must be complete and zones must follow each other in order
+	int copied = 0;
+	int invalid = 0;
+	std::vector<nap::ProfileThread> threads;
+	for (int i = 0; i < 200; i++)
+	{
+		profiler.collect(threads);
+		for (const auto& thread : threads)
+		{
+			if (thread.mName != "profiler test")
+				continue;
+
+			const nap::ProfileZone* previous = nullptr;
+			for (const auto& zone : thread.mZones)
+			{
+				bool valid = (zone.mName == even || zone.mName == odd) && zone.mCategory == zone.mName && zone.mEnd >= zone.mStart;
+				if (previous != nullptr)
+					valid = valid && zone.mName != previous->mName && zone.mStart >= previous->mEnd;
+				invalid += valid ? 0 : 1;
+				previous = &zone;
+			}
+			copied += static_cast<int>(thread.mZones.size());
+		}
+	}
+	running = false;
+	writer.join();
+
+	nap::Profiler::setEnabled(false);
+	profiler.clear();
+
+	REQUIRE(copied > 0);
+	REQUIRE(invalid == 0);
+}
+
+TEST_CASE("Async logging", "[logger]")
+{
+	// Count the test messages that reach the log signal, including suppressed repetitions.
+	// Called from the background thread, connected before asynchronous logging starts.
+	// The first test message blocks the background thread until the queue is flooded, which makes the queue overflow.
+	static const char* text = "async logging test";
+	std::atomic<int> handled = { 0 };
+	std::atomic<bool> flooded = { false };
+	nap::Slot<nap::LogMessage> slot = { [&](nap::LogMessage message)
+	{
+		int repeats = 0;
+		if (message.text() == text)
+		{
+			handled++;
+			while (!flooded)
+				std::this_thread::yield();
+		}
+		else if (sscanf(message.text().c_str(), "Last message repeated %d times", &repeats) == 1)
+		{
+			handled += repeats;
+		}
+	}};
+	nap::Logger& logger = nap::Logger::instance();
+	logger.log.connect(slot);
+
+	// Keep the console quiet, the log signal is emitted for every level
+	const nap::LogLevel& level = logger.getCurrentLevel();
+	nap::Logger::setLevel(nap::Logger::fatalLevel());
+
+	// Flood the queue, every message is handled or dropped once logging stops
+	nap::uint64 dropped = nap::Logger::getDroppedMessageCount();
+	nap::Logger::startAsyncLogging(64);
+	REQUIRE(nap::Logger::isAsyncLogging());
+	for (int i = 0; i < 10000; i++)
+		nap::Logger::info(text);
+	flooded = true;
+	nap::Logger::stopAsyncLogging();
+	REQUIRE(!nap::Logger::isAsyncLogging());
+
+	dropped = nap::Logger::getDroppedMessageCount() - dropped;
+	logger.log.disconnect(slot);
+	nap::Logger::setLevel(level);
+
+	REQUIRE(dropped > 0);
+	REQUIRE(handled + dropped == 10000);
 }
 
 TEST_CASE("Core", "[core]")
@@ -0,0 +1,74 @@
+#include "utils/catch.hpp"
+
+#include <midifilterindex.h>
+#include <midiinputcomponent.h>
+#include <entity.h>
+#include <nap/core.h>
+#include <memory>
+#include <set>
+
+TEST_CASE("Midi filter index", "[midi]")
+{
+	// Components are never initialized, the filters are set directly
+	nap::Core core;
+	nap::EntityInstance entity(core, nullptr);
+	nap::MidiInputComponent resource;
+	std::vector<std::unique_ptr<nap::MidiInputComponentInstance>> components;
+	auto create = [&](std::vector<nap::MidiValue> channels, std::vector<nap::MidiValue> numbers)
+	{
+		components.emplace_back(std::make_unique<nap::MidiInputComponentInstance>(entity, resource));
+		components.back()->mChannels = channels;
+		components.back()->mNumbers = numbers;
+		return components.back().get();
+	};
+
+	auto* exact = create({ 1 }, { 10 });
+	auto* any_number = create({ 1 }, {});
+	auto* any_channel = create({}, { 10 });
+	auto* omni = create({}, {});
+	auto* other_channel = create({ 2 }, { 10 });
+	auto* note_on = create({ 1 }, { 10 });
+	note_on->mTypes = { nap::MidiEvent::Type::noteOn };
+	auto* port = create({ 1 }, { 10 });
+	port->mPorts = { "port" };
+	create({ 20 }, {});
+
+	nap::MidiFilterIndex index;
+	REQUIRE(index.empty());
+	for (auto& component : components)
+		index.add(*component);
+	REQUIRE(!index.empty());
+
+	// Returns the components that listen to a control change, in any order
+	std::vector<nap::MidiInputComponentInstance*> found;
+	auto find = [&](nap::MidiValue channel, nap::MidiValue number, const std::string& eventPort)
+	{
+		index.find(nap::MidiEvent(nap::MidiEvent::Type::controlChange, number, 64, channel, eventPort), found);
+		return std::set<nap::MidiInputComponentInstance*>(found.begin(), found.end());
+	};
+
+	// Every wildcard bucket is visited, type and port filters are tested on the components found
+	using Components = std::set<nap::MidiInputComponentInstance*>;
+	REQUIRE(find(1, 10, "") == Components({ exact, any_number, any_channel, omni }));
+	REQUIRE(found.size() == 4);
+	REQUIRE(find(1, 11, "") == Components({ any_number, omni }));
+	REQUIRE(find(3, 10, "") == Components({ any_channel, omni }));
+	REQUIRE(find(1, 10, "port") == Components({ exact, any_number, any_channel, omni, port }));
+	REQUIRE(find(2, 10, "") == Components({ any_channel, omni, other_channel }));
+
+	index.find(nap::MidiEvent(nap::MidiEvent::Type::noteOn, 10, 64, 1), found);
+	REQUIRE(Components(found.begin(), found.end()) == Components({ exact, any_number, any_channel, omni, note_on }));
+
+	// Removed components are not found, re-adding a component updates its buckets
+	index.remove(*any_channel);
+	REQUIRE(find(3, 10, "") == Components({ omni }));
+	exact->mChannels = { 3 };
+	index.add(*exact);
+	REQUIRE(find(3, 10, "") == Components({ exact, omni }));
+	REQUIRE(find(1, 10, "") == Components({ any_number, omni }));
+
+	// Values out of range are never matched, also not by the component that listens to channel 20
+	index.remove(*omni);
+	REQUIRE(find(4, 20, "").empty());
+	REQUIRE(find(20, 10, "").empty());
+}
@@ -1,6 +1,8 @@
 #include "utils/include.h"
 #include <QString>
 #include <appcontext.h>
+#include <nap/logger.h>
+#include <chrono>
 
 using namespace napkin;
 
@@ -94,5 +96,94 @@ TEST_CASE("Document", "napkin-document")
 		REQUIRE(entity->mID != entity2->mID); // Objects must have unique names
 	}
 
+	SECTION("name index")
+	{
+		auto doc = AppContext::get().newDocument();
+
+		auto res = doc->addObject<TestResource>();
+		REQUIRE(doc->getObject(res->mID) == res);
+
+		// Renaming must update the index
+		auto oldName = res->mID;
+		doc->setObjectName(*res, "RenamedResource");
+		REQUIRE(res->mID == "RenamedResource");
+		REQUIRE(doc->getObject("RenamedResource") == res);
+		REQUIRE(doc->getObject(oldName) == nullptr);
+
+		// Removing must update the index
+		doc->removeObject(*res);
+		REQUIRE(doc->getObject("RenamedResource") == nullptr);
+	}
+
+	SECTION("reference index")
+	{
+		auto doc = AppContext::get().newDocument();
+
+		auto target = doc->addObject<TestResource>();
+		auto source = doc->addObject<TestResourceB>();
+		REQUIRE(doc->getPointersTo(*target, false, false).isEmpty());
+
+		// Pointer set through a property path
+		PropertyPath pointerPath(source->mID, "ResPointer", *doc);
+		REQUIRE(pointerPath.isValid());
+		pointerPath.setPointee(target);
+		auto pointers = doc->getPointersTo(*target, false, false);
+		REQUIRE(pointers.size() == 1);
+		REQUIRE(pointers[0].getObject() == source);
+
+		// Pointer set directly
+		auto sourceB = doc->addObject<TestResourceB>();
+		sourceB->mResPointers.emplace_back(target);
+		doc->invalidateReferences(*sourceB);
+		REQUIRE(doc->getPointersTo(*target, false, false).size() == 2);
+		REQUIRE(doc->getPointersTo(*target, true, false).size() == 1);
+
+		// Pointers must be found after renaming the target
+		doc->setObjectName(*target, "RenamedTarget");
+		REQUIRE(doc->getPointersTo(*target, false, false).size() == 2);
+		REQUIRE(source->mResPointer.get() == target);
+
+		// Removing the source must remove its pointers
+		doc->removeObject(*sourceB);
+		REQUIRE(doc->getPointersTo(*target, false, false).size() == 1);
+
+		// Clearing the pointer must remove it
+		source->mResPointer = nullptr;
+		doc->invalidateReferences(*source);
+		REQUIRE(doc->getPointersTo(*target, false, false).isEmpty());
+	}
+
+	SECTION("large document")
+	{
+		auto doc = AppContext::get().newDocument();
+
+		// Every resource points to the previous one
+		const int count = 2000;
+		std::vector<TestResourceB*> resources;
+		for (int i = 0; i < count; i++)
+		{
+			auto res = doc->addObject<TestResourceB>(nullptr, std::string(), false);
+			if (!resources.empty())
+				res->mResPointer = resources.back();
+			resources.emplace_back(res);
+		}
+
+		// Look up every resource by name and find its pointers
+		auto start = std::chrono::high_resolution_clock::now();
+		for (int i = 0; i < count - 1; i++)
+		{
+			REQUIRE(doc->getObject(resources[i]->mID) == resources[i]);
+			auto pointers = doc->getPointersTo(*resources[i], false, false);
+			REQUIRE(pointers.size() == 1);
+			REQUIRE(pointers[0].getObject() == resources[i + 1]);
+		}
+		auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+		nap::Logger::info("Queried %d objects in %.2f ms", count, elapsed);
+
+		// Removing an object in the middle of the chain must remove its pointer
+		doc->removeObject(*resources[count / 2]);
+		REQUIRE(doc->getPointersTo(*resources[count / 2 - 1], false, false).isEmpty());
+	}
+
 	napkin::AppContext::destroy();
 }
\ No newline at end of file
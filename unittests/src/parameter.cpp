@@ -0,0 +1,84 @@
+#include "utils/catch.hpp"
+
+#include <parameternumeric.h>
+#include <parameterservice.h>
+#include <stagedvalue.h>
+#include <memory>
+#include <thread>
+
+TEST_CASE("Staged value", "[parameter]")
+{
+	nap::StagedValue<int> staged;
+	int value = -1;
+	REQUIRE(!staged.isStaged());
+	REQUIRE(!staged.read(value));
+	REQUIRE(value == -1);
+
+	// Values written in between reads are coalesced
+	staged.write(1);
+	staged.write(2);
+	REQUIRE(staged.isStaged());
+	REQUIRE(staged.read(value));
+	REQUIRE(value == 2);
+	REQUIRE(!staged.read(value));
+	REQUIRE(value == 2);
+
+	// Only the last value written on another thread is read
+	std::thread writer([&staged]()
+	{
+		for (int i = 0; i <= 1000; i++)
+			staged.write(i);
+	});
+	writer.join();
+	REQUIRE(staged.read(value));
+	REQUIRE(value == 1000);
+}
+
+
+TEST_CASE("Staged parameter values", "[parameter]")
+{
+	// The service isn't part of a core, staged values are committed manually
+	nap::ParameterService service(nullptr);
+	nap::ParameterFloat parameter;
+	parameter.mValue = 0.0f;
+	int changed = 0;
+	float last = -1.0f;
+	parameter.valueChanged.connect([&](float value) { changed++; last = value; });
+
+	// A value is set when committed, the signal is raised once for all values staged since the last commit
+	std::thread writer([&parameter]()
+	{
+		for (int i = 1; i <= 100; i++)
+			parameter.stageValue(i / 100.0f);
+	});
+	writer.join();
+	REQUIRE(parameter.mValue == 0.0f);
+	REQUIRE(changed == 0);
+	service.commitStagedValues();
+	REQUIRE(parameter.mValue == 1.0f);
+	REQUIRE(changed == 1);
+	REQUIRE(last == 1.0f);
+
+	// Nothing is staged, nothing changes
+	service.commitStagedValues();
+	REQUIRE(changed == 1);
+
+	// The parameter is queued again after a commit, staging the current value doesn't raise the signal
+	parameter.stageValue(0.5f);
+	service.commitStagedValues();
+	REQUIRE(parameter.mValue == 0.5f);
+	REQUIRE(changed == 2);
+	parameter.stageValue(0.5f);
+	service.commitStagedValues();
+	REQUIRE(changed == 2);
+
+	// A destroyed parameter is removed from the queue, the other queued parameters are still committed
+	auto destroyed = std::make_unique<nap::ParameterFloat>();
+	destroyed->mValue = 0.0f;
+	destroyed->stageValue(0.25f);
+	parameter.stageValue(0.75f);
+	destroyed.reset();
+	service.commitStagedValues();
+	REQUIRE(parameter.mValue == 0.75f);
+	REQUIRE(changed == 3);
+}
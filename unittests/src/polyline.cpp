@@ -0,0 +1,73 @@
+#include "utils/catch.hpp"
+
+#include <nap/core.h>
+#include <polyline.h>
+#include <renderservice.h>
+
+namespace
+{
+	/**
+	 * Open line that only holds CPU vertex data, the mesh is never initialized on the GPU
+	 */
+	class TestLine : public nap::PolyLine
+	{
+	public:
+		TestLine(nap::Core& core, nap::RenderService& renderService) : nap::PolyLine(core)
+		{
+			mMeshInstance = std::make_unique<nap::MeshInstance>(renderService);
+			createVertexAttributes(*mMeshInstance);
+		}
+
+		virtual bool isClosed() const override { return false; }
+	};
+}
+
+TEST_CASE("PolyLine distance table", "[polyline]")
+{
+	nap::Core core;
+	nap::RenderServiceConfiguration config;
+	nap::RenderService render_service(&config);
+	TestLine line(core, render_service);
+
+	const std::vector<glm::vec3> positions = { { 0.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }, { 3.0f, 0.0f, 0.0f } };
+	const std::vector<glm::vec3> normals(positions.size(), { 0.0f, 1.0f, 0.0f });
+	line.getPositionAttr().setData(positions);
+	line.getNormalAttr().setData(normals);
+	REQUIRE(line.getLength() == Approx(3.0f));
+
+	glm::vec3 position;
+	line.getPosition(0.5f, position);
+	REQUIRE(position.x == Approx(1.5f));
+
+	glm::vec3 normal;
+	line.getNormal(0.25f, normal);
+	REQUIRE(normal.y == Approx(1.0f));
+
+	// The table is rebuilt when the positions are changed through the mesh instance
+	const TestLine& const_line = line;
+	nap::Vec3VertexAttribute& attr = line.getMeshInstance().getAttribute<glm::vec3>(nap::vertexid::position);
+	attr[2] = { 5.0f, 0.0f, 0.0f };
+	REQUIRE(const_line.getLength() == Approx(5.0f));
+
+	attr.getData()[1] = { 2.0f, 0.0f, 0.0f };
+	const_line.getPosition(0.4f, position);
+	REQUIRE(position.x == Approx(2.0f));
+
+	attr.addData({ 5.0f, 1.0f, 0.0f });
+	REQUIRE(const_line.getLength() == Approx(6.0f));
+
+	attr.setData(positions);
+	REQUIRE(const_line.getDistanceTable().size() == positions.size());
+	REQUIRE(const_line.getLength() == Approx(3.0f));
+
+	// Direct writes to the data member require explicit invalidation
+	attr.mData[2] = { 4.0f, 0.0f, 0.0f };
+	line.invalidateDistances();
+	REQUIRE(const_line.getLength() == Approx(4.0f));
+
+	// Sampling the line doesn't change the positions
+	nap::uint64 version = const_line.getPositionAttr().getVersion();
+	const_line.getPosition(0.5f, position);
+	const_line.getNormal(0.5f, normal);
+	REQUIRE(const_line.getPositionAttr().getVersion() == version);
+}
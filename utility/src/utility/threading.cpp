@@ -4,6 +4,12 @@
 
 #include "threading.h"
 
+// External Includes
+#include <algorithm>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
 namespace nap
 {
     
@@ -23,6 +29,14 @@ namespace nap
     }
     
     
+    void TaskQueue::processNextBlocking()
+    {
+        Task task;
+        mQueue.wait_dequeue(task);
+        task();
+    }
+    
+    
     void TaskQueue::process()
     {
         auto it = mDequeuedTasks.begin();
@@ -127,9 +141,65 @@ namespace nap
     {
         mThreads.emplace_back([&](){
             while (!mStop)
-                mTaskQueue.processBlocking();
+                mTaskQueue.processNextBlocking();
         });
     }
     
     
+    void parallelFor(int count, int rangeCount, ThreadPool* threadPool, const std::function<void(int, int, int)>& function)
+    {
+        rangeCount = std::max<int>(std::min<int>(rangeCount, count), 1);
+        int helper_count = threadPool != nullptr ? std::min<int>(threadPool->getThreadCount(), rangeCount - 1) : 0;
+        if (helper_count == 0)
+        {
+            int size = (count + rangeCount - 1) / rangeCount;
+            for (int i = 0; i < rangeCount; i++)
+                function(i, std::min<int>(i * size, count), std::min<int>((i + 1) * size, count));
+            return;
+        }
+        
+        // Ranges are claimed by whichever thread comes first. The state is shared with the tasks,
+        // because a queued task can start after all ranges are processed and this call returned.
+        struct State
+        {
+            const std::function<void(int, int, int)>* mFunction = nullptr;
+            std::atomic<int> mNextRange = { 0 };
+            int mRangeCount = 0;
+            int mRangeSize = 0;
+            int mCount = 0;
+            int mFinished = 0;
+            std::mutex mMutex;
+            std::condition_variable mCondition;
+        };
+        
+        auto state = std::make_shared<State>();
+        state->mFunction = &function;
+        state->mRangeCount = rangeCount;
+        state->mRangeSize = (count + rangeCount - 1) / rangeCount;
+        state->mCount = count;
+        
+        auto process = [state]()
+        {
+            int range = 0;
+            while ((range = state->mNextRange.fetch_add(1)) < state->mRangeCount)
+            {
+                int begin = std::min<int>(range * state->mRangeSize, state->mCount);
+                int end = std::min<int>(begin + state->mRangeSize, state->mCount);
+                (*state->mFunction)(range, begin, end);
+                
+                std::lock_guard<std::mutex> lock(state->mMutex);
+                if (++state->mFinished == state->mRangeCount)
+                    state->mCondition.notify_one();
+            }
+        };
+        
+        for (int i = 0; i < helper_count; i++)
+            threadPool->execute(process);
+        process();
+        
+        std::unique_lock<std::mutex> lock(state->mMutex);
+        state->mCondition.wait(lock, [&state]() { return state->mFinished == state->mRangeCount; });
+    }
+    
+    
 }
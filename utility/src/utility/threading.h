@@ -9,6 +9,7 @@
 #include "dllexport.h"
 
 // External Includes
+#include <atomic>
 #include <functional>
 #include <thread>
 #include <vector>
@@ -40,6 +41,12 @@ namespace nap
          * If the queue is not empty all the tasks are executed.
          */
         void processBlocking();
+
+        /**
+         * Blocks until a task is enqueued and executes only that task.
+         * Safe to call from multiple threads at the same time, used by the ThreadPool.
+         */
+        void processNextBlocking();
         
         /**
          * Executes all tasks currently in the queue
@@ -140,4 +147,18 @@ namespace nap
         std::atomic<bool> mStop;
         TaskQueue mTaskQueue;
     };
+    
+    
+    /**
+     * Splits the range 0 - count into consecutive ranges and calls the function once for every range, with the index of the range,
+     * the first item and the end of the range. The ranges are processed by the calling thread and the threads of the pool at the same time.
+     * This call blocks until all ranges are processed. The calling thread only waits for ranges that are being processed,
+     * never for tasks that are still queued, which makes it safe to call from a task of the same pool.
+     * All ranges are processed on the calling thread when no pool is given.
+     * @param count number of items
+     * @param rangeCount number of ranges to split the items into, clamped to the number of items
+     * @param threadPool pool that helps processing the ranges, can be null
+     * @param function called with the range index, first item and end of every range
+     */
+    void parallelFor(int count, int rangeCount, ThreadPool* threadPool, const std::function<void(int, int, int)>& function);
 }
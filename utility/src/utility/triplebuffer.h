@@ -0,0 +1,99 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <atomic>
+
+namespace nap
+{
+	namespace utility
+	{
+		/**
+		 * Hands the latest value of one thread to another thread without locking.
+		 * The writer and the reader each own a buffer, the third buffer is shared and holds the last published value.
+		 * The writer fills the write buffer in place and publishes it, the reader picks up the last published buffer on update.
+		 * Values published in between two updates are coalesced, only the last one is read.
+		 * Neither side ever waits, buffers are reused and keep their allocations.
+		 * Values can be published from one thread at a time and read from one (other) thread at a time.
+		 */
+		template<typename T>
+		class TripleBuffer final
+		{
+		public:
+			/**
+			 * @param initialValue value copied into all three buffers, use it to allocate the buffers up front.
+			 */
+			TripleBuffer(const T& initialValue = T()) : mBuffers { initialValue, initialValue, initialValue } { }
+
+			/**
+			 * Writer side: the buffer to fill before publishing it.
+			 * @return the buffer owned by the writer
+			 */
+			T& getWriteBuffer()											{ return mBuffers[mWriteIndex]; }
+
+			/**
+			 * Writer side: publishes the write buffer and takes ownership of the previously shared buffer.
+			 * The previously shared buffer is overwritten by the next publish when it hasn't been read.
+			 */
+			void publish();
+
+			/**
+			 * Reader side: picks up the last published buffer, if any.
+			 * @return if a new buffer was published since the last update
+			 */
+			bool update();
+
+			/**
+			 * Reader side: the buffer picked up by the last update.
+			 * @return the buffer owned by the reader
+			 */
+			T& getReadBuffer()											{ return mBuffers[mReadIndex]; }
+
+			/**
+			 * Reader side: the buffer picked up by the last update.
+			 * @return the buffer owned by the reader
+			 */
+			const T& getReadBuffer() const								{ return mBuffers[mReadIndex]; }
+
+			/**
+			 * @return if a buffer was published since the last update
+			 */
+			bool isPublished() const									{ return (mShared.load(std::memory_order_relaxed) & publishedFlag) != 0; }
+
+		private:
+			static constexpr int publishedFlag = 0x4;					///< Set on the shared index when it holds a buffer that hasn't been read
+			static constexpr int indexMask = 0x3;						///< Buffer index part of the shared index
+
+			T mBuffers[3];												///< Write, shared and read buffer
+			std::atomic<int> mShared = { 1 };							///< Index of the shared buffer, including the published flag
+			int mWriteIndex = 0;										///< Buffer owned by the writer
+			int mReadIndex = 2;											///< Buffer owned by the reader
+		};
+
+
+		//////////////////////////////////////////////////////////////////////////
+		// Template Definitions
+		//////////////////////////////////////////////////////////////////////////
+
+		template<typename T>
+		void TripleBuffer<T>::publish()
+		{
+			int previous = mShared.exchange(mWriteIndex | publishedFlag, std::memory_order_acq_rel);
+			mWriteIndex = previous & indexMask;
+		}
+
+
+		template<typename T>
+		bool TripleBuffer<T>::update()
+		{
+			if (!isPublished())
+				return false;
+
+			int previous = mShared.exchange(mReadIndex, std::memory_order_acq_rel);
+			mReadIndex = previous & indexMask;
+			return true;
+		}
+	}
+}